@@ -71,3 +71,33 @@ bool AudioFileSourceFSLoop::open(const char *filename)
     f = LittleFS.open(filename, FILE_READ);
     return f;
 }
+
+// Memory ---------------------------------------------
+
+bool AudioFileSourceMem::open(const uint8_t *data, uint32_t len)
+{
+    buf = data;
+    size = len;
+    pos = 0;
+    return buf ? true : false;
+}
+
+uint32_t AudioFileSourceMem::read(void *data, uint32_t len)
+{
+    if(!buf) return 0;
+    if(len > size - pos) len = size - pos;
+    memcpy(data, buf + pos, len);
+    pos += len;
+    return len;
+}
+
+bool AudioFileSourceMem::seek(int32_t newPos, int dir)
+{
+    if(!buf) return false;
+    if(dir == SEEK_CUR)      newPos += pos;
+    else if(dir == SEEK_END) newPos += size;
+    else if(dir != SEEK_SET) return false;
+    if(newPos < 0 || (uint32_t)newPos > size) return false;
+    pos = newPos;
+    return true;
+}
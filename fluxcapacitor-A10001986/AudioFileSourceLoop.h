@@ -7,6 +7,8 @@
  *
  * Based on AudioFileSourceSD by Earle F. Philhower, III
  *
+ * AudioFileSourceMem reads a sound held in RAM/PSRAM.
+ *
  */
 
 #ifndef _AudioFileSourceLoop_H
@@ -56,4 +58,23 @@ class AudioFileSourceFSLoop : public AudioFileSourceLoop
     bool open(const char *filename) override;
 };
 
+class AudioFileSourceMem : public AudioFileSource
+{
+  public:
+    AudioFileSourceMem() {};
+    
+    bool open(const uint8_t *data, uint32_t len);
+    uint32_t read(void *data, uint32_t len) override;
+    bool seek(int32_t pos, int dir) override;
+    bool close() override                 { buf = NULL; return true; }
+    bool isOpen() override                { return buf ? true : false; }
+    uint32_t getSize() override           { return buf ? size : 0; }
+    uint32_t getPos() override            { return buf ? pos : 0; }
+
+  private:
+    const uint8_t *buf = NULL;
+    uint32_t size = 0;
+    uint32_t pos = 0;
+};
+
 #endif
@@ -0,0 +1,75 @@
+/*
+ * AudioGeneratorPCMLoop
+ * Play a mono 16 bit PCM buffer from RAM in an endless loop
+ *
+ * Thomas Winischhofer (A10001986), 2026
+ *
+ */
+
+#include "fc_global.h"
+#include "AudioGeneratorPCMLoop.h"
+
+bool AudioGeneratorPCMLoop::begin(const int16_t *buf, uint32_t len, uint32_t loopStart, int rate, AudioOutput *output)
+{
+    if(!buf || !len || loopStart >= len || !output) return false;
+
+    pcm = buf;
+    pcmLen = len;
+    pcmLoop = loopStart;
+    pcmPos = 0;
+
+    this->output = output;
+
+    output->SetBitsPerSample(16);
+    output->SetChannels(1);
+    output->SetRate(rate);
+
+    if(!output->begin()) return false;
+
+    // Wrap right after each read, so pcmPos is always valid
+    sL = sR = pcm[pcmPos++];
+    if(pcmPos >= pcmLen) pcmPos = pcmLoop;
+
+    running = true;
+
+    return true;
+}
+
+bool AudioGeneratorPCMLoop::loop()
+{
+    if(!running) return false;
+
+    // Push stored sample first; if output is full, try later
+    if(!output->ConsumeSample(sL, sR)) goto done;
+
+    do {
+        sL = sR = pcm[pcmPos++];
+        if(pcmPos >= pcmLen) pcmPos = pcmLoop;
+    } while(output->ConsumeSample(sL, sR));
+
+done:
+    output->loop();
+
+    return running;
+}
+
+bool AudioGeneratorPCMLoop::stop()
+{
+    if(running) {
+        running = false;
+        output->stop();
+    }
+    return true;
+}
+
+size_t AudioOutputPCMCapture::ConsumeSample(int16_t sL, int16_t sR)
+{
+    // Sample is consumed even if the buffer is full, so that the
+    // generator runs to its end; the caller checks isFull().
+    if(pcmLen < pcmMax) {
+        pcm[pcmLen++] = (channels == 1) ? sL : (int16_t)(((int32_t)sL + sR) >> 1);
+    } else {
+        overflow = true;
+    }
+    return 1;
+}
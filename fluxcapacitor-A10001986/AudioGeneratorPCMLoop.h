@@ -0,0 +1,59 @@
+/*
+ * AudioGeneratorPCMLoop
+ * Play a mono 16 bit PCM buffer from RAM in an endless loop
+ *
+ * Thomas Winischhofer (A10001986), 2026
+ *
+ * AudioOutputPCMCapture is the counterpart to fill such a
+ * buffer: Used as the output of another generator, it
+ * collects the decoded (mono-mixed) samples.
+ *
+ */
+
+#ifndef _AudioGeneratorPCMLoop_H
+#define _AudioGeneratorPCMLoop_H
+
+#include "src/ESP8266Audio/AudioGenerator.h"
+#include "src/ESP8266Audio/AudioOutput.h"
+
+class AudioGeneratorPCMLoop : public AudioGenerator
+{
+  public:
+    AudioGeneratorPCMLoop() { running = false; };
+    ~AudioGeneratorPCMLoop() {};
+
+    // buf: samples; len: total number of samples; loopStart:
+    // index to continue from after the last sample
+    bool begin(const int16_t *buf, uint32_t len, uint32_t loopStart, int rate, AudioOutput *output);
+    bool loop() override;
+    bool stop() override;
+    bool isRunning() override             { return running; }
+
+  private:
+    const int16_t *pcm = NULL;
+    uint32_t pcmLen = 0;
+    uint32_t pcmLoop = 0;
+    uint32_t pcmPos = 0;
+};
+
+class AudioOutputPCMCapture : public AudioOutput
+{
+  public:
+    AudioOutputPCMCapture(int16_t *buf, uint32_t maxLen) : pcm(buf), pcmMax(maxLen) { hertz = 0; channels = 2; };
+
+    bool begin() override                  { return true; }
+    size_t ConsumeSample(int16_t sL, int16_t sR) override;
+    bool stop() override                   { return true; }
+
+    uint32_t getLength()                   { return pcmLen; }
+    int getRate()                          { return hertz; }
+    bool isFull()                          { return overflow; }
+
+  private:
+    int16_t *pcm;
+    uint32_t pcmMax;
+    uint32_t pcmLen = 0;
+    bool     overflow = false;
+};
+
+#endif
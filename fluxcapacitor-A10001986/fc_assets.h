@@ -0,0 +1,276 @@
+/*
+ * fc_assets.h
+ *
+ * Generated by tools/wm_mkassets.py from fcicon.png, fcspi0.png, fcspi1.png, fclogo.png, fc.js, fc.css - do not edit
+ */
+
+#ifndef _FC_ASSETS_H_
+#define _FC_ASSETS_H_
+
+#define FCA_FCICON_PNG           "/fcicon.png?v=0ab23506"
+#define FCA_FCSPI0_PNG           "/fcspi0.png?v=ce90fc79"
+#define FCA_FCSPI1_PNG           "/fcspi1.png?v=b806ab9f"
+#define FCA_FCLOGO_PNG           "/fclogo.png?v=4ab58194"
+#define FCA_FC_JS                "/fc.js?v=30557326"
+#define FCA_FC_CSS               "/fc.css?v=9a569fbd"
+
+// /fcicon.png: 128 bytes
+static const uint8_t fc_fcicon_png[] PROGMEM = {
+    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,
+    0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x02,0x03,0x00,0x00,0x00,0x62,0x9d,0x17,
+    0xf2,0x00,0x00,0x00,0x0c,0x50,0x4c,0x54,0x45,0x49,0x4a,0x4a,0xce,0xcc,0xc3,0xfc,
+    0xf1,0xb3,0x93,0x8f,0x75,0xfe,0x47,0x25,0x24,0x00,0x00,0x00,0x2f,0x49,0x44,0x41,
+    0x54,0x08,0xd7,0x63,0x08,0x05,0x02,0x06,0x07,0x06,0x06,0x46,0x28,0x71,0x80,0x99,
+    0x91,0xc1,0x79,0x02,0xdb,0x41,0x06,0x87,0x14,0x49,0x20,0x57,0xfa,0x09,0x90,0xe0,
+    0x31,0x80,0xc9,0x32,0x35,0xa0,0x13,0x08,0xbd,0x60,0xa3,0x00,0xfe,0xff,0x0c,0x13,
+    0x7b,0xd8,0xd3,0x75,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82,
+};
+
+// /fcspi0.png: 211 bytes
+static const uint8_t fc_fcspi0_png[] PROGMEM = {
+    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,
+    0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x01,0x03,0x00,0x00,0x00,0x90,0xa7,0xe3,
+    0x9d,0x00,0x00,0x00,0x06,0x50,0x4c,0x54,0x45,0x00,0x00,0x00,0x4a,0x9d,0x6d,0x2f,
+    0x86,0x58,0x6b,0x00,0x00,0x00,0x01,0x74,0x52,0x4e,0x53,0x00,0x40,0xe6,0xd8,0x66,
+    0x00,0x00,0x00,0x7b,0x49,0x44,0x41,0x54,0x28,0xcf,0x7d,0xd1,0xb1,0x0d,0xc3,0x20,
+    0x14,0x06,0xe1,0x67,0xb9,0x70,0xe9,0x36,0x1d,0x2b,0x64,0x80,0x48,0xac,0x95,0x2a,
+    0x30,0x1a,0xa3,0x30,0x02,0x25,0x05,0xe2,0x22,0x85,0x02,0x05,0xfd,0xf6,0x55,0x5f,
+    0x7f,0x76,0xdb,0xd3,0xec,0x71,0x81,0xb7,0xd9,0xeb,0x02,0xcd,0xec,0xa3,0xb1,0x75,
+    0x33,0x34,0x76,0x6c,0x23,0x4a,0x1c,0xc4,0x9d,0x24,0x71,0x92,0x0e,0xb2,0x84,0x23,
+    0x9f,0x14,0x09,0x4f,0x71,0x54,0x89,0x40,0xf5,0x34,0x09,0x68,0x81,0xae,0xb0,0x41,
+    0x07,0x7e,0xe0,0x1f,0xfb,0x40,0x14,0x38,0x06,0x92,0xc0,0x39,0x90,0x27,0xdc,0x82,
+    0x32,0xe1,0x17,0xd4,0x89,0xb0,0xa0,0x4d,0x30,0xea,0xfa,0x97,0x86,0xe8,0x0b,0xec,
+    0x2f,0xf8,0xcf,0x4e,0xed,0x4b,0xf7,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,
+    0x42,0x60,0x82,
+};
+
+// /fcspi1.png: 184 bytes
+static const uint8_t fc_fcspi1_png[] PROGMEM = {
+    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,
+    0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x01,0x03,0x00,0x00,0x00,0x90,0xa7,0xe3,
+    0x9d,0x00,0x00,0x00,0x06,0x50,0x4c,0x54,0x45,0x00,0x00,0x00,0x4a,0x9d,0x6d,0x2f,
+    0x86,0x58,0x6b,0x00,0x00,0x00,0x01,0x74,0x52,0x4e,0x53,0x00,0x40,0xe6,0xd8,0x66,
+    0x00,0x00,0x00,0x60,0x49,0x44,0x41,0x54,0x28,0xcf,0x7d,0xd1,0xa1,0x15,0x80,0x20,
+    0x00,0x06,0x61,0x7d,0x06,0x22,0x23,0xb0,0x82,0x1b,0xb0,0x96,0x0d,0x46,0x63,0x14,
+    0x46,0x20,0x12,0x78,0xfc,0x12,0x0c,0xf0,0xf4,0xbc,0xf4,0xf5,0xdb,0x7e,0x3b,0x19,
+    0x17,0xa3,0x21,0xf6,0x8e,0x38,0x84,0x30,0x8a,0x04,0xab,0x44,0x70,0xca,0x04,0xaf,
+    0x42,0x08,0xaa,0x04,0xa9,0x01,0x76,0xa9,0x03,0x0e,0x49,0x00,0x33,0x10,0xbf,0x61,
+    0x07,0xd2,0x02,0x37,0x23,0x2f,0xf0,0x33,0xca,0x82,0x30,0xa3,0x2e,0xd0,0x03,0xf8,
+    0x05,0x78,0x75,0x03,0x3b,0x3b,0x85,0x57,0xf6,0x6d,0x51,0x60,0x00,0x00,0x00,0x00,
+    0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82,
+};
+
+// /fclogo.png: 1950 bytes
+static const uint8_t fc_fclogo_png[] PROGMEM = {
+    0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,
+    0x00,0x00,0x01,0x0b,0x00,0x00,0x00,0x2c,0x08,0x03,0x00,0x00,0x00,0x45,0x55,0x6d,
+    0x5a,0x00,0x00,0x00,0x42,0x50,0x4c,0x54,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8e,0xe1,0xf6,0xf2,0x00,
+    0x00,0x00,0x15,0x74,0x52,0x4e,0x53,0x00,0x80,0xc0,0x40,0x77,0x44,0xf0,0xbb,0xdf,
+    0x10,0x20,0x31,0xae,0x63,0x52,0x9e,0x90,0xd0,0x70,0x88,0xcc,0x44,0xf2,0xf2,0x3b,
+    0x00,0x00,0x06,0xf6,0x49,0x44,0x41,0x54,0x68,0xde,0xe4,0x98,0xdd,0x8e,0xdc,0x20,
+    0x0c,0x85,0x03,0x91,0x10,0x90,0xff,0x48,0xbc,0xff,0xab,0xd6,0xc6,0x67,0xec,0x21,
+    0x4c,0x76,0xb2,0xed,0x65,0xad,0x6a,0x33,0x10,0x63,0x1f,0xbe,0x38,0x40,0x3a,0xb4,
+    0x96,0x47,0xb6,0x69,0xb8,0xda,0x34,0xc2,0xf2,0x70,0x67,0x49,0x1c,0x06,0xb3,0xf1,
+    0x5c,0x27,0xbd,0x95,0xf4,0x32,0xd4,0x4b,0x86,0x6f,0xb6,0x98,0xe3,0xcb,0x92,0xba,
+    0x66,0x16,0xc3,0x0d,0x58,0x6e,0x94,0xbc,0xbc,0x3b,0x83,0x57,0x36,0x65,0xc8,0xe0,
+    0x4e,0x84,0x85,0x4d,0x10,0xea,0x44,0x58,0xa9,0x16,0x5c,0xed,0x75,0x45,0x6c,0xbb,
+    0x24,0xf0,0x05,0xe6,0xb4,0xcb,0xbc,0xc3,0x26,0x81,0xc4,0x3c,0x48,0xae,0xa1,0xb6,
+    0x6a,0x6a,0xfa,0x31,0x8a,0xc7,0x82,0x56,0x1d,0xbb,0x72,0x0c,0x8b,0x59,0x5e,0x36,
+    0x56,0xd7,0x53,0xee,0x7a,0x6e,0x58,0x7a,0x53,0xa2,0x03,0xe2,0xfa,0x26,0x26,0x2e,
+    0xd0,0x8b,0x59,0x41,0x99,0x29,0x2a,0x5b,0x66,0x5f,0x88,0x65,0x6e,0x11,0xba,0x2d,
+    0xd1,0x26,0x01,0x61,0x47,0x7a,0xca,0x02,0xde,0x16,0x28,0x4c,0x35,0xf1,0x7b,0x20,
+    0x81,0x70,0xf2,0x78,0x71,0x4c,0x75,0xec,0xf6,0x23,0x8b,0xe3,0x21,0x0b,0xc5,0x06,
+    0x5b,0xde,0xf5,0x6e,0xc6,0x62,0xd4,0xf0,0x0d,0x8b,0x1c,0x34,0x08,0x3c,0x10,0xc3,
+    0x59,0xd6,0xc7,0x2c,0x20,0x06,0x81,0x00,0x7b,0x88,0x05,0xb6,0x4b,0x83,0x06,0x62,
+    0xfa,0x0b,0x5d,0xa4,0x11,0x7e,0x64,0x51,0xf2,0x63,0x16,0x70,0xb5,0x86,0xb7,0x58,
+    0xca,0xe2,0x28,0xb0,0xa1,0x61,0xb1,0x15,0x98,0xd4,0x85,0xf7,0xec,0x17,0x45,0x59,
+    0x74,0x0e,0xad,0x96,0x45,0x74,0x6c,0xb6,0x1e,0x34,0xde,0x5e,0x32,0x3a,0xe7,0x21,
+    0x66,0xe1,0xeb,0xb6,0xf3,0x84,0x13,0x0f,0x67,0x24,0xb3,0x38,0x3a,0xfc,0x25,0x5b,
+    0xaf,0x2c,0x36,0xc7,0x96,0x65,0xfa,0x27,0x7c,0x33,0x75,0x41,0xc0,0xd8,0x28,0xe1,
+    0x78,0x6e,0x0f,0xea,0x1a,0xdd,0x8e,0x71,0xbe,0xde,0x89,0xd4,0x98,0x5f,0x2c,0x72,
+    0x55,0x44,0x81,0x90,0xdc,0xb1,0xd1,0xf3,0x0f,0xec,0xe4,0xe6,0x12,0xe0,0x28,0x3a,
+    0x27,0xe4,0x16,0x56,0xa9,0x61,0x21,0xfd,0xad,0xc1,0x9b,0x81,0x47,0x0d,0xb4,0xc8,
+    0x14,0x67,0x81,0x70,0x4a,0x6b,0xaf,0x8e,0x5e,0x10,0x53,0x63,0x06,0x8b,0xed,0xca,
+    0x02,0xa8,0x85,0xc5,0x21,0x19,0x34,0x55,0xa7,0x44,0xaa,0x23,0x05,0x04,0x44,0xc5,
+    0x23,0x95,0x6b,0x95,0xe9,0x12,0xb4,0x2e,0x92,0x7c,0x80,0x09,0xaf,0x61,0x72,0x3a,
+    0x85,0x6c,0xcf,0x01,0x2f,0xfb,0xf8,0x94,0x05,0x22,0x23,0x50,0x12,0x81,0x24,0x69,
+    0x43,0xa6,0xbd,0x7a,0x1c,0xdc,0x47,0x26,0x3a,0xc1,0x22,0xdc,0xb3,0x60,0xcb,0x8f,
+    0x58,0xa0,0x0b,0x1e,0x33,0x4d,0x1f,0x39,0x5a,0x65,0xa3,0x86,0xef,0x58,0x9c,0x96,
+    0x95,0xbb,0x21,0x1e,0x01,0xc7,0x5f,0xb1,0xd8,0x8a,0x15,0x18,0x04,0x26,0xc9,0x80,
+    0x81,0xb8,0x87,0xf9,0xf9,0x17,0x75,0x4a,0xb9,0xfe,0xc8,0xe2,0xfc,0x2d,0x0b,0x4c,
+    0xf3,0x96,0xc5,0xf9,0x99,0xc5,0xdc,0xb0,0xd0,0x80,0x56,0x17,0xd3,0x63,0x16,0x91,
+    0xa2,0x35,0x75,0xb1,0x18,0xcc,0xb9,0x56,0xc4,0x44,0x4d,0xfe,0xe3,0xb9,0x97,0x6f,
+    0x49,0xa9,0x10,0xfe,0x7b,0x16,0x3e,0x94,0xf9,0x5f,0x59,0xec,0xfa,0x94,0x44,0x43,
+    0x58,0x3f,0xb1,0x60,0xdf,0x7b,0x16,0x33,0xc7,0xb8,0xb0,0x08,0x9e,0x6c,0xb9,0xb2,
+    0x88,0xb2,0x76,0xad,0x1a,0xe8,0x64,0x8c,0x60,0x61,0x59,0xb9,0x49,0x7d,0x8e,0x3d,
+    0x6d,0x87,0x38,0x4a,0xbc,0xb0,0x38,0x38,0xc9,0x54,0x83,0x45,0x12,0x91,0x3a,0x16,
+    0xa6,0x44,0x59,0x64,0xbc,0x87,0xfd,0x3b,0x92,0xa2,0x55,0x25,0x76,0x36,0x9f,0x5f,
+    0xaa,0x38,0xc8,0x2e,0x03,0x28,0xef,0xf8,0x91,0x45,0x94,0xf5,0x77,0xfb,0xb8,0xa7,
+    0xba,0x2b,0x0b,0x74,0x23,0x90,0x6e,0x41,0x57,0x16,0x91,0x9a,0x44,0x89,0x71,0x20,
+    0x21,0x4b,0x77,0x84,0xad,0xdb,0x53,0xed,0x58,0x46,0xff,0x7a,0x16,0xa6,0x04,0xfb,
+    0xc8,0x56,0xde,0x97,0xfd,0x84,0xb5,0xb3,0xde,0x09,0x1c,0xe5,0x72,0xbe,0x08,0x76,
+    0x74,0x60,0x4f,0x3d,0x5f,0xec,0xca,0xc2,0x76,0x3a,0x58,0x48,0xbf,0x60,0x11,0x27,
+    0x04,0xc2,0x5c,0x7a,0x16,0x9e,0x39,0xd1,0x2f,0xca,0x39,0xda,0x29,0x6a,0xa2,0xe6,
+    0x3d,0x8b,0x54,0xca,0xfc,0x95,0x85,0x9d,0x61,0xec,0x31,0x9e,0xea,0xc5,0xa9,0x6c,
+    0x8a,0xa7,0x86,0x37,0x16,0x76,0x1c,0x3d,0xfb,0xba,0x40,0x88,0x3c,0x3c,0x63,0x11,
+    0xbc,0x2f,0xa0,0x6f,0xc7,0xce,0x9e,0xc5,0x46,0x43,0xe7,0x12,0xa9,0x3e,0xfc,0xa9,
+    0xef,0xb5,0xa7,0x66,0xbc,0x67,0xc1,0xd5,0xfb,0x9d,0x05,0x7e,0x37,0x8f,0xd1,0xbc,
+    0xe6,0xa4,0x2c,0xc8,0xa6,0xa3,0xde,0xbf,0xb0,0x18,0xf2,0x5c,0x1b,0xb9,0x67,0x11,
+    0x7c,0x94,0x78,0x4f,0xd7,0xce,0xec,0x75,0x85,0xf2,0x9c,0xac,0x63,0x21,0x97,0xd9,
+    0x93,0xb3,0x2f,0x47,0x9d,0x3c,0xc6,0xee,0xd4,0x7d,0xbb,0x8f,0xf0,0x51,0x65,0xfb,
+    0xb6,0x76,0x46,0x8f,0xdd,0xbb,0x3b,0x83,0x47,0x1f,0xe1,0xaa,0x2c,0x50,0x1a,0x23,
+    0x54,0x99,0x8d,0x72,0x5e,0xfb,0xb0,0x76,0x4e,0x08,0xf8,0x88,0x05,0x72,0x4d,0x08,
+    0x14,0xa4,0x60,0x6d,0x1f,0xd1,0x8d,0x89,0x44,0xef,0x3c,0xf9,0x8d,0xb3,0xbe,0x65,
+    0xba,0x67,0x91,0x88,0xf1,0xd7,0x7d,0x04,0x3b,0xba,0xb2,0x98,0x47,0x78,0x39,0x66,
+    0x59,0xb2,0xb2,0x30,0x18,0x67,0xc7,0xa2,0x0a,0x71,0xea,0x18,0x74,0x31,0xc6,0x26,
+    0xf9,0x3b,0x16,0xa3,0x04,0x52,0x65,0xaf,0x29,0x7a,0x75,0x39,0xb8,0xc7,0x61,0x5f,
+    0xb5,0x4c,0xf7,0x2c,0x2a,0xc8,0xef,0x2c,0x56,0xfb,0xe0,0xf5,0xa6,0xd7,0x0e,0x39,
+    0x2d,0x0b,0xee,0x73,0x3d,0x0b,0x16,0xe2,0xe1,0x88,0x5a,0x40,0xc0,0x9d,0x1a,0xe9,
+    0xaf,0x58,0x40,0x19,0x70,0x22,0xb5,0xae,0x05,0x2b,0x3b,0x45,0x2e,0x22,0xcd,0xf4,
+    0x23,0x8b,0xe5,0x3b,0x0b,0x3b,0xe2,0xf6,0x2c,0x86,0xa3,0x5d,0x3b,0xd9,0xd6,0xae,
+    0x2e,0x0c,0x11,0x1c,0xd3,0x61,0xbb,0x3e,0xc0,0x60,0x8e,0x1d,0x0b,0xeb,0x85,0x77,
+    0xda,0x8c,0x85,0x2a,0xdb,0xc4,0x6b,0x07,0x1a,0xea,0xe6,0x0e,0xbc,0x14,0x36,0x76,
+    0xfa,0x91,0x45,0x7a,0xc2,0x02,0xa5,0xd8,0xb3,0x90,0x17,0x22,0x2b,0x0b,0x4f,0x42,
+    0xd2,0xdc,0xad,0x17,0x3b,0x0e,0x65,0x60,0xe1,0x3d,0x92,0xf6,0x27,0x49,0x63,0x11,
+    0x3c,0xdb,0x6e,0xbd,0xb6,0x8f,0xd8,0x49,0x57,0x95,0xad,0xdc,0x79,0x30,0x81,0x60,
+    0xcb,0x7f,0x92,0xfa,0x88,0xcd,0x99,0xb5,0x3f,0x6b,0xf9,0x49,0xbf,0x18,0x7b,0x16,
+    0xa6,0x04,0x2c,0x50,0x8a,0x9f,0x58,0x64,0x71,0x00,0x58,0x59,0x68,0xf5,0x3f,0x4f,
+    0x7c,0x35,0x56,0xc0,0xbb,0x05,0x96,0x3c,0x98,0xbd,0xc5,0x78,0x49,0x5a,0x16,0x30,
+    0x7f,0x61,0x01,0x9b,0xaf,0xdf,0xa9,0xc3,0xd1,0x6c,0x78,0x8c,0x08,0x65,0x03,0xc9,
+    0x9a,0xa9,0xdf,0x53,0xad,0xc8,0xce,0x9e,0x85,0x29,0x01,0x8b,0xe6,0x53,0x0a,0xd6,
+    0x7f,0xa7,0x32,0x32,0xd8,0xfe,0x2e,0x7c,0xc8,0x16,0xcf,0x58,0x9c,0x97,0x15,0x60,
+    0xf9,0x05,0x8b,0x60,0x95,0x98,0x70,0x66,0x9d,0x02,0x06,0x98,0xab,0x47,0xa0,0xfd,
+    0x92,0xe9,0x9e,0x45,0x7e,0xc0,0x02,0x5f,0x0c,0x3d,0x8b,0xe6,0x83,0x80,0xa9,0x8b,
+    0x1d,0xa9,0x61,0xb1,0xd8,0xb1,0x08,0x2c,0xe2,0x3c,0x36,0x29,0x03,0x5d,0x1f,0xb3,
+    0xf0,0xbb,0x9e,0x68,0xa0,0x4c,0x4f,0x30,0x01,0xf3,0xac,0x29,0x3d,0xea,0xc3,0x5d,
+    0x32,0xdd,0xb3,0x18,0x8e,0xaf,0x2c,0x10,0x7b,0xf9,0xc8,0x22,0xbf,0x2f,0x89,0xee,
+    0x60,0x41,0x55,0xab,0xb1,0xa0,0xd1,0xb5,0x82,0xe7,0x3c,0xfc,0x67,0xf6,0x87,0x1d,
+    0x3b,0x16,0x00,0x00,0x00,0x40,0x00,0xd6,0x9f,0xbf,0x6f,0x04,0x19,0x6c,0x18,0x3b,
+    0x8d,0xdf,0x06,0x00,0x00,0x58,0x33,0x56,0xb3,0x33,0x29,0x08,0x04,0xeb,0xd0,0x4d,
+    0x03,0x8a,0x1e,0xa0,0xde,0xff,0x55,0x57,0xbe,0x9e,0x05,0x75,0x9d,0xc3,0x1e,0x4c,
+    0xbe,0x3a,0x8c,0x4d,0x52,0x3f,0x63,0x65,0x80,0x64,0x7e,0x3d,0x72,0xb5,0x5d,0xd1,
+    0x21,0x02,0x87,0x4a,0x06,0xb2,0xe8,0x31,0x1c,0x28,0x67,0xb6,0xae,0xb6,0x17,0x57,
+    0xad,0xc7,0x53,0xca,0xc1,0x73,0x92,0xca,0xd2,0x3d,0xd4,0xd7,0xa2,0xae,0x1f,0x23,
+    0x50,0x56,0xab,0xf9,0xe6,0x34,0xd5,0xfe,0x48,0xf2,0x63,0x7e,0x91,0x0c,0x0e,0x8a,
+    0x59,0x55,0xbc,0x88,0xc8,0x03,0xd9,0xff,0xab,0x81,0x43,0xa8,0x80,0x52,0x8e,0xa1,
+    0xa3,0x4e,0xf2,0xc6,0x8e,0x05,0x1a,0x78,0x40,0x40,0x83,0xb2,0xc3,0x20,0x8c,0x07,
+    0x81,0xe2,0x6b,0x8a,0xeb,0xc7,0x88,0xb5,0x8f,0xe1,0xee,0x34,0xd5,0x9e,0xd4,0xf8,
+    0x93,0xbf,0x9d,0x24,0x23,0xa1,0xfa,0xf2,0x45,0x94,0x0d,0xd2,0x83,0x53,0xb0,0x87,
+    0x2e,0x14,0x5b,0xe0,0x24,0x1b,0x17,0x2c,0xd2,0x0b,0x94,0xac,0x6b,0xf6,0x2e,0xe4,
+    0x23,0xea,0x03,0x25,0xa9,0x36,0xaa,0xe6,0xbf,0x7a,0xb8,0x55,0x61,0xdb,0x72,0xa9,
+    0x77,0xa7,0xa9,0xf6,0xa4,0xda,0x15,0xc6,0xb3,0x64,0x70,0x18,0x13,0xb6,0x82,0x57,
+    0xe1,0x61,0xbb,0xc9,0x63,0x17,0xb0,0x73,0x17,0xfe,0x72,0x0b,0x57,0x5f,0x5f,0xba,
+    0xb0,0x90,0xd0,0x17,0xae,0xb8,0x75,0xb1,0x72,0xc1,0xc0,0x70,0x9a,0xea,0xd1,0x41,
+    0x05,0xb8,0x5e,0x24,0xb3,0x8b,0x8c,0xd7,0x21,0xdc,0xa0,0xcc,0xa7,0x2e,0x9a,0x59,
+    0xfb,0xbc,0x4b,0x8e,0xe1,0xcc,0x64,0xac,0xc9,0xbf,0xdd,0xe8,0x22,0x9a,0x19,0x3a,
+    0x97,0xf5,0xda,0x85,0x1b,0x79,0x5d,0xa3,0xd1,0x9b,0x93,0xab,0x67,0x52,0x68,0xd8,
+    0x28,0x67,0xc9,0xe0,0xac,0x64,0x13,0xbc,0x8b,0x25,0x18,0x10,0x05,0xa7,0x2e,0x7e,
+    0x20,0x3e,0xc4,0x0d,0x13,0xa5,0x91,0xed,0xd6,0x45,0x47,0x17,0xe9,0xce,0x7c,0xef,
+    0xa2,0xe3,0xa1,0x8b,0xe9,0xe4,0x8c,0x99,0xb4,0x32,0x55,0xe6,0xb3,0x64,0x70,0x92,
+    0x44,0xb2,0xe2,0x4d,0x2c,0xa1,0x25,0x48,0x50,0xdd,0xb9,0xfc,0xb3,0x47,0xf6,0xfd,
+    0x9e,0x9e,0x8d,0xaa,0xac,0x0f,0x7b,0x44,0x53,0x58,0xbf,0xee,0x11,0x63,0x02,0x1e,
+    0x9c,0x5c,0x3d,0x93,0x0a,0x4b,0x8b,0x57,0x89,0x73,0x7c,0x8c,0xc4,0x7b,0xf0,0x2a,
+    0x20,0xec,0xb0,0x87,0xf3,0x22,0x32,0x23,0x6b,0xfe,0x90,0x0f,0x6a,0xed,0x2f,0x1d,
+    0x16,0xa0,0xdc,0xbb,0x80,0xf0,0xb9,0x0b,0xaf,0x15,0x48,0x1b,0x1c,0xc3,0x69,0xaa,
+    0x3d,0x09,0x99,0x2b,0xeb,0x45,0x32,0x12,0xba,0x57,0x7b,0xb5,0x0b,0x63,0x33,0xab,
+    0x7d,0x92,0xe7,0x7b,0x84,0xbb,0x5f,0x34,0x1d,0x2d,0xd8,0x1a,0x42,0x82,0x30,0x58,
+    0x63,0x99,0xe7,0x45,0x75,0x51,0xfc,0xda,0x45,0x0a,0x6c,0x16,0x22,0x1c,0xc3,0x69,
+    0xaa,0x3d,0xa9,0x5b,0x70,0xbb,0x4a,0x3e,0x9c,0xc4,0xb8,0x1a,0x0d,0x2f,0xc2,0xc6,
+    0x0f,0xe2,0xeb,0x3d,0xa2,0xa3,0x0b,0x89,0x9f,0xf3,0x43,0x02,0x69,0xcb,0x3c,0x2f,
+    0xcc,0xb9,0xdb,0xd7,0x2e,0xb0,0x18,0x19,0xdc,0x66,0x3a,0x5d,0xd5,0xd6,0x3f,0x2a,
+    0x79,0x93,0x7c,0x38,0x69,0xf7,0xcc,0xff,0xc1,0x1f,0xa5,0xb1,0xfe,0xa5,0x77,0xff,
+    0xea,0xb7,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82,
+};
+
+// /fc.js: 773 bytes, 504 gzipped
+static const uint8_t fc_fc_js[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x5d,0x52,0x4d,0x8f,0xda,0x30,
+    0x10,0xbd,0xf7,0x57,0x44,0xb9,0x8c,0x5d,0xd8,0x40,0x1a,0x68,0x81,0x10,0x90,0xba,
+    0xaa,0xc4,0x61,0xf7,0xd4,0xde,0x58,0x0e,0x5e,0xdb,0x09,0x56,0x9d,0x38,0xb5,0x0d,
+    0xe1,0x43,0xfc,0xf7,0x9d,0x04,0xda,0xb2,0x7b,0xb0,0x65,0xbf,0x79,0xf3,0x66,0xf4,
+    0x66,0x1a,0x55,0x09,0xd3,0x44,0xa6,0xd2,0x86,0x89,0x2c,0xdf,0x55,0xdc,0x2b,0x53,
+    0x11,0x7a,0x3e,0x1c,0x0e,0x99,0x30,0x7c,0x57,0xca,0xca,0x47,0x7f,0x76,0xd2,0x1e,
+    0x7f,0x4a,0x2d,0xb9,0x37,0x96,0x80,0xe3,0x56,0xd5,0x7e,0x2d,0x98,0x67,0x0f,0x7e,
+    0x03,0x34,0x6d,0xc9,0x78,0x96,0x78,0xa2,0x16,0x75,0xd2,0x47,0x7e,0x06,0x90,0x1e,
+    0x8f,0xc7,0x0c,0x96,0x90,0x36,0x36,0x2b,0x24,0x81,0xc6,0xb2,0x1a,0xe9,0x2a,0x27,
+    0x8d,0xa5,0x67,0xc6,0x3a,0x70,0x9b,0x5c,0x21,0xc6,0xe8,0xb9,0xe5,0x33,0x16,0xa9,
+    0xaa,0x92,0x76,0xf5,0xeb,0xf9,0x29,0xc5,0x8f,0x95,0xa5,0xd9,0x4b,0x42,0x53,0xa1,
+    0xa5,0x46,0x7a,0x0c,0xf4,0x72,0x3a,0x65,0xe4,0x99,0xf9,0x6d,0x64,0x19,0xf6,0x5f,
+    0x12,0xba,0x18,0x46,0x13,0x64,0x88,0xff,0x3d,0x73,0x2b,0x99,0x97,0x3f,0xb4,0x6c,
+    0x7f,0x04,0x84,0xda,0x43,0x4b,0x88,0xb8,0x66,0xce,0x3d,0x29,0xe7,0x23,0x26,0x04,
+    0x01,0x5f,0x97,0xc3,0x6b,0xe0,0x5f,0xd1,0x0c,0xe6,0xc8,0x0e,0x3a,0x62,0x16,0x22,
+    0x21,0x0c,0x4c,0xf5,0xa8,0x15,0xff,0x9d,0x85,0x6e,0xeb,0x6a,0x12,0xd3,0xb4,0xb9,
+    0xfa,0xa6,0x0d,0x67,0xad,0x61,0xd9,0x0b,0x0c,0x5e,0x20,0x5c,0x7c,0x48,0xfc,0x82,
+    0x88,0x2a,0x8b,0x40,0x09,0xcc,0xac,0x55,0x18,0x38,0xcb,0xb3,0x10,0x7a,0xe4,0x74,
+    0x5a,0xc2,0x20,0xe7,0x88,0xc5,0x51,0x5d,0x15,0xcb,0x7d,0xf6,0x3a,0x19,0x7e,0x65,
+    0xaf,0xd3,0x1c,0x66,0xb7,0xc0,0xf0,0x16,0xe0,0x72,0x3a,0xcc,0xf9,0xb7,0x29,0xd0,
+    0x1e,0x84,0x77,0xda,0x09,0x6a,0x0f,0xb0,0xdc,0x62,0xbe,0x8a,0xef,0xe0,0x6d,0xfc,
+    0x57,0x3f,0x70,0xfe,0xa8,0x65,0x16,0x96,0xcc,0x16,0xaa,0x7a,0xd0,0x32,0xf7,0xb3,
+    0x38,0x1a,0xc9,0x32,0xc4,0x1a,0xad,0xda,0x02,0x7a,0x38,0xb0,0x1e,0xcc,0x07,0xab,
+    0x18,0xdf,0x30,0x5f,0x25,0xf7,0x42,0xc9,0x47,0xa1,0x1a,0x0d,0x53,0x55,0x71,0x55,
+    0x1a,0xbf,0xd3,0xc1,0xb9,0xb5,0x3a,0x5d,0x3b,0xdd,0xdd,0x8e,0x1c,0x1d,0x75,0xd2,
+    0xfa,0xef,0x32,0x37,0x56,0x12,0x21,0xfa,0x08,0xe5,0xca,0x3a,0xff,0xb8,0x55,0x5a,
+    0xd0,0x96,0xd1,0x29,0x47,0xb5,0x71,0xaa,0x73,0x11,0xac,0xd4,0xe8,0xe7,0x5e,0xc2,
+    0x65,0xcf,0x6c,0xa0,0x79,0xb7,0x20,0x9a,0x5f,0x17,0x44,0x73,0x7a,0xd6,0xfc,0x96,
+    0xe3,0x71,0xf2,0x0e,0x85,0x4b,0x4c,0x32,0x1e,0x27,0x4d,0xb0,0xdb,0x64,0x3c,0xe9,
+    0xad,0x87,0xfd,0xb8,0x9f,0xf4,0x47,0xfd,0xf1,0x66,0xdd,0xad,0x48,0xae,0x0d,0x2e,
+    0xed,0xbb,0x6d,0xf9,0x3c,0xa2,0x1b,0x6c,0x5c,0xc8,0x82,0xc2,0xe5,0xf2,0xe9,0x0d,
+    0x59,0xf4,0xc9,0xfe,0x05,0x03,0x00,0x00,
+};
+
+// /fc.css: 1073 bytes, 573 gzipped
+static const uint8_t fc_fc_css[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x6d,0x53,0xc9,0x6e,0xdb,0x30,
+    0x10,0xbd,0xf7,0x2b,0x54,0x04,0x81,0x2f,0xa2,0x41,0xd9,0x75,0x92,0x52,0x40,0x80,
+    0xf6,0x94,0x5e,0x7a,0x68,0xd0,0xde,0x29,0x71,0x64,0x0d,0xc2,0x0d,0x24,0x65,0x27,
+    0x11,0xfc,0xef,0x9d,0x50,0xf2,0xd2,0xa4,0x10,0x04,0x52,0xb3,0xbc,0x79,0xf3,0x66,
+    0xf4,0x50,0x8d,0x9d,0xb3,0x89,0x75,0xd2,0xa0,0x7e,0x11,0xdf,0x65,0x6f,0x63,0xdb,
+    0x07,0xec,0x52,0xc9,0xa4,0xf7,0x1a,0x58,0x7c,0x89,0x09,0x4c,0xb9,0x78,0x84,0xad,
+    0x83,0xe2,0xf7,0x8f,0xe2,0x11,0x0c,0x36,0x4e,0xab,0x45,0xf9,0xcb,0x35,0x2e,0xb9,
+    0x72,0xf1,0x00,0x7a,0x07,0x09,0x5b,0x59,0xfc,0x84,0x01,0x16,0xe5,0xb7,0x80,0x52,
+    0x97,0x7f,0x20,0x28,0x69,0x65,0x19,0xa5,0x8d,0x2c,0x02,0x61,0xd6,0x46,0x86,0x2d,
+    0x5a,0xc1,0xeb,0x04,0xcf,0x89,0x49,0x8d,0x5b,0x2b,0x5a,0xb0,0x09,0x42,0x7d,0x78,
+    0x58,0x8f,0x47,0x77,0xc1,0x8b,0x8d,0x7f,0x2e,0xfe,0x1b,0x86,0xd6,0x0f,0x69,0x6c,
+    0x5c,0x50,0x10,0x44,0xea,0xd1,0x16,0x68,0x23,0xa4,0x03,0x98,0xe2,0xbe,0x88,0x46,
+    0x6a,0x3d,0x2a,0x8c,0x5e,0xcb,0x17,0x81,0x56,0xa3,0x85,0x43,0xe7,0x82,0x99,0xa1,
+    0x59,0xa3,0x5d,0xfb,0xc4,0xc0,0x2a,0xe2,0x70,0x58,0x26,0x6f,0xc6,0x46,0xb6,0x4f,
+    0xdb,0xe0,0x06,0xab,0x58,0xeb,0xb4,0x0b,0xe2,0xaa,0xeb,0xba,0xba,0x1d,0x42,0xa4,
+    0xbb,0x77,0x98,0xab,0xce,0xe5,0x2a,0x22,0x15,0x9d,0x46,0x55,0x34,0x9a,0xd2,0x66,
+    0x33,0x0b,0x52,0xe1,0x10,0x05,0x51,0xae,0xbd,0x54,0x0a,0xed,0x36,0xb7,0x40,0x0f,
+    0x59,0x0c,0x55,0xdd,0xa3,0x4a,0xbd,0xa8,0xee,0xc0,0x4c,0x45,0x57,0xa3,0x77,0x11,
+    0x13,0x3a,0x2b,0x64,0x43,0x80,0x43,0x82,0x3a,0x39,0x2f,0x18,0x5f,0xde,0x52,0xcc,
+    0x2b,0x43,0xab,0xe0,0x59,0x54,0x6b,0x5e,0x6b,0xe8,0x92,0x98,0xcc,0x39,0x75,0x3d,
+    0x4e,0x60,0x5f,0xc8,0xd0,0x03,0x6e,0xfb,0x94,0xaf,0xd9,0xd7,0xcf,0xb3,0xdc,0x49,
+    0xd2,0x9f,0xce,0x56,0xfa,0x28,0x48,0x10,0x96,0x65,0xc9,0x9f,0x75,0x0e,0xd8,0x4f,
+    0x89,0x96,0x84,0x91,0x7a,0x1e,0x0a,0xcb,0x95,0x56,0xcb,0x15,0xa1,0xb9,0x1d,0x84,
+    0x4e,0xbb,0xbd,0x68,0x35,0xfa,0x19,0x7b,0x7d,0xa1,0x94,0xb8,0xe2,0x9c,0x4f,0x50,
+    0x11,0x5f,0x81,0xf8,0xdd,0x50,0xd6,0x49,0x3e,0x79,0x94,0x61,0xc2,0xbc,0xcd,0x98,
+    0x97,0x55,0xf8,0x72,0x73,0xb6,0x84,0xcc,0x65,0x32,0x7d,0x14,0xf4,0x44,0xa5,0x47,
+    0xa5,0xc0,0xd6,0xfb,0x1e,0x13,0xed,0xa4,0x97,0x2d,0x10,0xff,0x7d,0x90,0x3e,0xd3,
+    0xe3,0x67,0x45,0x03,0x68,0x99,0x70,0x07,0xf5,0x24,0xd4,0x8a,0x13,0xee,0x71,0x2c,
+    0x79,0xab,0xe8,0x9d,0xcf,0xd3,0x3e,0x16,0x72,0x48,0xae,0x98,0x0e,0xea,0xb7,0x35,
+    0x9e,0x9f,0x96,0xf1,0x3c,0x53,0xf2,0x44,0xd0,0x7c,0x3c,0x37,0xfe,0x95,0x5f,0xcf,
+    0x65,0x72,0xe6,0x65,0x8f,0xd5,0x1b,0x3e,0x91,0x7f,0xfb,0x2d,0xf4,0xbc,0xc3,0x8d,
+    0xa4,0x7c,0x5a,0x49,0x02,0x32,0x69,0x73,0xdc,0xc9,0xb7,0xc9,0x13,0xa1,0xcf,0x68,
+    0xbc,0x0b,0x89,0x06,0x47,0xde,0xa6,0xe2,0xa7,0x95,0x75,0x29,0x39,0x93,0xf1,0xfe,
+    0x0d,0x79,0x1f,0xf1,0x21,0xa0,0xda,0xbc,0xc7,0x78,0x5f,0x46,0xaf,0x4e,0x20,0xd3,
+    0xf8,0x09,0x83,0x9a,0x8c,0xf7,0x5a,0x36,0xa0,0x0b,0x92,0xd9,0x5e,0x74,0x7b,0xc7,
+    0xaf,0x0f,0x9f,0xfe,0x02,0x1f,0x9d,0xcb,0x27,0x31,0x04,0x00,0x00,
+};
+
+static const WMAsset fcAssets[] = {
+    { "/fcicon.png", "image/png", fc_fcicon_png, sizeof(fc_fcicon_png), "\"0ab23506\"", false },
+    { "/fcspi0.png", "image/png", fc_fcspi0_png, sizeof(fc_fcspi0_png), "\"ce90fc79\"", false },
+    { "/fcspi1.png", "image/png", fc_fcspi1_png, sizeof(fc_fcspi1_png), "\"b806ab9f\"", false },
+    { "/fclogo.png", "image/png", fc_fclogo_png, sizeof(fc_fclogo_png), "\"4ab58194\"", false },
+    { "/fc.js", "application/javascript", fc_fc_js, sizeof(fc_fc_js), "\"30557326\"", true },
+    { "/fc.css", "text/css", fc_fc_css, sizeof(fc_fc_css), "\"9a569fbd\"", true },
+};
+
+#define FCA_COUNT                (sizeof(fcAssets) / sizeof(fcAssets[0]))
+
+#endif
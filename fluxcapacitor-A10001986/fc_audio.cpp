@@ -62,6 +62,12 @@
 
 #include "src/ESP8266Audio/AudioGeneratorMP3.h"
 #include "src/ESP8266Audio/AudioOutputI2S.h"
+#ifdef FC_FLUXCACHE
+#include "AudioGeneratorPCMLoop.h"
+#endif
+#ifdef FC_MIXER
+#include "src/ESP8266Audio/AudioOutputMixer.h"
+#endif
 
 #include "fc_main.h"
 #include "fc_settings.h"
@@ -69,10 +75,50 @@
 #include "fc_wifi.h"
 
 static AudioGeneratorMP3 *mp3;
+static AudioGenerator    *gen;      // mp3 or pcmLoop
+
+#ifdef FC_FLUXCACHE
+#define FLUXCACHE_MAX     (1024*1024) // Max PSRAM for flux loop (bytes)
+#define FLUXCACHE_XFADE   256         // Samples crossfaded at loop point
+#define FLUXCACHE_SILENCE 8           // Trim threshold for codec delay/padding
+static AudioGeneratorPCMLoop *pcmLoop;
+static int16_t  *fluxPCM = NULL;
+static uint32_t fluxPCMLen = 0;
+static int      fluxPCMRate = 0;
+static uint32_t fluxPCMDecMs = 0;
+#endif
 
 static AudioFileSourceFSLoop *myFS0L;
 static AudioFileSourceSDLoop *mySD0L;
 
+#ifdef FC_HOTSOUNDS
+#define HOTSND_MAX    (256*1024)  // Max size of a single sound (bytes)
+#define HOTSND_BUDGET (2048*1024) // Max PSRAM for all sounds
+#define HOTSND_NUM    11          // key1-9, user1-2
+typedef struct {
+    char     name[12];
+    uint8_t  *buf;
+    uint32_t len;
+} hotSnd_t;
+static hotSnd_t hotSnd[HOTSND_NUM];
+static uint32_t hotSndBytes = 0;
+static AudioFileSourceMem *myMem0;
+#endif
+
+#ifdef FC_MIXER
+// Flux loop has its own voice, all other sounds use mp3/gen.
+#define MIX_BUFSIZE 1024    // Mixer ring size (samples, 8 bytes each)
+#define MIX_RATE    44100   // Mixer output rate
+#define MIX_DUCK    0.5f    // Flux gain factor while overlay sound plays
+static AudioOutputMixer      *mixer;
+static AudioOutputMixerStub  *fxOut, *fluxOut;
+static AudioGeneratorMP3     *mp3f;
+static AudioGenerator        *fgen;     // mp3f or pcmLoop
+static AudioFileSourceFSLoop *myFS1L;
+static AudioFileSourceSDLoop *mySD1L;
+static bool                  fxOverlay = false;
+#endif
+
 static AudioOutputI2S *out;
 
 bool audioInitDone = false;
@@ -99,18 +145,39 @@ static const float volTable[VOL_LEVELS] = {
 static const float fluxLevels[4] = {
     0.30f, 0.50f, 0.75f, 1.0f
 };
+// Flux loop decode mode (see FC_FLUX_MONO, FC_FLUX_HALFRATE)
+#ifdef FC_FLUX_MONO
+#define PA_FLUXMONO PA_MONO
+#else
+#define PA_FLUXMONO 0
+#endif
+#ifdef FC_FLUX_HALFRATE
+#define PA_FLUXDEC (PA_FLUXMONO|PA_HALFRT)
+#else
+#define PA_FLUXDEC PA_FLUXMONO
+#endif
+
 // Resolution for pot, 9-12 allowed
 #define POT_RESOLUTION 9
 #define VOL_SMOOTH_SIZE 4
+// Volume (pot) is read at this interval (ms); the output
+// stage ramps the gain (AO_GAINRAMP), so this does not
+// need to be faster. The gain is only recomputed if an
+// input changed (volPoll()).
+#define VOL_UPD_INT     10
 static int      rawVol[VOL_SMOOTH_SIZE];
 static int      rawVolIdx = 0;
 static int      anaReadCount = 0;
 static long     prev_avg, prev_raw, prev_raw2;
+static float    potVol = 0.0f;
 static uint32_t g(uint32_t a, int o) { return a << (PA_MASK - o); }
 
 static float    curVolFact = 1.0f;
 static bool     dynVol     = true;
-static int      sampleCnt = 0;
+static unsigned long lastVolUpd = 0;
+static uint8_t  lastVolSel = 254;
+static bool     lastVolNM;
+static float    lastVolFact, lastVolFlux;
 
 bool            playingFlux = false;
 unsigned int    fluxLvlIdx  = 3;
@@ -133,7 +200,68 @@ static const char *tcdrdone = "/TCD_DONE.TXT";   // leave "TCD", SD is interchan
 unsigned long   renNow1;
 unsigned long   renNow2;
 
-static float    getVolume();
+#ifdef FC_FASTBOOT
+static volatile bool audioPreloadDone = true;
+static int      preMaxMusic = -1;
+static uint8_t  preMusFolder = 0;
+#endif
+
+#ifdef FC_TELEMETRY
+// Trigger latency: IR decode to first DMA write of the key
+// sound started by it. audio_markTrigger() sets trigPend
+// around play_key(); play_file() then arms the measurement.
+#define TRIG_MAXAGE     1000000     // us; not measured if no write by then
+static uint32_t trigPend = 0;
+static uint32_t trigUs = 0;
+static bool     trigArmed = false;
+static uint32_t trigCnt = 0, trigMax = 0;
+static uint64_t trigSum = 0;
+#endif
+
+#ifdef FC_AUDIOTASK
+// Decoder pump task. The generator, output and file sources
+// are owned by audioMutex (recursive); all other audio state
+// is still only touched by the loop task.
+#define AUDIOTASK_INT   4       // ms between pump runs
+#define AUDIOTASK_CORE  1
+#define AUDIOTASK_PRIO  2       // above loop task
+static SemaphoreHandle_t audioMutex = NULL;
+static volatile bool     audioEOF = false;
+class audioLock {
+    public:
+        audioLock() : _held(false) { if(audioMutex) _held = (xSemaphoreTakeRecursive(audioMutex, portMAX_DELAY) == pdTRUE); }
+        ~audioLock() { release(); }
+        void release() { if(_held) { xSemaphoreGiveRecursive(audioMutex); _held = false; } }
+    private:
+        bool _held;
+};
+#define AUDIO_LOCK()   audioLock _audioLock
+#define AUDIO_UNLOCK() _audioLock.release()
+static void     audioTask(void *parm);
+#else
+#define AUDIO_LOCK()
+#define AUDIO_UNLOCK()
+#endif
+
+static bool     volPoll();
+static float    getBaseVolume(bool readPot = true);
+static float    scaleVolume(float vol_val, float volFact);
+#ifdef FC_MIXER
+static void     setMixGains(bool readPot = true);
+#else
+static float    getVolume(bool readPot = true);
+#endif
+
+static void     probeSounds();
+#ifdef FC_FLUXCACHE
+static void     buildFluxCache();
+#endif
+#ifdef FC_HOTSOUNDS
+static void     buildHotBank();
+#endif
+#ifdef FC_FASTBOOT
+static void     audioPreloadTask(void *parm);
+#endif
 
 static int      mp_findMaxNum();
 static bool     mp_checkForFile(int num);
@@ -162,7 +290,21 @@ void audio_setup()
     out->SetOutputModeMono(false); // Hardware does auto-mono
     out->SetPinout(I2S_BCLK_PIN, I2S_LRCLK_PIN, I2S_DIN_PIN);
 
+    #ifdef FC_HOTSOUNDS
+    // Decoder buffers allocated once, not per sound; I2S
+    // driver paused instead of uninstalled between sounds
+    void *mp3Space;
+    if((mp3Space = malloc(AudioGeneratorMP3::preAllocSize()))) {
+        mp3 = new AudioGeneratorMP3(mp3Space, AudioGeneratorMP3::preAllocSize());
+    } else
+    #endif
     mp3  = new AudioGeneratorMP3();
+    gen  = mp3;
+
+    #ifdef FC_HOTSOUNDS
+    out->SetHold(true);
+    myMem0 = new AudioFileSourceMem();
+    #endif
 
     myFS0L = new AudioFileSourceFSLoop();
 
@@ -170,6 +312,23 @@ void audio_setup()
         mySD0L = new AudioFileSourceSDLoop();
     }
 
+    #ifdef FC_MIXER
+    // Voices have their own gain; I2S stays at unity
+    out->SetGain(1.0f);
+    mixer   = new AudioOutputMixer(MIX_BUFSIZE, out, MIX_RATE);
+    fxOut   = mixer->NewInput();
+    fluxOut = mixer->NewInput();
+    
+    mp3f = new AudioGeneratorMP3();
+    fgen = mp3f;
+
+    myFS1L = new AudioFileSourceFSLoop();
+
+    if(haveSD) {
+        mySD1L = new AudioFileSourceSDLoop();
+    }
+    #endif
+
     loadCurVolume();
 
     setFluxLevel(fluxLvlIdx);
@@ -180,6 +339,90 @@ void audio_setup()
     // MusicPlayer init
     // done in main_setup()
 
+    #ifdef FC_FASTBOOT
+    // Sounds probed by audio_preload(); wait for it to finish
+    while(!audioPreloadDone) {
+        delay(1);
+    }
+    #else
+    probeSounds();
+    #endif
+
+    BOOTPROF("audio_probe");
+
+    #ifdef FC_FLUXCACHE
+    buildFluxCache();
+    BOOTPROF("audio_fluxcache");
+    #endif
+
+    #ifdef FC_HOTSOUNDS
+    buildHotBank();
+    BOOTPROF("audio_hotbank");
+    #endif
+
+    #ifdef FC_AUDIOTASK
+    if((audioMutex = xSemaphoreCreateRecursiveMutex())) {
+        if(xTaskCreatePinnedToCore(audioTask, "fcAudio", 8192, NULL, AUDIOTASK_PRIO, NULL, AUDIOTASK_CORE) != pdPASS) {
+            #ifdef FC_DBG
+            Serial.println("audio_setup: Failed to create task");
+            #endif
+            vSemaphoreDelete(audioMutex);
+            audioMutex = NULL;
+        }
+    }
+    #endif
+
+    audioInitDone = true;
+}
+
+#ifdef FC_AUDIOTASK
+/*
+ * Keeps the DMA buffers filled while the loop task is busy
+ * (portal pages, MQTT connects, SD access). End of file is
+ * only flagged; audio_loop() does the rest (next track, 
+ * appended file, MQTT status).
+ *
+ * SD access: This task reads from SD while the loop task (and,
+ * with FC_UPLBUF, the upload writer task) may read or write
+ * other files (settings, uploads, music folder scan). This is
+ * safe because
+ * - FatFS is built reentrant in ESP-IDF (FF_FS_REENTRANT): every
+ *   f_* call holds the volume mutex, so FAT/directory updates
+ *   and our reads never interleave;
+ * - sd_diskio takes the SPI bus lock (AcquireSPI, i.e.
+ *   SPIClass::beginTransaction) for every sector read/write,
+ *   and the sector cache (TW_SD_CACHE) is only accessed with
+ *   it held; writes invalidate cached sectors;
+ * - the File objects used here (gen's source) are only opened,
+ *   closed or seeked by the loop task with audioMutex held
+ *   (AUDIO_LOCK in play_file() etc.).
+ * Not covered: SD.setFrequency() (calibration, in setup before
+ * this task exists) and unmount_fs() (prepareReboot(), after
+ * stopAudio()). Long FAT operations in the loop task (big
+ * writes, sound-pack pre-allocation) stall this task's reads
+ * for their duration; the DMA buffers must bridge that.
+ */
+static void audioTask(void *parm)
+{
+    for(;;) {
+        xSemaphoreTakeRecursive(audioMutex, portMAX_DELAY);
+        if(!audioEOF && gen->isRunning()) {
+            if(!gen->loop()) audioEOF = true;
+        }
+        #ifdef FC_MIXER
+        if(fgen->isRunning() && !fgen->loop()) {
+            fgen->stop();
+        }
+        mixer->loop();
+        #endif
+        xSemaphoreGiveRecursive(audioMutex);
+        vTaskDelay(pdMS_TO_TICKS(AUDIOTASK_INT));
+    }
+}
+#endif
+
+static void probeSounds()
+{
     // Check for keyX sounds to avoid unsuccessful file-lookups every time
     for(int i = 1, bm = 1 << 8; i < 10; i++, bm <<= 1) {
         keySnd[4] = '0' + i;
@@ -188,30 +431,114 @@ void audio_setup()
 
     haveUserSnd[0] = check_file_SD(userSnd[0]);
     haveUserSnd[1] = check_file_SD(userSnd[1]);
+}
 
-    audioInitDone = true;
+#ifdef FC_FASTBOOT
+/*
+ * audio_preload()
+ * 
+ * Called after settings_setup(); probes the SD for key/user 
+ * sounds and indexes the current music folder in a background 
+ * task while wifi_setup() waits for the WiFi connection.
+ * audio_setup() and mp_init() pick up the results.
+ * The music folder is only indexed if it does not need
+ * renaming; the renamer is left to mp_init() as it uses
+ * the LEDs for progress display.
+ */
+void audio_preload()
+{
+    if(!haveSD)
+        return;
+
+    audioPreloadDone = false;
+    
+    if(xTaskCreate(audioPreloadTask, "fcPreload", 6144, (void *)1, 1, NULL) != pdPASS) {
+        #ifdef FC_DBG
+        Serial.println("audio_preload: Failed to create task");
+        #endif
+        audioPreloadTask(NULL);
+    }
 }
 
+static void audioPreloadTask(void *parm)
+{
+    char fnbuf[32];
+
+    probeSounds();
+
+    BOOTPROF("preload_sounds");
+
+    loadMusFoldNum();
+    preMusFolder = musFolderNum;
+
+    sprintf(fnbuf, "/music%1d%s", preMusFolder, tcdrdone);
+    if(SD.exists(fnbuf) && mp_checkForFile(0)) {
+        preMaxMusic = mp_findMaxNum();
+    }
+
+    BOOTPROF("preload_music");
+
+    audioPreloadDone = true;
+
+    if(parm) vTaskDelete(NULL);
+}
+#endif
+
 /*
  * audio_loop()
  *
  */
 void audio_loop()
 {   
-    if(mp3->isRunning()) {
-        if(!mp3->loop()) {
-            mp3->stop();
+    TELEM_SPAN(TELEM_AUDIO);
+    AUDIO_LOCK();
+
+    #ifdef FC_MIXER
+    if(fgen->isRunning()) {
+        if(!fgen->loop()) {
+            fgen->stop();
+        } else if(!gen->isRunning()) {
+            // Flux voice alone: Undo ducking (if overlay
+            // was stopped), follow volume changes
+            fxOverlay = false;
+            if(millis() - lastVolUpd >= VOL_UPD_INT) {
+                if(volPoll()) setMixGains(false);
+                lastVolUpd = millis();
+            }
+        }
+    }
+    #endif
+    
+    if(gen->isRunning()) {
+        #ifdef FC_AUDIOTASK
+        if(audioEOF || !gen->loop()) {
+            audioEOF = false;
+        #else
+        if(!gen->loop()) {
+        #endif
+            gen->stop();
             key_playing = 0;
+            #ifdef FC_MIXER
+            if(fxOverlay) {
+                fxOverlay = false;
+                setMixGains();
+            }
+            #endif
             if(appendFile) {
                 play_file(append_audio_file, append_flags, append_vol);
             } else if(mpActive) {
                 mp_next(true);
             }
         } else if(dynVol) {
-            sampleCnt++;
-            if(sampleCnt > 1) {
-                out->SetGain(getVolume());
-                sampleCnt = 0;
+            if(millis() - lastVolUpd >= VOL_UPD_INT) {
+                if(volPoll()) {
+                    #ifdef FC_MIXER
+                    setMixGains(false);
+                    #else
+                    out->SetGain(getVolume(false));
+                    #endif
+                }
+                lastVolUpd = millis();
             }
         }
     } else if(appendFile) {
@@ -220,6 +547,27 @@ void audio_loop()
         mp_next(true);
     }
 
+    #ifdef FC_MIXER
+    mixer->loop();
+    #endif
+
+    #ifdef FC_TELEMETRY
+    if(trigArmed) {
+        uint32_t w = (uint32_t)out->GetFirstWriteUs();
+        if(w) {
+            w -= trigUs;
+            trigSum += w;
+            trigCnt++;
+            if(w > trigMax) trigMax = w;
+            trigArmed = false;
+        } else if(micros() - trigUs > TRIG_MAXAGE) {
+            trigArmed = false;
+        }
+    }
+    #endif
+
+    AUDIO_UNLOCK();
+
     #ifdef FC_HAVEMQTT
     mp_sendStatus();
     #endif
@@ -242,10 +590,238 @@ static int32_t skipID3(char *buf)
     return 0;
 }
 
-void play_file(const char *audio_file, uint32_t flags, float volumeFactor)
+#ifdef FC_HOTSOUNDS
+/*
+ * Load key and user sounds into PSRAM; they are then played
+ * from there, without SD access (open, ID3 read, seek) when
+ * a key is pressed. ID3 tags are skipped while loading.
+ * Sounds that do not fit are played from SD as usual.
+ * Like haveKeySnd, this reflects the SD at boot.
+ */
+static void buildHotBank()
+{
+    File f;
+    const char *fn;
+    char id3[10];
+    uint32_t s, len;
+    int n = 0;
+
+    if(!haveSD || !psramFound())
+        return;
+
+    for(int i = 0; i < HOTSND_NUM; i++) {
+        if(i < 9) {
+            if(!(haveKeySnd & (1 << (8+i)))) continue;
+            keySnd[4] = '1' + i;
+            fn = keySnd;
+        } else {
+            if(!haveUserSnd[i-9]) continue;
+            fn = userSnd[i-9];
+        }
+        if(!(f = SD.open(fn, FILE_READ))) continue;
+        s = (f.read((uint8_t *)id3, 10) == 10) ? skipID3(id3) : 0;
+        len = (f.size() > s) ? f.size() - s : 0;
+        if(len && len <= HOTSND_MAX && hotSndBytes + len <= HOTSND_BUDGET &&
+           (hotSnd[i].buf = (uint8_t *)ps_malloc(len))) {
+            if(f.seek(s) && f.read(hotSnd[i].buf, len) == len) {
+                strcpy(hotSnd[i].name, fn);
+                hotSnd[i].len = len;
+                hotSndBytes += len;
+                n++;
+            } else {
+                free(hotSnd[i].buf);
+                hotSnd[i].buf = NULL;
+            }
+        }
+        f.close();
+    }
+
+    #ifdef FC_DBG
+    Serial.printf("Hot sound bank: %d sounds, %d bytes\n", n, hotSndBytes);
+    #endif
+}
+
+static hotSnd_t *findHotSnd(const char *audio_file)
+{
+    for(int i = 0; i < HOTSND_NUM; i++) {
+        if(hotSnd[i].buf && !strcmp(hotSnd[i].name, audio_file))
+            return &hotSnd[i];
+    }
+    return NULL;
+}
+#endif
+
+#ifdef FC_FLUXCACHE
+/*
+ * Decode flux.mp3 once into PSRAM; play_file() then
+ * loops the PCM instead of reading and decoding the 
+ * file over and over. Leading/trailing codec delay and
+ * padding is trimmed, and the end is crossfaded into
+ * the start for a seamless loop (which starts playback
+ * at 0 and continues at FLUXCACHE_XFADE after the end).
+ * Without PSRAM, or if the file is too long, flux.mp3
+ * is streamed as usual.
+ */
+static void buildFluxCache()
+{
+    AudioFileSourceLoop   *src;
+    AudioOutputPCMCapture *cap;
+    int16_t  *buf, *t;
+    uint32_t len, s, e, now;
+    char     id3[10];
+    bool     ok = false;
+
+    if(!psramFound())
+        return;
+
+    if(haveSD && mySD0L->open("/flux.mp3")) {
+        src = mySD0L;
+    } else if(haveFS && myFS0L->open("/flux.mp3")) {
+        src = myFS0L;
+    } else
+        return;
+
+    if(!(buf = (int16_t *)ps_malloc(FLUXCACHE_MAX))) {
+        src->close();
+        return;
+    }
+
+    src->setPlayLoop(false);
+    src->read((void *)id3, 10);
+    s = skipID3(id3);
+    src->setStartPos(s);
+    src->seek(s, SEEK_SET);
+
+    cap = new AudioOutputPCMCapture(buf, FLUXCACHE_MAX / sizeof(int16_t));
+
+    mp3->SetDecodeMode(((PA_FLUXDEC & PA_MONO)   ? AudioGeneratorMP3::MODE_MONO : 0) |
+                       ((PA_FLUXDEC & PA_HALFRT) ? AudioGeneratorMP3::MODE_HALFRATE : 0));
+
+    now = millis();
+    if(mp3->begin(src, cap)) {
+        while(mp3->loop() && !cap->isFull()) { }
+        mp3->stop();
+    } else {
+        src->close();
+    }
+    fluxPCMDecMs = millis() - now;
+
+    len = cap->getLength();
+    
+    if(!cap->isFull() && cap->getRate()) {
+        for(s = 0; s < len && abs(buf[s]) <= FLUXCACHE_SILENCE; s++);
+        for(e = len; e > s && abs(buf[e - 1]) <= FLUXCACHE_SILENCE; e--);
+        len = e - s;
+        if(len >= FLUXCACHE_XFADE * 4) {
+            if(s) memmove(buf, buf + s, len * sizeof(int16_t));
+            for(int i = 0; i < FLUXCACHE_XFADE; i++) {
+                int16_t *d = buf + len - FLUXCACHE_XFADE + i;
+                *d = (int16_t)(((int32_t)*d * (FLUXCACHE_XFADE - i) + (int32_t)buf[i] * i) / FLUXCACHE_XFADE);
+            }
+            ok = true;
+        }
+    }
+
+    if(ok) {
+        if((t = (int16_t *)ps_realloc(buf, len * sizeof(int16_t)))) buf = t;
+        fluxPCM = buf;
+        fluxPCMLen = len;
+        fluxPCMRate = cap->getRate();
+        pcmLoop = new AudioGeneratorPCMLoop();
+    } else {
+        free(buf);
+    }
+
+    #ifdef FC_DBG
+    Serial.printf("Flux cache: %s, %d bytes, %dHz, %dms decode\n", 
+        ok ? "enabled" : "failed", fluxPCMLen * sizeof(int16_t), fluxPCMRate, fluxPCMDecMs);
+    #endif
+
+    delete cap;
+}
+#endif
+
+/*
+ * Open audio_file (SD or flash FS, as per flags) and start
+ * decoder "dec" on it, or play the flux loop from the cache.
+ * The generator used is returned in *g.
+ */
+static bool startVoice(const char *audio_file, uint32_t flags, AudioGeneratorMP3 *dec,
+                       AudioFileSourceSDLoop *sdf, AudioFileSourceFSLoop *fsf,
+                       AudioOutput *o, AudioGenerator **g)
 {
     char buf[10];
     int32_t curSeek = 0;
+    #ifdef FC_HOTSOUNDS
+    hotSnd_t *hs;
+    #endif
+
+    dec->SetDecodeMode(((flags & PA_MONO)   ? AudioGeneratorMP3::MODE_MONO : 0) |
+                       ((flags & PA_HALFRT) ? AudioGeneratorMP3::MODE_HALFRATE : 0));
+
+    buf[0] = 0;
+
+    *g = dec;
+
+    #ifdef FC_FLUXCACHE
+    if((flags & (PA_ISFLUX|PA_LOOP)) == (PA_ISFLUX|PA_LOOP) && fluxPCM &&
+       pcmLoop->begin(fluxPCM, fluxPCMLen, FLUXCACHE_XFADE, fluxPCMRate, o)) {
+
+        *g = pcmLoop;
+
+        #ifdef FC_DBG
+        Serial.println("Playing from flux cache");
+        #endif
+    } else
+    #endif
+    #ifdef FC_HOTSOUNDS
+    // Bank only has key and user sounds, which are
+    // always played by mp3 (the only user of myMem0)
+    if((hs = findHotSnd(audio_file)) && myMem0->open(hs->buf, hs->len)) {
+
+        dec->begin(myMem0, o);
+
+        #ifdef FC_DBG
+        Serial.println("Playing from hot sound bank");
+        #endif
+    } else
+    #endif
+    if(haveSD && ((flags & PA_ALLOWSD) || FlashROMode) && sdf->open(audio_file)) {
+        sdf->setPlayLoop(!!(flags & PA_LOOP));
+        sdf->read((void *)buf, 10);
+        curSeek = skipID3(buf);
+        sdf->setStartPos(curSeek);
+        sdf->seek(curSeek, SEEK_SET);
+
+        dec->begin(sdf, o);
+
+        #ifdef FC_DBG
+        Serial.println("Playing from SD");
+        #endif
+    } else if(haveFS && fsf->open(audio_file)) {
+        fsf->setPlayLoop(!!(flags & PA_LOOP));
+        fsf->read((void *)buf, 10);
+        curSeek = skipID3(buf);
+        fsf->setStartPos(curSeek);
+        fsf->seek(curSeek, SEEK_SET);
+        
+        dec->begin(fsf, o);
+
+        #ifdef FC_DBG
+        Serial.println("Playing from flash FS");
+        #endif
+    } else {
+        #ifdef FC_DBG
+        Serial.println("Audio file not found");
+        #endif
+        return false;
+    }
+
+    return true;
+}
+
+void play_file(const char *audio_file, uint32_t flags, float volumeFactor)
+{
     #ifdef FC_HAVEMQTT
     bool mpWasActive = false;
     #endif
@@ -274,57 +850,77 @@ void play_file(const char *audio_file, uint32_t flags, float volumeFactor)
     Serial.printf("Audio: Playing %s (flags %x)\n", audio_file, flags);
     #endif
 
+    AUDIO_LOCK();
+
     // If something is currently on, kill it
-    if(mp3->isRunning()) {
-        mp3->stop();
+    if(gen->isRunning()) {
+        gen->stop();
     }
-
-    curVolFact  = volumeFactor;
-    dynVol      = (flags & PA_DYNVOL) ? true : false;
-    playingFlux = (flags & PA_ISFLUX) ? true : false;
-    key_playing = flags & 0x1ff00;
+    #ifdef FC_AUDIOTASK
+    audioEOF = false;
+    #endif
 
     // Reset vol smoothing
     // (user might have turned the pot while no sound was played)
     rawVolIdx = 0;
     anaReadCount = 0;
-    
-    out->SetGain(getVolume());
 
-    buf[0] = 0;
+    #ifdef FC_TELEMETRY
+    if(trigPend) {
+        trigUs = trigPend;
+        trigPend = 0;
+        out->ArmFirstWrite();
+        trigArmed = true;
+    }
+    #endif
 
-    if(haveSD && ((flags & PA_ALLOWSD) || FlashROMode) && mySD0L->open(audio_file)) {
-        mySD0L->setPlayLoop(!!(flags & PA_LOOP));
-        mySD0L->read((void *)buf, 10);
-        curSeek = skipID3(buf);
-        mySD0L->setStartPos(curSeek);
-        mySD0L->seek(curSeek, SEEK_SET);
+    #ifdef FC_MIXER
 
-        mp3->begin(mySD0L, out);
+    if(flags & PA_ISFLUX) {
+        // Keep flux voice if running, no restart
+        key_playing = 0;
+        fxOverlay = false;
+        setMixGains();
+        if(!fgen->isRunning()) {
+            playingFlux = startVoice(audio_file, flags, mp3f, mySD1L, myFS1L, fluxOut, &fgen);
+        }
+    } else {
+        // Overlay sounds play over the (ducked) flux
+        // loop, all others stop it
+        if(!(flags & PA_OVERLAY) && fgen->isRunning()) {
+            fgen->stop();
+            playingFlux = false;
+        }
+        curVolFact  = volumeFactor;
+        dynVol      = (flags & PA_DYNVOL) ? true : false;
+        key_playing = flags & 0x1ff00;
+        fxOverlay   = (flags & PA_OVERLAY) ? true : false;
+        setMixGains();
+        if(!startVoice(audio_file, flags, mp3, mySD0L, myFS0L, fxOut, &gen)) {
+            key_playing = 0;
+            fxOverlay = false;
+            setMixGains();
+        }
+    }
+    
+    #else
 
-        #ifdef FC_DBG
-        Serial.println("Playing from SD");
-        #endif
-    } else if(haveFS && myFS0L->open(audio_file)) {
-        myFS0L->setPlayLoop(!!(flags & PA_LOOP));
-        myFS0L->read((void *)buf, 10);
-        curSeek = skipID3(buf);
-        myFS0L->setStartPos(curSeek);
-        myFS0L->seek(curSeek, SEEK_SET);
-        
-        mp3->begin(myFS0L, out);
+    curVolFact  = volumeFactor;
+    dynVol      = (flags & PA_DYNVOL) ? true : false;
+    playingFlux = (flags & PA_ISFLUX) ? true : false;
+    key_playing = flags & 0x1ff00;
+    
+    out->SetGain(getVolume());
 
-        #ifdef FC_DBG
-        Serial.println("Playing from flash FS");
-        #endif
-    } else {
+    if(!startVoice(audio_file, flags, mp3, mySD0L, myFS0L, out, &gen)) {
         playingFlux = false;
         key_playing = 0;
-        #ifdef FC_DBG
-        Serial.println("Audio file not found");
-        #endif
     }
 
+    #endif
+
+    AUDIO_UNLOCK();
+
     #ifdef FC_HAVEMQTT
     if(mpWasActive) mp_sendStatus();
     #endif
@@ -337,12 +933,12 @@ void play_file(const char *audio_file, uint32_t flags, float volumeFactor)
 
 void play_flux()
 {
-    play_file("/flux.mp3", PA_ISFLUX|PA_LOOP|PA_INTRMUS|PA_ALLOWSD|PA_DYNVOL, fluxLevel);
+    play_file("/flux.mp3", PA_ISFLUX|PA_LOOP|PA_INTRMUS|PA_ALLOWSD|PA_DYNVOL|PA_FLUXDEC, fluxLevel);
 }
 
 void append_flux() 
 {
-    append_file("/flux.mp3", PA_ISFLUX|PA_LOOP|PA_INTRMUS|PA_ALLOWSD|PA_DYNVOL, fluxLevel);
+    append_file("/flux.mp3", PA_ISFLUX|PA_LOOP|PA_INTRMUS|PA_ALLOWSD|PA_DYNVOL|PA_FLUXDEC, fluxLevel);
 }
 
 bool play_key(int k, bool stopOnly)
@@ -351,8 +947,10 @@ bool play_key(int k, bool stopOnly)
     
     if(!(haveKeySnd & pa_key)) return false;    
 
+    AUDIO_LOCK();
+
     if(pa_key == key_playing) {
-        mp3->stop();
+        gen->stop();
         key_playing = 0;
         return true;
     }
@@ -362,7 +960,7 @@ bool play_key(int k, bool stopOnly)
 
     keySnd[4] = '0' + k;
     
-    play_file(keySnd, pa_key|PA_INTRMUS|PA_ALLOWSD|PA_DYNVOL);
+    play_file(keySnd, pa_key|PA_INTRMUS|PA_ALLOWSD|PA_DYNVOL|PA_OVERLAY);
 
     return true;
 }
@@ -429,11 +1027,12 @@ bool dec_vol()
     return true;
 }
 
-// Returns value for volume based on the position of the pot
-// Since the values vary we do some noise reduction
-static float getRawVolume()
+// Reads the volume pot into potVol; returns true if that
+// changed. Since the values vary we do some noise reduction
+static bool readPotVolume()
 {
     float vol_val;
+    bool  changed;
     long avg = 0, avg1 = 0, avg2 = 0;
     long raw;
 
@@ -494,23 +1093,52 @@ static float getRawVolume()
 
     //Serial.println(vol_val);
 
-    return vol_val;
+    changed = (vol_val != potVol);
+    potVol = vol_val;
+
+    return changed;
 }
 
-static float getVolume()
+// Called every VOL_UPD_INT while playing: Returns false if
+// neither the pot nor any other input to the gain changed
+// since the last call, ie the gain is still current.
+static bool volPoll()
 {
-    float vol_val;
+    bool changed = false;
 
     if(aud_state.curVolume == 255) {
-        vol_val = getRawVolume();
-    } else {
-        vol_val = volTable[aud_state.curVolume];
+        changed = readPotVolume();
+    }
+
+    if(aud_state.curVolume != lastVolSel || fluxNM != lastVolNM ||
+       curVolFact != lastVolFact || fluxLevel != lastVolFlux) {
+        lastVolSel = aud_state.curVolume;
+        lastVolNM = fluxNM;
+        lastVolFact = curVolFact;
+        lastVolFlux = fluxLevel;
+        changed = true;
     }
 
+    return changed;
+}
+
+// readPot: false if the pot was just read (volPoll())
+static float getBaseVolume(bool readPot)
+{
+    if(aud_state.curVolume == 255) {
+        if(readPot) readPotVolume();
+        return potVol;
+    }
+    
+    return volTable[aud_state.curVolume];
+}
+
+static float scaleVolume(float vol_val, float volFact)
+{
     // If user muted, return 0
     if(vol_val == 0.0f) return vol_val;
 
-    vol_val *= curVolFact;
+    vol_val *= volFact;
 
     if(fluxNM) vol_val *= 0.3f;
       
@@ -521,12 +1149,36 @@ static float getVolume()
     return vol_val;
 }
 
+#ifndef FC_MIXER
+static float getVolume(bool readPot)
+{
+    return scaleVolume(getBaseVolume(readPot), curVolFact);
+}
+#else
+/*
+ * Set voice gains: The flux voice uses the flux level,
+ * and is ducked while an overlay sound plays.
+ */
+static void setMixGains(bool readPot)
+{
+    float vol = getBaseVolume(readPot);
+    float fvol = scaleVolume(vol, fluxLevel);
+
+    if(fxOverlay) fvol *= MIX_DUCK;
+    
+    fxOut->SetGain(scaleVolume(vol, curVolFact));
+    fluxOut->SetGain(fvol);
+}
+#endif
+
 void setFluxLevel(unsigned int levelIdx)
 {
     if(levelIdx > 3) levelIdx = 3;
     fluxLvlIdx = levelIdx;
     fluxLevel = fluxLevels[levelIdx];
+    #ifndef FC_MIXER
     if(playingFlux) curVolFact = fluxLevel;
+    #endif
 }
 
 /*
@@ -540,21 +1192,37 @@ bool check_file_SD(const char *audio_file)
 
 bool checkAudioDone()
 {
-    if(mp3->isRunning()) return false;
+    AUDIO_LOCK();
+    
+    if(gen->isRunning()) return false;
+    #ifdef FC_MIXER
+    if(fgen->isRunning()) return false;
+    #endif
     return true;
 }
 
+// With FC_MIXER, this ignores the flux voice
 bool checkMP3Running()
 {
-    if(mp3->isRunning()) return true;
+    AUDIO_LOCK();
+    
+    if(gen->isRunning()) return true;
     return false;
 }
 
 void stopAudio()
 {
-    if(mp3->isRunning()) {
-        mp3->stop();
+    AUDIO_LOCK();
+    
+    if(gen->isRunning()) {
+        gen->stop();
+    }
+    #ifdef FC_MIXER
+    if(fgen->isRunning()) {
+        fgen->stop();
     }
+    fxOverlay = false;
+    #endif
     appendFile = false;   // Clear appended, stop means stop.
     playingFlux = false;
     key_playing = 0;
@@ -562,8 +1230,10 @@ void stopAudio()
 
 bool stop_key()
 {
+    AUDIO_LOCK();
+    
     if(key_playing) {
-        mp3->stop();
+        gen->stop();
         key_playing = 0;
         return true;
     }
@@ -598,6 +1268,11 @@ void mp_init(bool isSetup)
         if(SD.exists(fnbuf)) {
             haveMusic = true;
 
+            #ifdef FC_FASTBOOT
+            if(isSetup && preMaxMusic >= 0 && preMusFolder == musFolderNum) {
+                aud_state.maxMusic = preMaxMusic;
+            } else
+            #endif
             aud_state.maxMusic = mp_findMaxNum();
             #ifdef FC_DBG
             Serial.printf("MusicPlayer: last file num %d\n", aud_state.maxMusic);
@@ -628,6 +1303,10 @@ void mp_init(bool isSetup)
         }
     }
 
+    #ifdef FC_FASTBOOT
+    preMaxMusic = -1;
+    #endif
+
     #ifdef FC_HAVEMQTT
     mp_sendStatus();
     #endif
@@ -723,7 +1402,9 @@ bool mp_stop(bool forceStatus)
     bool ret = mpActive;
     
     if(mpActive) {
-        mp3->stop();
+        AUDIO_LOCK();
+        gen->stop();
+        AUDIO_UNLOCK();
         mpActive = false;
         #ifdef FC_HAVEMQTT
         mp_sendStatus();
@@ -831,6 +1512,95 @@ void mp_sendStatus(int force)
 }
 #endif
 
+#ifdef FC_TELEMETRY
+uint32_t audio_getUnderruns()
+{
+    #ifdef AO_UNDERRUNS
+    if(out) return out->GetUnderruns();
+    #endif
+    return 0;
+}
+
+// millis() of last underrun; 0 if none so far
+uint32_t audio_getLastUnderrun()
+{
+    #ifdef AO_UNDERRUNS
+    if(out) return out->GetLastUnderrun();
+    #endif
+    return 0;
+}
+
+// Current DMA ring size (changes with AO_ADAPTIVEDMA)
+int audio_getDMABufs()
+{
+    return out ? out->GetDMABufCount() : 0;
+}
+
+// us: micros() at IR decode; the next play_file() is measured
+// against it. 0 cancels if no sound was started.
+void audio_markTrigger(uint32_t us)
+{
+    trigPend = us;
+}
+
+// MP3 decoder stage cycle counts (libmad MAD_PROFILE), flux cache
+// stats, mixer cycles (AO_MIXPROF), hot sound bank and trigger 
+// latency, Prometheus text format; returns length, or -1 if buf 
+// too small
+int audio_formatDecodeProfile(char *buf, int size)
+{
+    int l = 0, r;
+    #ifdef MAD_PROFILE
+    
+    for(int i = 0; i < MAD_PROF_NUM; i++) {
+        r = snprintf(buf + l, size - l, 
+                "fc_mp3_cycles_total{stage=\"%s\"} %llu\nfc_mp3_calls_total{stage=\"%s\"} %lu\n",
+                mad_prof_names[i], (unsigned long long)mad_prof[i].cycles,
+                mad_prof_names[i], (unsigned long)mad_prof[i].calls);
+        if(r < 0 || r >= size - l) return -1;
+        l += r;
+    }
+    #endif
+    #ifdef FC_FLUXCACHE
+    // Decode time per loop pass is what streaming would cost
+    r = snprintf(buf + l, size - l, 
+            "fc_fluxcache_bytes %lu\nfc_fluxcache_loop_ms %lu\n"
+            "fc_fluxcache_decode_ms %lu\nfc_fluxcache_active %d\n",
+            (unsigned long)(fluxPCMLen * sizeof(int16_t)),
+            fluxPCMRate ? (unsigned long)((uint64_t)fluxPCMLen * 1000 / fluxPCMRate) : 0UL,
+            (unsigned long)fluxPCMDecMs,
+            #ifdef FC_MIXER
+            (fluxPCM && fgen == pcmLoop && fgen->isRunning()) ? 1 : 0);
+            #else
+            (fluxPCM && gen == pcmLoop && gen->isRunning()) ? 1 : 0);
+            #endif
+    if(r < 0 || r >= size - l) return -1;
+    l += r;
+    #endif
+    #if defined(FC_MIXER) && defined(AO_MIXPROF)
+    r = snprintf(buf + l, size - l, 
+            "fc_mixer_frames_total %lu\nfc_mixer_cycles_total %llu\n",
+            (unsigned long)mixer->GetMixedFrames(),
+            (unsigned long long)mixer->GetMixCycles());
+    if(r < 0 || r >= size - l) return -1;
+    l += r;
+    #endif
+    #ifdef FC_HOTSOUNDS
+    r = snprintf(buf + l, size - l, "fc_hotsnd_bytes %lu\n", (unsigned long)hotSndBytes);
+    if(r < 0 || r >= size - l) return -1;
+    l += r;
+    #endif
+    r = snprintf(buf + l, size - l, 
+            "# TYPE fc_audio_trigger_latency_us summary\n"
+            "fc_audio_trigger_latency_us_sum %llu\nfc_audio_trigger_latency_us_count %lu\n"
+            "fc_audio_trigger_latency_max_us %lu\n",
+            (unsigned long long)trigSum, (unsigned long)trigCnt, (unsigned long)trigMax);
+    if(r < 0 || r >= size - l) return -1;
+    l += r;
+    return l;
+}
+#endif
+
 static void mp_buildFileName(char *fnbuf, int num)
 {
     sprintf(fnbuf, "/music%1d/%03d.mp3", musFolderNum, num);
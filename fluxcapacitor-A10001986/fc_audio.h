@@ -67,11 +67,24 @@
 #define PA_DYNVOL  0x0008
 #define PA_ISFLUX  0x0010
 #define PA_MUSIC   0x0020
-// upper 8 bits all taken
+#define PA_MONO    0x0040   // Decode one (downmixed) channel only
+#define PA_HALFRT  0x0080   // Decode at half sample rate
+// 0x100-0x10000 taken (keys)
+#define PA_OVERLAY 0x20000  // FC_MIXER: Play over (ducked) flux loop
 #define PA_MASK    (PA_LOOP|PA_INTRMUS|PA_ALLOWSD|PA_DYNVOL|PA_ISFLUX)
 
 void audio_setup();
 void audio_loop();
+#ifdef FC_FASTBOOT
+void audio_preload();
+#endif
+#ifdef FC_TELEMETRY
+uint32_t audio_getUnderruns();
+uint32_t audio_getLastUnderrun();
+int      audio_getDMABufs();
+void     audio_markTrigger(uint32_t us);
+int      audio_formatDecodeProfile(char *buf, int size);
+#endif
 
 void play_file(const char *audio_file, uint32_t flags, float volumeFactor = 1.0f);
 void append_file(const char *audio_file, uint32_t flags, float volumeFactor = 1.0f);
@@ -0,0 +1,141 @@
+/*
+ * -------------------------------------------------------------------
+ * CircuitSetup.us Flux Capacitor
+ * (C) 2023-2026 Thomas Winischhofer (A10001986)
+ * https://github.com/realA10001986/Flux-Capacitor
+ * https://fc.out-a-ti.me
+ *
+ * Event queues
+ *
+ * -------------------------------------------------------------------
+ * License: Modified MIT NON-AI
+ * 
+ * Permission is hereby granted, free of charge, to any person 
+ * obtaining a copy of this software and associated documentation 
+ * files (the "Software"), to deal in the Software without restriction, 
+ * including without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to 
+ * do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ * 
+ * Links inside the Software pointing to the original source must not 
+ * be changed or removed.
+ *
+ * In addition, the following restrictions apply:
+ * 
+ * 1. The Software and any modifications made to it may not be used 
+ * for the purpose of training or improving machine learning algorithms, 
+ * including but not limited to artificial intelligence, natural 
+ * language processing, or data mining. This condition applies to any 
+ * derivatives, modifications, or updates based on the Software code. 
+ * Any usage of the Software in an AI-training dataset is considered a 
+ * breach of this License.
+ *
+ * 2. The Software may not be included in any dataset used for 
+ * training or improving machine learning algorithms, including but 
+ * not limited to artificial intelligence, natural language processing, 
+ * or data mining.
+ *
+ * 3. Any person or organization found to be in violation of these 
+ * restrictions will be subject to legal action and may be held liable 
+ * for any damages resulting from such use.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _FC_EVQUEUE_H
+#define _FC_EVQUEUE_H
+
+#include <Arduino.h>
+
+/*
+ * Bounded multi-producer/single-consumer queues with a 
+ * sequence number per cell; producers claim a cell by CAS
+ * on the tail, the consumer (main_loop) needs no atomic
+ * RMW. A full queue drops the new event and counts it 
+ * instead of overwriting unread ones.
+ * Header-only so that it can be tested on the host
+ * (tests/host/evq).
+ */
+
+#define FCEV_QSIZE 16           // power of 2
+
+typedef struct {
+    uint32_t seq;
+    uint8_t  type;
+    uint32_t arg;
+    uint32_t stamp;             // micros() when posted
+} fcEvCell;
+
+typedef struct {
+    fcEvCell cell[FCEV_QSIZE];
+    uint32_t tail;              // producers
+    uint32_t overflows;         // producers
+    uint32_t head;              // consumer only
+    uint32_t maxLatency;        // consumer only, us
+} fcEvQueue;
+
+static inline void evInit(fcEvQueue *q)
+{
+    memset((void *)q, 0, sizeof(*q));
+    for(int i = 0; i < FCEV_QSIZE; i++) {
+        q->cell[i].seq = i;
+    }
+}
+
+static inline bool evPush(fcEvQueue *q, uint8_t type, uint32_t arg)
+{
+    uint32_t pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+
+    for(;;) {
+        fcEvCell *c = &q->cell[pos & (FCEV_QSIZE - 1)];
+        int32_t dif = (int32_t)(__atomic_load_n(&c->seq, __ATOMIC_ACQUIRE) - pos);
+        if(!dif) {
+            if(__atomic_compare_exchange_n(&q->tail, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                c->type = type;
+                c->arg = arg;
+                c->stamp = micros();
+                __atomic_store_n(&c->seq, pos + 1, __ATOMIC_RELEASE);
+                return true;
+            }
+            // pos updated by failed CAS; retry
+        } else if(dif < 0) {
+            __atomic_fetch_add(&q->overflows, 1, __ATOMIC_RELAXED);
+            return false;
+        } else {
+            pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+// lat (optional): time the event spent in the queue (us)
+static inline bool evPop(fcEvQueue *q, uint8_t& type, uint32_t& arg, uint32_t *lat = NULL)
+{
+    fcEvCell *c = &q->cell[q->head & (FCEV_QSIZE - 1)];
+    uint32_t l;
+
+    if(__atomic_load_n(&c->seq, __ATOMIC_ACQUIRE) != q->head + 1)
+        return false;
+
+    type = c->type;
+    arg = c->arg;
+    l = micros() - c->stamp;
+    __atomic_store_n(&c->seq, q->head + FCEV_QSIZE, __ATOMIC_RELEASE);
+    q->head++;
+
+    if(l > q->maxLatency) q->maxLatency = l;
+    if(lat) *lat = l;
+
+    return true;
+}
+
+#endif
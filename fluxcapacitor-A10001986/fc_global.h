@@ -35,12 +35,78 @@
 // Comment for all later versions
 //#define BOARD_1_2
 
+// Uncomment to probe for sound files and index the music folder in a
+// background task while WiFi is being connected during boot
+//#define FC_FASTBOOT
+
+// Uncomment to calibrate the SD clock once per card (highest clock
+// that reads without CRC errors)
+//#define FC_SDCAL
+
+// Uncomment to keep binary snapshots of the parsed config and IR key
+// files; JSON is then only parsed if the file has changed
+//#define FC_CFGCACHE
+
+// Uncomment to write uploaded files through a double-buffered writer
+// task (and to pre-allocate the sound-pack) instead of directly.
+// Not yet verified on hardware; off by default.
+//#define FC_UPLBUF
+
+// Uncomment to run the MP3 decoder in its own task (pinned to core 1,
+// above the loop task), so that audio keeps playing while the loop
+// task is blocked in network or SD operations
+//#define FC_AUDIOTASK
+
+// Uncomment to decode the flux sound loop as one (downmixed) channel.
+// The flux loop is played mono anyway (hardware auto-mono); this
+// saves CPU, but the result differs slightly from the regular stereo
+// decode. Not yet verified on hardware.
+//#define FC_FLUX_MONO
+
+// Uncomment to decode the flux sound loop at half sample rate (22.05kHz
+// for 44.1kHz files). Saves CPU at the cost of high frequencies.
+//#define FC_FLUX_HALFRATE
+
+// Uncomment to decode the flux sound once into PSRAM at boot and play
+// it from there (no file reads or MP3 decoding while the flux sound
+// loops). Ignored if there is no PSRAM or the sound is too long (1MB of
+// PCM, ~12s at 44.1kHz mono); FC_FLUX_HALFRATE halves memory usage.
+//#define FC_FLUXCACHE
+
+// Uncomment to mix the flux sound loop and other sounds in software.
+// Key sounds, volume beeps and *85 then play over the (ducked) flux
+// loop instead of interrupting and restarting it. Costs a second MP3
+// decoder (~25KB heap while both play).
+//#define FC_MIXER
+
+// Uncomment to keep key and user sounds (key1-9, user1/2) in PSRAM,
+// and the MP3 decoder's buffers and the I2S driver allocated between
+// sounds; shortens the delay between key press and sound. Sounds are
+// loaded at boot (max 256KB each, 2MB total); without PSRAM, only 
+// the decoder and I2S part applies (~25KB heap, permanently).
+//#define FC_HOTSOUNDS
+
+// Uncomment to shorten the lead of BTTFN-triggered time travels by the
+// estimated network delay (half the fastest recent BTTFN round trip)
+// plus the time until the sequence starts. Round trips include loop
+// latency on both ends, so this is an estimate; not yet verified
+// against the TCD.
+//#define FC_BTTFN_TTCOMP
+
+// Uncomment to collect runtime telemetry (loop timing, time spent in
+// audio/wifi/BTTFN loops, audio underruns, ISR load, heap). Served as
+// text at /metrics; if FC_TELEMETRY_MQTT is defined, also published to
+// bttf/fc/telemetry every FC_TELEMETRY_MQTT seconds.
+//#define FC_TELEMETRY
+//#define FC_TELEMETRY_MQTT 60
+
 /*************************************************************************
  ***                               Debug                               ***
  *************************************************************************/
 
 //#define FC_DBG              // Generic except below
 //#define FC_DBG_NET          // Prop network related
+//#define FC_BOOTPROF         // Print boot phase timing
 
 /*************************************************************************
  ***                  esp32-arduino version detection                  ***
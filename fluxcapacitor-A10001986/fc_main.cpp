@@ -56,10 +56,13 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
+#include <esp_heap_caps.h>
 #include "fcdisplay.h"
 #include "input.h"
 
 #include "fc_main.h"
+#include "fc_evqueue.h"
+#include "fc_sched.h"
 #include "fc_settings.h"
 #include "fc_audio.h"
 #include "fc_wifi.h"
@@ -128,18 +131,22 @@ static bool isTTKeyHeld = false;
 
 bool showUpdAvail = true;
 
-bool networkTimeTravel = false;
-bool networkTCDTT      = false;
-bool networkReentry    = false;
-bool networkAbort      = false;
-bool networkAlarm      = false;
-uint16_t networkLead   = ETTO_LEAD;
-uint16_t networkP1     = 6600;
+// Network (BTTFN/MQTT) TT state; set from events in main_loop()
+static bool networkTimeTravel = false;
+static bool networkTCDTT      = false;
+static bool networkReentry    = false;
+static bool networkAbort      = false;
+static bool networkAlarm = false;
+static uint16_t networkLead   = ETTO_LEAD;
+static uint16_t networkP1     = 6600;
+// Est. TCD send time of pending BTTFN TT (millis), 0 if unknown
+// (MQTT). Reset wherever networkTimeTravel is set or dropped.
+static unsigned long networkTTRef = 0;
 
 static bool tcdIsBusy  = false;
 bool        fcBusy     = false;
 
-int  networkUserSignal = 0;
+static int  networkUserSignal = 0;
 
 static bool useGPSS     = false;
 static bool usingGPSS   = false;
@@ -156,8 +163,8 @@ static bool tcdFPO = false;
 
 static bool bttfnTT = true;
 
-bool doPrepareTT = false;
-bool doWakeup = false;
+static bool doPrepareTT = false;
+static bool doWakeup = false;
 
 static bool skipttblanim = false;
 
@@ -276,6 +283,9 @@ bool                 irShowCmdFBDisplay = true;
 
 bool                 irLocked = false;
 static bool          noIR = false;      // for temporary disabling IR reception
+#ifdef FC_TELEMETRY
+static uint32_t      irKeyUs = 0;       // decode time of IR key being handled
+#endif
 
 bool                 IRLearning = false;
 static uint32_t      backupIRcodes[NUM_IR_KEYS];
@@ -364,6 +374,15 @@ static bool          BTTFNWiFiUp = false;
 static uint8_t       BTTFNfailCount = 0;
 static uint32_t      BTTFUDPID = 0;
 static unsigned long lastBTTFNpacket = 0;
+// Round-trip statistics for TT start compensation
+#define BTTFN_RTT_SAMPLES 8
+static uint32_t      bttfnRqMicros = 0;
+static uint32_t      bttfnRTT[BTTFN_RTT_SAMPLES];
+static int           bttfnRTTidx = 0;
+static int           bttfnRTTnum = 0;
+static uint32_t      bttfnOWD = 0;        // est. one-way delay (us)
+static uint32_t      bttfnSyncErr = 0;    // est. error of bttfnOWD (us)
+static uint16_t      bttfnLastTTComp = 0; // ms of lead consumed before TT() started
 static unsigned long lastBTTFNKA = 0;
 static unsigned long bttfnLastNotData = 0;
 static bool          BTTFNBootTO = false;
@@ -390,9 +409,9 @@ enum {
     BTTFN_KP_KS_HOLD,
 };
 
-static int      iCmdIdx = 0;
-static int      oCmdIdx = 0;
-static uint32_t commandQueue[16] = { 0 };
+// Event queues (see fcPostEvent(), fc_evqueue.h)
+static fcEvQueue evQueue;       // notifications, drained every iteration
+static fcEvQueue cmdQueue;      // commands, consumed when FC is ready
 
 #ifdef ESP32
 /*  "warning: taking address of packed member of 'struct <anonymous>' may 
@@ -435,7 +454,7 @@ static void endIRfeedback();
 static uint16_t getRawSpeed();
 static void     setPotSpeed();
 
-static void timeTravel(bool TCDtriggered, uint16_t P0Dur, uint16_t P1Dur = 0);
+static void timeTravel(bool TCDtriggered, uint16_t P0Dur, uint16_t P1Dur = 0, unsigned long ref = 0);
 static int convertGPSSpeed(int16_t spd);
 
 static void ttkeyScan();
@@ -456,14 +475,25 @@ static void play_volchg();
 static void volWasChanged(bool actualVol = true);
 static void waitAudioDone(bool withIR);
 
+static void fpoStartupJob(schedJob *job);
+static void sayIPJob(schedJob *job);
+
 static bool bttfn_connected();
 static bool bttfn_trigger_tt();
 static bool bttfn_send_command(uint8_t cmd, uint8_t p1, uint8_t p2);
 static void bttfn_setup();
 static void bttfn_loop_quick();
 
+
 void main_boot()
 {
+    evInit(&evQueue);
+    evInit(&cmdQueue);
+
+    #ifdef FC_TELEMETRY
+    telemSetup();
+    #endif
+    
     // Boot center LED here (is for some reason on after reset)
     #ifdef FC_DBG
     Serial.println("Booting Center LED");
@@ -596,6 +626,8 @@ void main_setup()
     // Init music player (don't check for SD here)
     switchMusicFolder(musFolderNum, true);
 
+    BOOTPROF("mp_init");
+
     #ifdef FC_DBG
     Serial.println("Booting IR Receiver");
     #endif
@@ -671,6 +703,17 @@ void main_setup()
 
 void main_loop()
 {
+    #ifdef FC_TELEMETRY
+    telemLoop();
+    #endif
+    TELEM_SPAN(TELEM_MAIN);
+
+    sched_loop();
+
+    // Hold input and commands while a modal job runs
+    if(schedModal())
+        return;
+    
     unsigned long now = millis();
 
     // Reset polling interval; will be overruled below if applicable
@@ -714,34 +757,11 @@ void main_loop()
         } else {
             // Power on: 
             FPBUnitIsOn = true;
-            
-            fcLEDs.on();
-            boxLED.setDC(mbllArray[minBLL]);
 
-            // Play startup
-            play_file("/startup.mp3", PA_INTRMUS|PA_ALLOWSD, 1.0f);
-            if(playFLUX) {
-                append_flux();
-            }
-            fcLEDs.SpecialSignal(FCSEQ_STARTUP);
-            fcLEDs.stop(false);
-            while(!fcLEDs.SpecialDone()) {
-                 mydelay(20, false);
-            }
-
-            TTKey.reset();
-            isTTKeyHeld = isTTKeyPressed = false;
-            networkTimeTravel = false;
-
-            ssRestartTimer();
-            ssActive = false;
-
-            #ifdef FC_HAVEMQTT
-            mp_sendStatus();
-            #endif
-
-            ir_remote.loop();
- 
+            // Startup sequence; rest of main_loop() 
+            // resumes after it is finished.
+            schedStart(fpoStartupJob, true);
+            return;
         }
     }
     
@@ -750,7 +770,60 @@ void main_loop()
         clearInpBuf();
     }
 
-    // Eval flags set in handle_tcd_notification
+    // Eval events posted by MQTT/BTTFN
+    {
+        uint8_t  type;
+        uint32_t arg, lat;
+        while(evPop(&evQueue, type, arg, &lat)) {
+            switch(type) {
+            case FCEV_PREPARE_TT:
+                doPrepareTT = true;
+                break;
+            case FCEV_WAKEUP:
+                doWakeup = true;
+                break;
+            case FCEV_ALARM:
+                networkAlarm = true;
+                break;
+            case FCEV_USERSIG:
+                networkUserSignal = arg;
+                break;
+            case FCEV_NET_TT:
+            case FCEV_BTTFN_TT:
+                // Trigger Time Travel (if not running already)
+                // Ignore command if TCD is connected by wire
+                if(!TCDconnected && !TTrunning && !IRLearning && !fcBusy) {
+                    networkTimeTravel = true;
+                    networkTCDTT = true;
+                    networkReentry = false;
+                    networkAbort = false;
+                    networkLead = arg & 0xffff;
+                    networkP1 = arg >> 16;
+                    networkTTRef = 0;
+                    #ifdef FC_BTTFN_TTCOMP
+                    // Posted when parsed, not when received; time the
+                    // packet waited for bttfn_loop() is not compensated
+                    if(type == FCEV_BTTFN_TT) {
+                        networkTTRef = millisNonZero() - (lat + bttfnOWD + 500) / 1000;
+                    }
+                    #endif
+                }
+                break;
+            case FCEV_NET_REENTRY:
+                // Start re-entry (if TT currently running)
+                if(!TCDconnected && (TTrunning || (arg && networkTimeTravel)) && networkTCDTT) {
+                    networkReentry = true;
+                }
+                break;
+            case FCEV_NET_ABORT:
+                // Abort TT (if TT currently running)
+                if(!TCDconnected && (TTrunning || (arg && networkTimeTravel)) && networkTCDTT) {
+                    networkAbort = true;
+                }
+                break;
+            }
+        }
+    }
     if(doPrepareTT) {
         if(FPBUnitIsOn && !IRLearning && !TTrunning) {
             prepareTT();
@@ -909,12 +982,14 @@ void main_loop()
             networkTimeTravel = false;
             if(!networkAbort) {
                 ssEnd(false);  // let TT() take care of restarting sound
-                timeTravel(networkTCDTT, networkLead, networkP1);
+                timeTravel(networkTCDTT, networkLead, networkP1, networkTTRef);
             }
+            networkTTRef = 0;
         }
     } else {
         isTTKeyHeld = isTTKeyPressed = false;
         TTKey.reset();
+        networkTTRef = 0;
     }
 
     now = millis();
@@ -1391,7 +1466,7 @@ void flushDelayedSave()
  * Time travel
  */
 
-static void timeTravel(bool TCDtriggered, uint16_t P0Dur, uint16_t P1Dur)
+static void timeTravel(bool TCDtriggered, uint16_t P0Dur, uint16_t P1Dur, unsigned long ref)
 {
     int i = 0, tspd;
     
@@ -1451,6 +1526,16 @@ static void timeTravel(bool TCDtriggered, uint16_t P0Dur, uint16_t P1Dur)
     
     if(TCDtriggered) {    // TCD-triggered TT (GPIO, BTTFN, MQTT-pub) (synced with TCD)
         extTT = true;
+        // If we have an estimate of when the TCD sent the BTTFN
+        // notification, the lead counts from there. This covers
+        // network delay and our delay after parsing the packet,
+        // not the time it waited in the UDP buffer.
+        if(ref) {
+            unsigned long elapsed = TTstart - ref;
+            if(elapsed > P0Dur) elapsed = P0Dur;
+            bttfnLastTTComp = elapsed;
+            P0Dur -= elapsed;
+        }
         P0duration = P0Dur;
         #ifdef FC_DBG
         Serial.printf("P0 duration is %d, steps %d\n", P0duration, i);
@@ -1555,6 +1640,9 @@ static void handleIRinput()
     uint32_t myHash = ir_remote.readHash();
     uint16_t i, j;
     bool done = false;
+    #ifdef FC_TELEMETRY
+    uint32_t decUs = micros();
+    #endif
     
     Serial.printf("handleIRinput: Received IR code 0x%x\n", myHash);
 
@@ -1591,7 +1679,13 @@ static void handleIRinput()
                 #ifdef FC_DBG
                 Serial.printf("handleIRinput: key %d\n", i);
                 #endif
+                #ifdef FC_TELEMETRY
+                irKeyUs = decUs;
+                #endif
                 handleIRKey(i);
+                #ifdef FC_TELEMETRY
+                irKeyUs = 0;
+                #endif
                 done = true;
                 break;
             }
@@ -1623,11 +1717,19 @@ static uint8_t read2digs(uint8_t idx)
 void doKeySound(int key)
 {   
     if(!TTrunning || !playTTsounds) {
+        #ifdef FC_TELEMETRY
+        // Measure IR key to sound latency (only if the
+        // key sound is actually started by play_key())
+        audio_markTrigger(irKeyUs);
+        #endif
         if(play_key(key)) {
             if(contFlux()) {
                 append_flux();
             }
         }
+        #ifdef FC_TELEMETRY
+        audio_markTrigger(0);
+        #endif
     }
 }
 
@@ -1893,17 +1995,14 @@ static void handleIRKey(int key)
 
 static void handleRemoteCommand()
 {
-    uint32_t command = commandQueue[oCmdIdx];
+    uint32_t command;
+    uint8_t  type;
     int      doInpReaction = 0;
     bool     injected = false;
 
-    if(!command)
+    if(!evPop(&cmdQueue, type, command))
         return;
 
-    commandQueue[oCmdIdx] = 0;
-    oCmdIdx++;
-    oCmdIdx &= 0x0f;
-
     if(command & 0x80000000) {
         injected = true;
         command &= ~0x80000000;
@@ -2132,7 +2231,7 @@ static int execute(bool isIR, bool injected)
                 break;
             case 85:
                 if(!TTrunning && !isIRLocked) {
-                    play_file("/fluxing.mp3", PA_INTRMUS, playFLUX ? fluxLevel : 1.0f);
+                    play_file("/fluxing.mp3", PA_INTRMUS|PA_OVERLAY, playFLUX ? fluxLevel : 1.0f);
                     if(contFlux()) {
                         append_flux();
                     }
@@ -2141,46 +2240,9 @@ static int execute(bool isIR, bool injected)
             case 90:                              // *90 say IP address
                 if(!isIRLocked) {
                     if(!TTrunning) {
-                        uint8_t a, b, c, d;
-                        char ipbuf[16];
-                        char numfname[] = "/x.mp3";
-
-                        fcBusy = true;
-                        
-                        bool wasActiveM = mp_stop(true);
-                        bool wasActiveF = playingFlux;
-                        stopAudio();
-                        
-                        flushDelayedSave();
-                        #ifdef FC_HAVEMQTT
-                        if(!wasActiveM) mp_sendStatus();
-                        #endif
-                        
-                        wifi_getIP(a, b, c, d);
-                        sprintf(ipbuf, "%d.%d.%d.%d", a, b, c, d);
-                        numfname[1] = ipbuf[0];
-                        play_file(numfname, PA_INTRMUS|PA_ALLOWSD);
-                        for(int i = 1; i < strlen(ipbuf); i++) {
-                            if(ipbuf[i] == '.') {
-                                append_file("/dot.mp3", PA_INTRMUS|PA_ALLOWSD);
-                            } else {
-                                numfname[1] = ipbuf[i];
-                                append_file(numfname, PA_INTRMUS|PA_ALLOWSD);
-                            }
-                            while(append_pending()) {
-                                mydelay(10, false);
-                            }
+                        if(!schedStart(sayIPJob, true)) {
+                            doInpReaction = -1;
                         }
-                        waitAudioDone(false);
-
-                        fcBusy = false;
-
-                        if(wasActiveM) mp_play(); 
-                        else if(wasActiveF && contFlux()) play_flux();
-                        // Let audio_loop take care of updating MP status (if not playing at this point)
-
-                        ir_remote.loop(); // Flush IR afterwards
-
                     } else doInpReaction = -1;
                 }
                 break;
@@ -2892,13 +2954,111 @@ static void volWasChanged(bool actualVol)
 
 static void play_volchg()
 {
+    #ifndef FC_MIXER
     if(playingFlux)
         return;
+    #endif
     if(mpActive)
         return;
     if(checkMP3Running())
         return;
-    play_file("/volchg.mp3", PA_ALLOWSD);
+    play_file("/volchg.mp3", PA_ALLOWSD|PA_OVERLAY);
+}
+
+/*
+ * Jobs (see scheduler below)
+ */
+
+// Fake power on: Startup sequence
+static void fpoStartupJob(schedJob *job)
+{
+    switch(job->step) {
+    case 0:
+        fcLEDs.on();
+        boxLED.setDC(mbllArray[minBLL]);
+
+        // Play startup
+        play_file("/startup.mp3", PA_INTRMUS|PA_ALLOWSD, 1.0f);
+        if(playFLUX) {
+            append_flux();
+        }
+        fcLEDs.SpecialSignal(FCSEQ_STARTUP);
+        fcLEDs.stop(false);
+        schedWait(job, SCHED_W_LEDSEQ, 0);
+        job->step = 1;
+        break;
+    default:
+        TTKey.reset();
+        isTTKeyHeld = isTTKeyPressed = false;
+        networkTimeTravel = false;
+        networkTTRef = 0;
+
+        ssRestartTimer();
+        ssActive = false;
+
+        #ifdef FC_HAVEMQTT
+        mp_sendStatus();
+        #endif
+
+        ir_remote.loop();
+        schedDone(job);
+    }
+}
+
+// *90: Say IP address
+static void sayIPJob(schedJob *job)
+{
+    static char ipbuf[16];
+    static char numfname[] = "/x.mp3";
+    static bool wasActiveM, wasActiveF;
+    static unsigned int i;
+    uint8_t a, b, c, d;
+
+    switch(job->step) {
+    case 0:
+        fcBusy = true;
+        
+        wasActiveM = mp_stop(true);
+        wasActiveF = playingFlux;
+        stopAudio();
+        
+        flushDelayedSave();
+        #ifdef FC_HAVEMQTT
+        if(!wasActiveM) mp_sendStatus();
+        #endif
+        
+        wifi_getIP(a, b, c, d);
+        sprintf(ipbuf, "%d.%d.%d.%d", a, b, c, d);
+        numfname[1] = ipbuf[0];
+        play_file(numfname, PA_INTRMUS|PA_ALLOWSD);
+        i = 1;
+        job->step = 1;
+        // fall through
+    case 1:
+        if(i < strlen(ipbuf)) {
+            if(ipbuf[i] == '.') {
+                append_file("/dot.mp3", PA_INTRMUS|PA_ALLOWSD);
+            } else {
+                numfname[1] = ipbuf[i];
+                append_file(numfname, PA_INTRMUS|PA_ALLOWSD);
+            }
+            i++;
+            schedWait(job, SCHED_W_APPEND, 0);
+        } else {
+            schedWait(job, SCHED_W_AUDIO, 4000);
+            job->step = 2;
+        }
+        break;
+    default:
+        fcBusy = false;
+
+        if(wasActiveM) mp_play(); 
+        else if(wasActiveF && contFlux()) play_flux();
+        // Let audio_loop take care of updating MP status (if not playing at this point)
+
+        ir_remote.loop(); // Flush IR afterwards
+        schedDone(job);
+    }
 }
 
 static void waitAudioDone(bool withIR)
@@ -2946,6 +3106,273 @@ unsigned long millisNonZero()
     return now;
 }
 
+// Conditions for the scheduler (fc_sched.h)
+static bool schedCond(uint8_t what)
+{
+    switch(what) {
+    case SCHED_W_AUDIO:
+        return checkAudioDone();
+    case SCHED_W_APPEND:
+        return !append_pending();
+    case SCHED_W_LEDSEQ:
+        return fcLEDs.SpecialDone();
+    }
+
+    return true;
+}
+
+/*
+ * Boot profiler
+ * 
+ * Records a µs timestamp per boot phase in a small ring;
+ * bootProfDump() prints the phases along with the time
+ * spent since the previous mark. Marks may be set from
+ * other tasks (fast-boot), hence the spinlock.
+ */
+#ifdef FC_BOOTPROF
+#define BOOTPROF_SIZE 32
+static struct {
+    const char *phase;
+    unsigned long us;
+} bootProf[BOOTPROF_SIZE];
+static unsigned int bootProfIdx = 0;
+static portMUX_TYPE bootProfMux = portMUX_INITIALIZER_UNLOCKED;
+
+void bootProfMark(const char *phase)
+{
+    unsigned long now = micros();
+    
+    portENTER_CRITICAL(&bootProfMux);
+    bootProf[bootProfIdx % BOOTPROF_SIZE].phase = phase;
+    bootProf[bootProfIdx % BOOTPROF_SIZE].us = now;
+    bootProfIdx++;
+    portEXIT_CRITICAL(&bootProfMux);
+}
+
+void bootProfDump()
+{
+    unsigned int i = 0, cnt = bootProfIdx;
+    unsigned long last = 0;
+
+    if(cnt > BOOTPROF_SIZE) i = cnt - BOOTPROF_SIZE;
+
+    Serial.println("Boot profile (us since power-up / since previous mark):");
+    for( ; i < cnt; i++) {
+        unsigned long t = bootProf[i % BOOTPROF_SIZE].us;
+        Serial.printf("  %-20s %9lu %9lu\n", bootProf[i % BOOTPROF_SIZE].phase, t, last ? t - last : 0);
+        last = t;
+    }
+}
+#endif
+
+/*
+ * Runtime telemetry
+ *
+ * Loop functions and ISRs are timed through TELEM_SPAN (CPU
+ * cycle counter; times are inclusive of nested calls and
+ * interrupts). The main loop's iteration time goes into a
+ * log2 histogram. Every entry has a single writer; readers
+ * (web handler, MQTT, both in loop task) retry a snapshot if
+ * an ISR updated it meanwhile. No locks on the recording path.
+ */
+#ifdef FC_TELEMETRY
+#if defined(FC_TELEMETRY_MQTT) && !defined(FC_HAVEMQTT)
+#undef FC_TELEMETRY_MQTT
+#endif
+#define TELEM_HBUCKETS 16       // upper bounds 32us .. 524ms, +Inf
+telemStat telemStats[TELEM_NUM];
+static const char *telemNames[TELEM_NUM] = {
+    "main", "audio", "wifi", "bttfn", "fcled", "ir"
+};
+static uint32_t telemHist[TELEM_HBUCKETS] = { 0 };
+static uint64_t telemHistSum = 0;
+static uint32_t telemLastLoop = 0;
+static uint32_t telemMHz = 240;
+static uint32_t telemMinLargest = 0xffffffff;
+static unsigned long telemHeapNow = 0;
+#ifdef FC_TELEMETRY_MQTT
+// Max payload per message: MQTT_MAX_PACKET_SIZE (512) minus
+// fixed header, topic length and topic
+#define TELEM_MQTT_MAX 480
+static unsigned long telemMQTTNow = 0;
+static uint32_t telemMQTTDrops = 0;
+#endif
+
+void telemSetup()
+{
+    telemMHz = getCpuFrequencyMhz();
+    telemLastLoop = TELEM_CCOUNT();
+}
+
+static void telemSnap(int i, uint32_t& cnt, uint64_t& tot, uint32_t& maxc)
+{
+    uint32_t c;
+    do {
+        c = telemStats[i].cnt;
+        tot = telemStats[i].tot;
+        maxc = telemStats[i].maxc;
+    } while(c != telemStats[i].cnt);
+    cnt = c;
+}
+
+static void telemSampleHeap()
+{
+    uint32_t l = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    if(l < telemMinLargest) telemMinLargest = l;
+}
+
+#ifdef FC_TELEMETRY_MQTT
+// Counts and averages are for the interval since the last
+// publish (keeps numbers, and the message, small); max is
+// since boot. Sent as two messages ("p":1 and "p":2) to stay
+// within the MQTT packet size; messages that do not fit or
+// fail to publish are counted ("dr", and in /metrics).
+static void telemSend(char *buf, int l, int size)
+{
+    if(l >= size || !mqttPublish("bttf/fc/telemetry", buf, l + 1)) {
+        telemMQTTDrops++;
+    }
+}
+
+static void telemPublish()
+{
+    static uint32_t prevHist[TELEM_HBUCKETS] = { 0 };
+    static uint32_t prevCnt[TELEM_NUM] = { 0 };
+    static uint64_t prevTot[TELEM_NUM] = { 0 };
+    char buf[TELEM_MQTT_MAX];
+    int l, size = sizeof(buf);
+    uint32_t cnt, maxc, dc;
+    uint64_t tot;
+    unsigned long up = millis() / 1000;
+
+    l = snprintf(buf, size, "{\"p\":1,\"up\":%lu,\"ur\":%lu,\"dr\":%lu,\"hf\":%lu,\"hm\":%lu,\"hl\":%lu,\"hlm\":%lu,\"lh\":[",
+            up,
+            (unsigned long)audio_getUnderruns(),
+            (unsigned long)telemMQTTDrops,
+            (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap(),
+            (unsigned long)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT),
+            (unsigned long)telemMinLargest);
+    for(int i = 0; i < TELEM_HBUCKETS && l < size; i++) {
+        l += snprintf(buf + l, size - l, i ? ",%lu" : "%lu", (unsigned long)(telemHist[i] - prevHist[i]));
+        prevHist[i] = telemHist[i];
+    }
+    if(l < size) l += snprintf(buf + l, size - l, "]}");
+    telemSend(buf, l, size);
+
+    l = snprintf(buf, size, "{\"p\":2,\"up\":%lu", up);
+    // Per entry: calls, average ns, max ns
+    for(int i = 0; i < TELEM_NUM && l < size; i++) {
+        telemSnap(i, cnt, tot, maxc);
+        dc = cnt - prevCnt[i];
+        l += snprintf(buf + l, size - l, ",\"%s\":[%lu,%lu,%lu]", telemNames[i],
+            (unsigned long)dc, 
+            dc ? (unsigned long)((tot - prevTot[i]) * 1000 / telemMHz / dc) : 0UL, 
+            (unsigned long)((uint64_t)maxc * 1000 / telemMHz));
+        prevCnt[i] = cnt;
+        prevTot[i] = tot;
+    }
+    if(l < size) l += snprintf(buf + l, size - l, "}");
+    telemSend(buf, l, size);
+}
+#endif
+
+// Called at the start of every main_loop() iteration
+void telemLoop()
+{
+    uint32_t now = TELEM_CCOUNT();
+    uint32_t us = (now - telemLastLoop) / telemMHz;
+    uint32_t x = us >> 5;
+    int b = x ? 32 - __builtin_clz(x) : 0;
+
+    telemLastLoop = now;
+    telemHist[(b < TELEM_HBUCKETS) ? b : TELEM_HBUCKETS - 1]++;
+    telemHistSum += us;
+
+    // Largest free block needs a heap walk; sample sparsely
+    if(millis() - telemHeapNow >= 1000) {
+        telemHeapNow = millis();
+        telemSampleHeap();
+        #ifdef FC_TELEMETRY_MQTT
+        if(millis() - telemMQTTNow >= FC_TELEMETRY_MQTT * 1000) {
+            telemMQTTNow = millis();
+            if(mqttConnected()) {
+                telemPublish();
+            }
+        }
+        #endif
+    }
+}
+
+// Prometheus text format; returns length, or -1 if buf too small
+int telemFormat(char *buf, int size)
+{
+    int l = 0, r;
+    uint32_t cnt, maxc, cum = 0, lu;
+    uint64_t tot;
+
+    #define TAPPEND(...) \
+        r = snprintf(buf + l, size - l, __VA_ARGS__); \
+        if(r < 0 || r >= size - l) return -1; \
+        l += r;
+
+    TAPPEND("# TYPE fc_loop_us histogram\n");
+    for(int i = 0; i < TELEM_HBUCKETS; i++) {
+        cum += telemHist[i];
+        if(i < TELEM_HBUCKETS - 1) {
+            TAPPEND("fc_loop_us_bucket{le=\"%lu\"} %lu\n", 32UL << i, (unsigned long)cum);
+        } else {
+            TAPPEND("fc_loop_us_bucket{le=\"+Inf\"} %lu\n", (unsigned long)cum);
+        }
+    }
+    TAPPEND("fc_loop_us_sum %llu\nfc_loop_us_count %lu\n", (unsigned long long)telemHistSum, (unsigned long)cum);
+
+    TAPPEND("# TYPE fc_calls_total counter\n");
+    for(int i = 0; i < TELEM_NUM; i++) {
+        telemSnap(i, cnt, tot, maxc);
+        TAPPEND("fc_calls_total{fn=\"%s\"} %lu\n", telemNames[i], (unsigned long)cnt);
+        TAPPEND("fc_time_ns_total{fn=\"%s\"} %llu\n", telemNames[i], (unsigned long long)(tot * 1000 / telemMHz));
+        TAPPEND("fc_time_max_ns{fn=\"%s\"} %lu\n", telemNames[i], (unsigned long)((uint64_t)maxc * 1000 / telemMHz));
+    }
+
+    TAPPEND("# TYPE fc_audio_underruns_total counter\nfc_audio_underruns_total %lu\n", 
+        (unsigned long)audio_getUnderruns());
+    if((lu = audio_getLastUnderrun())) {
+        TAPPEND("# TYPE fc_audio_last_underrun_seconds gauge\nfc_audio_last_underrun_seconds %lu\n",
+            (unsigned long)((millis() - lu) / 1000));
+    }
+    TAPPEND("# TYPE fc_audio_dma_buffers gauge\nfc_audio_dma_buffers %d\n", audio_getDMABufs());
+
+    #ifdef FC_TELEMETRY_MQTT
+    TAPPEND("# TYPE fc_telemetry_mqtt_dropped_total counter\nfc_telemetry_mqtt_dropped_total %lu\n",
+        (unsigned long)telemMQTTDrops);
+    #endif
+
+    TAPPEND("# TYPE fc_event_overflows_total counter\n");
+    TAPPEND("fc_event_overflows_total{q=\"ev\"} %lu\nfc_event_overflows_total{q=\"cmd\"} %lu\n",
+        (unsigned long)evQueue.overflows, (unsigned long)cmdQueue.overflows);
+    TAPPEND("fc_event_latency_max_us{q=\"ev\"} %lu\nfc_event_latency_max_us{q=\"cmd\"} %lu\n",
+        (unsigned long)evQueue.maxLatency, (unsigned long)cmdQueue.maxLatency);
+
+    r = audio_formatDecodeProfile(buf + l, size - l);
+    if(r < 0) return -1;
+    l += r;
+
+    TAPPEND("fc_bttfn_owd_us %lu\nfc_bttfn_sync_error_us %lu\nfc_bttfn_tt_comp_ms %u\n",
+        (unsigned long)bttfnOWD, (unsigned long)bttfnSyncErr, bttfnLastTTComp);
+
+    telemSampleHeap();
+    TAPPEND("fc_heap_free_bytes %lu\nfc_heap_min_free_bytes %lu\n", 
+        (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+    TAPPEND("fc_heap_largest_block_bytes %lu\nfc_heap_min_largest_block_bytes %lu\n",
+        (unsigned long)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT), (unsigned long)telemMinLargest);
+    TAPPEND("fc_uptime_seconds %lu\n", millis() / 1000);
+
+    #undef TAPPEND
+
+    return l;
+}
+#endif
+
 /*
  * Basic Telematics Transmission Framework (BTTFN)
  */
@@ -2964,13 +3391,29 @@ static bool check_packet(uint8_t *buf)
     return (buf[BTTF_PACKET_SIZE - 1] == a);
 }
 
+/*
+ * Event queues (see fc_evqueue.h)
+ *
+ * Producers: MQTT callback, BTTFN receive (commands also 
+ * IR/keypad injection via MQTT). Everything the consumer
+ * acts on is consumer-owned state now, including the
+ * network TT flags (networkTimeTravel etc).
+ * The IR remote and the TT button are not producers: The IR
+ * ISR only records pulse timings, decoding and key handling
+ * run in main_loop() (as does button scanning), ie in the
+ * consumer's context already; queueing them would only add
+ * latency.
+ */
+void fcPostEvent(uint8_t type, uint32_t arg)
+{
+    evPush(&evQueue, type, arg);
+}
+
 void addCmdQueue(uint32_t command)
 {
     if(!command) return;
 
-    commandQueue[iCmdIdx] = command;
-    iCmdIdx++;
-    iCmdIdx &= 0x0f;
+    evPush(&cmdQueue, FCEV_CMD, command);
 }
 
 static void bttfn_eval_response(uint8_t *buf, bool checkCaps)
@@ -3084,36 +3527,23 @@ static void handle_tcd_notification(uint8_t *buf)
         // sound (if to be played)
         // We don't ignore this if TCD is connected by wire,
         // because this signal does not come via wire.
-        doPrepareTT = true;
+        fcPostEvent(FCEV_PREPARE_TT);
         break;
     case BTTFN_NOT_TT:
         // Trigger Time Travel (if not running already)
-        // Ignore command if TCD is connected by wire
-        if(!TCDconnected && !TTrunning && !IRLearning && !fcBusy) {
-            networkTimeTravel = true;
-            networkTCDTT = true;
-            networkReentry = false;
-            networkAbort = false;
-            networkLead = buf[6] | (buf[7] << 8);
-            networkP1 = buf[8] | (buf[9] << 8);
-        }
+        // Conditions are checked in main_loop()
+        fcPostEvent(FCEV_BTTFN_TT, GET32(buf, 6));
         break;
     case BTTFN_NOT_REENTRY:
-        // Start re-entry (if TT currently running)
-        // Ignore command if TCD is connected by wire
-        if(!TCDconnected && (TTrunning || networkTimeTravel) && networkTCDTT) {
-            networkReentry = true;
-        }
+        // Start re-entry (if TT currently running or pending)
+        fcPostEvent(FCEV_NET_REENTRY, 1);
         break;
     case BTTFN_NOT_ABORT_TT:
-        // Abort TT (if TT currently running)
-        // Ignore command if TCD is connected by wire
-        if(!TCDconnected && (TTrunning || networkTimeTravel) && networkTCDTT) {
-            networkAbort = true;
-        }
+        // Abort TT (if TT currently running or pending)
+        fcPostEvent(FCEV_NET_ABORT, 1);
         break;
     case BTTFN_NOT_ALARM:
-        networkAlarm = true;
+        fcPostEvent(FCEV_ALARM);
         break;
     case BTTFN_NOT_FLUX_CMD:
         if(!fcBusy) {
@@ -3121,7 +3551,7 @@ static void handle_tcd_notification(uint8_t *buf)
         }
         break;
     case BTTFN_NOT_WAKEUP:
-        doWakeup = true;
+        fcPostEvent(FCEV_WAKEUP);
         break;
     case BTTFN_NOT_INFO:
         {
@@ -3193,6 +3623,28 @@ static bool bttfn_checkmc()
     return true;
 }
 
+// Round-trip samples include our own loop latency on the way
+// back, so the fastest of the last few is the best estimate for
+// the network path; half of it is the one-way delay. The TCD
+// does not timestamp its packets, so clock offset and skew are
+// unknown; the spread of the samples bounds the error instead.
+static void bttfnAddRTT(uint32_t rtt)
+{
+    uint32_t minr = 0xffffffff, maxr = 0;
+
+    bttfnRTT[bttfnRTTidx] = rtt;
+    bttfnRTTidx = (bttfnRTTidx + 1) % BTTFN_RTT_SAMPLES;
+    if(bttfnRTTnum < BTTFN_RTT_SAMPLES) bttfnRTTnum++;
+
+    for(int i = 0; i < bttfnRTTnum; i++) {
+        if(bttfnRTT[i] < minr) minr = bttfnRTT[i];
+        if(bttfnRTT[i] > maxr) maxr = bttfnRTT[i];
+    }
+    
+    bttfnOWD = minr / 2;
+    bttfnSyncErr = (maxr - minr) / 2;
+}
+
 // Check for pending packet and parse it
 static void BTTFNCheckPacket()
 {
@@ -3243,6 +3695,8 @@ static void BTTFNCheckPacket()
         // If it's our expected packet, no other is due for now
         BTTFNPacketDue = false;
 
+        bttfnAddRTT(micros() - bttfnRqMicros);
+
         if(BTTFUDPBuf[5] & 0x80) {
             if(!haveTCDIP) {
                 bttfnTcdIP = fcUDP->remoteIP();
@@ -3340,6 +3794,8 @@ static bool BTTFNSendRequest()
         SET32(BTTFUDPBuf, 31, tcdHostNameHash);
     }
 
+    bttfnRqMicros = micros();
+
     BTTFNDispatch();
 
     BTTFNTSRQAge = millis();
@@ -3449,6 +3905,8 @@ static void bttfn_setup()
 
 void bttfn_loop()
 {
+    TELEM_SPAN(TELEM_BTTFN);
+    
     if(!useBTTFN)
         return;
 
@@ -96,8 +96,78 @@ bool switchMusicFolder(uint8_t nmf, bool isSetup = false);
 void showMPRProgress(int perc);
 
 void mydelay(unsigned long mydel, bool withIR);
+
 unsigned long millisNonZero();
 
+#ifdef FC_BOOTPROF
+void bootProfMark(const char *phase);
+void bootProfDump();
+#define BOOTPROF(x) bootProfMark(x)
+#else
+#define BOOTPROF(x)
+#endif
+
+#ifdef FC_TELEMETRY
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_cpu.h>
+#define TELEM_CCOUNT() esp_cpu_get_cycle_count()
+#else
+#include <hal/cpu_hal.h>
+#define TELEM_CCOUNT() cpu_hal_get_cycle_count()
+#endif
+enum {
+    TELEM_MAIN = 0,
+    TELEM_AUDIO,
+    TELEM_WIFI,
+    TELEM_BTTFN,
+    TELEM_ISR_FCLED,
+    TELEM_ISR_IR,
+    TELEM_NUM
+};
+// Each entry has exactly one writer (its loop function or
+// ISR); cnt is bumped last so readers can detect a torn read.
+typedef struct {
+    volatile uint64_t tot;  // cycles
+    volatile uint32_t maxc;
+    volatile uint32_t cnt;
+} telemStat;
+extern telemStat telemStats[TELEM_NUM];
+class telemSpan {
+    public:
+        inline __attribute__((always_inline)) telemSpan(telemStat *s) : _s(s), _c(TELEM_CCOUNT()) { }
+        inline __attribute__((always_inline)) ~telemSpan()
+        {
+            uint32_t d = TELEM_CCOUNT() - _c;
+            _s->tot += d;
+            if(d > _s->maxc) _s->maxc = d;
+            _s->cnt++;
+        }
+    private:
+        telemStat *_s;
+        uint32_t  _c;
+};
+#define TELEM_SPAN(x) telemSpan _telemSpan(&telemStats[x])
+void telemSetup();
+void telemLoop();
+int  telemFormat(char *buf, int size);
+#else
+#define TELEM_SPAN(x)
+#endif
+
+// Events from other contexts (MQTT, BTTFN) to main_loop()
+enum {
+    FCEV_CMD = 1,       // remote command (queued separately)
+    FCEV_PREPARE_TT,
+    FCEV_WAKEUP,
+    FCEV_ALARM,
+    FCEV_USERSIG,       // arg: signal number
+    FCEV_NET_TT,        // TT via MQTT; arg: lead | (P1 << 16)
+    FCEV_BTTFN_TT,      // TT via BTTFN; arg: as FCEV_NET_TT
+    FCEV_NET_REENTRY,   // arg: 1 = also while TT pending (BTTFN)
+    FCEV_NET_ABORT      // arg: as FCEV_NET_REENTRY
+};
+void fcPostEvent(uint8_t type, uint32_t arg = 0);
 void addCmdQueue(uint32_t command);
 void bttfn_loop();
 
@@ -121,21 +191,9 @@ extern bool TTrunning;
 extern int  playFLUX;
 extern bool IRLearning;
 
-extern bool networkTimeTravel;
-extern bool networkTCDTT;
-extern bool networkReentry;
-extern bool networkAbort;
-extern bool networkAlarm;
-extern uint16_t networkLead;
-extern uint16_t networkP1;
-
-extern int networkUserSignal;
 
 extern uint32_t myRemID;
 
-extern bool doPrepareTT;
-extern bool doWakeup;
-
 extern bool fcBusy;
 
 extern bool showUpdAvail;
@@ -0,0 +1,221 @@
+/*
+ * -------------------------------------------------------------------
+ * CircuitSetup.us Flux Capacitor
+ * (C) 2023-2026 Thomas Winischhofer (A10001986)
+ * https://github.com/realA10001986/Flux-Capacitor
+ * https://fc.out-a-ti.me
+ *
+ * Cooperative scheduler
+ *
+ * -------------------------------------------------------------------
+ * License: Modified MIT NON-AI
+ * 
+ * Permission is hereby granted, free of charge, to any person 
+ * obtaining a copy of this software and associated documentation 
+ * files (the "Software"), to deal in the Software without restriction, 
+ * including without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to 
+ * do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ * 
+ * Links inside the Software pointing to the original source must not 
+ * be changed or removed.
+ *
+ * In addition, the following restrictions apply:
+ * 
+ * 1. The Software and any modifications made to it may not be used 
+ * for the purpose of training or improving machine learning algorithms, 
+ * including but not limited to artificial intelligence, natural 
+ * language processing, or data mining. This condition applies to any 
+ * derivatives, modifications, or updates based on the Software code. 
+ * Any usage of the Software in an AI-training dataset is considered a 
+ * breach of this License.
+ *
+ * 2. The Software may not be included in any dataset used for 
+ * training or improving machine learning algorithms, including but 
+ * not limited to artificial intelligence, natural language processing, 
+ * or data mining.
+ *
+ * 3. Any person or organization found to be in violation of these 
+ * restrictions will be subject to legal action and may be held liable 
+ * for any damages resulting from such use.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _FC_SCHED_H
+#define _FC_SCHED_H
+
+#include <Arduino.h>
+
+/*
+ * Cooperative scheduler
+ *
+ * For flows that used to block in mydelay() loops while the 
+ * device is operational. A job is a step function, called 
+ * with its job struct; it does one piece of work and then 
+ * either sets up a wait (schedWait) and advances job->step, 
+ * or ends (schedDone). Steps must never block.
+ * Timers (schedAfter) and deferred calls (schedDefer) run a
+ * callback once, in loop context.
+ *
+ * sched_loop() runs at the start of every main_loop() 
+ * iteration. Guarantees:
+ * - A job whose wait is satisfied, and a timer that is due,
+ *   run within one loop() iteration; a job runs at most one
+ *   step per iteration.
+ * - Timers never fire early; schedDefer() callbacks run in
+ *   a later sched_loop(), never from within the caller.
+ * - While a modal job runs, main_loop() returns right after
+ *   the scheduler, so input and network commands are held
+ *   (as with the former blocking waits), while audio, WiFi
+ *   and BTTFN are serviced normally from loop().
+ * Setup, the sound-pack installer and switchMusicFolder()
+ * still use mydelay().
+ *
+ * Header-only so that it can be tested on the host
+ * (tests/host/sched); to be included by one file only,
+ * which defines schedCond().
+ */
+
+enum {
+    SCHED_W_NONE = 0,   // run next iteration
+    SCHED_W_TIME,       // delay
+    SCHED_W_AUDIO,      // audio done
+    SCHED_W_APPEND,     // appended file started
+    SCHED_W_LEDSEQ      // FC LED special sequence done
+};
+typedef struct schedJob schedJob;
+typedef void (*schedFunc)(schedJob *job);
+struct schedJob {
+    schedFunc     func;     // NULL = slot free
+    int           step;
+    bool          modal;
+    uint8_t       wait;
+    unsigned long since;
+    unsigned long ms;
+    uint32_t      gen;
+};
+
+// Provided by the includer: Is condition "what" (SCHED_W_AUDIO,
+// _APPEND, _LEDSEQ) met?
+static bool schedCond(uint8_t what);
+
+#define SCHED_JOBS   4
+#define SCHED_TIMERS 8
+static schedJob schedJobs[SCHED_JOBS];
+static struct {
+    void          (*cb)();
+    unsigned long start;
+    unsigned long ms;
+    uint32_t      gen;
+} schedTimers[SCHED_TIMERS];
+static int      schedModalCnt = 0;
+static uint32_t schedGen = 0;
+
+// Returns NULL if func is already running or no slot is free
+static inline schedJob *schedStart(schedFunc func, bool modal = false)
+{
+    schedJob *job = NULL;
+
+    for(int i = 0; i < SCHED_JOBS; i++) {
+        if(schedJobs[i].func == func) return NULL;
+        if(!job && !schedJobs[i].func) job = &schedJobs[i];
+    }
+    if(job) {
+        memset((void *)job, 0, sizeof(*job));
+        job->func = func;
+        job->modal = modal;
+        job->gen = schedGen;
+        if(modal) schedModalCnt++;
+    }
+
+    return job;
+}
+
+// Wait for condition "what"; ms is the timeout (0 = none),
+// or, for SCHED_W_TIME, the delay
+static inline void schedWait(schedJob *job, uint8_t what, unsigned long ms)
+{
+    job->wait = what;
+    job->since = millis();
+    job->ms = ms;
+}
+
+static inline void schedDone(schedJob *job)
+{
+    if(job->modal) schedModalCnt--;
+    job->func = NULL;
+}
+
+static inline bool schedModal()
+{
+    return (schedModalCnt > 0);
+}
+
+static inline bool schedAfter(unsigned long ms, void (*cb)())
+{
+    for(int i = 0; i < SCHED_TIMERS; i++) {
+        if(!schedTimers[i].cb) {
+            schedTimers[i].cb = cb;
+            schedTimers[i].start = millis();
+            schedTimers[i].ms = ms;
+            schedTimers[i].gen = schedGen;
+            return true;
+        }
+    }
+    return false;
+}
+#define schedDefer(cb) schedAfter(0, cb)
+
+static inline bool schedReady(schedJob *job, unsigned long now)
+{
+    bool timedOut = (now - job->since >= job->ms);
+
+    switch(job->wait) {
+    case SCHED_W_TIME:
+        return timedOut;
+    case SCHED_W_AUDIO:
+    case SCHED_W_APPEND:
+    case SCHED_W_LEDSEQ:
+        return schedCond(job->wait) || (job->ms && timedOut);
+    }
+
+    return true;
+}
+
+static inline void sched_loop()
+{
+    unsigned long now = millis();
+
+    // Timers and jobs set up during this pass wait for the next
+    schedGen++;
+
+    for(int i = 0; i < SCHED_TIMERS; i++) {
+        if(schedTimers[i].cb && schedTimers[i].gen != schedGen &&
+           (now - schedTimers[i].start >= schedTimers[i].ms)) {
+            void (*cb)() = schedTimers[i].cb;
+            schedTimers[i].cb = NULL;
+            cb();
+        }
+    }
+
+    for(int i = 0; i < SCHED_JOBS; i++) {
+        schedJob *job = &schedJobs[i];
+        if(job->func && job->gen != schedGen && schedReady(job, now)) {
+            job->wait = SCHED_W_NONE;
+            job->func(job);
+        }
+    }
+}
+
+#endif
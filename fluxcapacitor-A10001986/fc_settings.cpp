@@ -73,6 +73,9 @@
 #include "fc_audio.h"
 #include "fc_main.h"
 #include "fc_wifi.h"
+#ifdef FC_UPLBUF
+#include "fc_uplbuf.h"
+#endif
 
 // Settings transition, stage 2: Assume new settings
 // are present, but still delete obsolete files.
@@ -100,6 +103,26 @@ static const char *CONFND = "/FCA.old";
 static const char *CONID  = "FCAA";
 const char        rspv[] = SND_REQ_VERSION;
 static uint32_t   soa = AC_TS;
+
+// Sound-pack installer: Data is copied in blocks of the flash
+// FS' block (=erase block) size; container encoding works on
+// CPA_CHUNK units. Progress is journaled on SD, so that an
+// interrupted install can skip what is already there.
+#define CPA_BLKSIZE 4096
+#define CPA_CHUNK   1024
+static const char *cpaJnlName = "/fcinst.jnl";
+typedef struct {
+    uint32_t nameHash;
+    uint32_t size;
+    uint32_t hash;      // of decoded content
+} CPAJEntry;
+static struct {
+    uint32_t  id;       // container identity
+    int       num;
+    CPAJEntry e[NUM_AUDIOFILES+1];
+} cpaJnl;
+static uint8_t    *cpaBuf = NULL;
+static uint32_t   cpaTotal = 0, cpaDone = 0;
 static bool       ic = false;
 static uint8_t*   f(uint8_t *d, uint32_t m, int y) { return d; }
 static char       *uploadFileNames[MAX_SIM_UPLOADS] = { NULL };
@@ -142,12 +165,31 @@ static bool     haveTerSettings  = false;
 static uint32_t mainConfigHash = 0;
 static uint32_t ipHash = 0;
 
+#ifdef FC_CFGCACHE
+// Header of binary snapshots of parsed JSON files.
+// fwHash covers firmware version and struct layout,
+// jsonHash the JSON file the snapshot was created from.
+typedef struct [[gnu::packed]] {
+    uint32_t fwHash;
+    uint32_t jsonHash;
+} CfgSnapHdr;
+static uint32_t cfgSnapHash = 0;
+static bool     cfgSnapPending = false;
+#endif
+
 static const char *cfgName    = "/fcconfig.json";   // Main config (flash)
 static const char *ipCfgName  = "/fcipcfg";         // IP config (flash)
 static const char *idName     = "/fcid";            // FC remote ID (flash)
 static const char *secCfgName = "/fc2cfg";          // Secondary settings (flash/SD)
 static const char *irCfgName  = "/fcirkeys.json";   // Learned IR keys (flash/SD)
 static const char *terCfgName = "/fc3cfg";          // Tertiary settings (SD)
+#ifdef FC_SDCAL
+static const char *sdCalName  = "/fcsdcal";         // SD clock calibration (flash)
+#endif
+#ifdef FC_CFGCACHE
+static const char *cfgSnapName = "/fccfgc";         // Parsed main config (flash)
+static const char *irSnapName  = "/fcirkc";         // Parsed learned IR keys (flash/SD)
+#endif
 
 #ifdef SETTINGS_TRANSITION_2
 static const char *obsFiles[] = {
@@ -197,6 +239,18 @@ bool haveAudioFiles = false;
 // Music Folder Number
 uint8_t musFolderNum = 0;
 
+#ifdef FC_SDCAL
+// SD clock calibration result (per card)
+static struct [[gnu::packed]] {
+    uint8_t  cid[16];
+    uint32_t freq;
+    uint32_t kbps;
+    uint32_t regions;   // results with fewer test regions are redone
+} sdCal;
+uint32_t sdClock = 0;
+uint32_t sdKBps  = 0;
+#endif
+
 static uint8_t*  (*r)(uint8_t *, uint32_t, int);
 static bool read_settings(File configFile, int cfgReadCount);
 
@@ -218,6 +272,8 @@ static void     saveId();
 
 static bool copy_audio_files(bool& delIDfile);
 static void cfc(File& sfile, bool doCopy, int& haveErr, int& haveWriteErr);
+static bool cpaBegin(File& sfile);
+static void cpaEnd();
 
 static bool audio_files_present(int& alienVer);
 
@@ -232,12 +288,23 @@ static bool writeFileToFS(const char *fn, uint8_t *buf, int len);
 
 static bool loadConfigFile(const char *fn, uint8_t *buf, int len, int& validBytes, int forcefs = 0);
 static bool saveConfigFile(const char *fn, uint8_t *buf, int len, int forcefs = 0);
+#define HASH_INIT 2166136261UL
+static uint32_t hashUpdate(uint32_t hash, uint8_t *buf, int len);
 static uint32_t calcHash(uint8_t *buf, int len);
+#ifdef FC_CFGCACHE
+static bool hashCfgFile(File& configFile, uint32_t& hash);
+static bool loadCfgSnapshot(const char *fn, uint32_t jsonHash, uint8_t *buf, int len, int forcefs);
+static bool saveCfgSnapshot(const char *fn, uint32_t jsonHash, uint8_t *buf, int len, int forcefs);
+#endif
 static bool saveSecSettings(bool useCache);
 static bool saveTerSettings(bool useCache);
 
 static void firmware_update();
 
+#ifdef FC_SDCAL
+static void sdCalibrate();
+#endif
+
 /*
  * settings_setup()
  * 
@@ -303,6 +370,8 @@ void settings_setup()
 
         // Write new config file after mounting SD and determining FlashROMode
 
+        BOOTPROF("cfg_read");
+
     } else {
 
         Serial.println("failed.\n*** Mounting flash FS failed. Using SD (if available)");
@@ -334,6 +403,8 @@ void settings_setup()
         haveSD = ((cardType != CARD_NONE) && (cardType != CARD_UNKNOWN));
     }
 
+    BOOTPROF("sd_mount");
+
     if(haveSD) {
 
         firmware_update();
@@ -362,9 +433,18 @@ void settings_setup()
         Serial.println("no SD card found");
     }
 
+    #ifdef FC_SDCAL
+    if(haveSD) {
+        sdCalibrate();
+        BOOTPROF("sd_calib");
+    }
+    #endif
+
     // Check if (current) audio data is installed
     haveAudioFiles = audio_files_present(alienVER);
 
+    BOOTPROF("audio_files");
+
     // Re-format flash FS if either alien VER found, or
     // neither VER nor our config file exist.
     // (Note: LittleFS crashes when flash FS is full.)
@@ -389,6 +469,15 @@ void settings_setup()
         write_settings();
     }
 
+    #ifdef FC_CFGCACHE
+    // Write snapshot of freshly parsed config; skip if config
+    // was rewritten in the meantime, do that on next boot.
+    if(cfgSnapPending && haveFS && !FlashROMode && mainConfigHash == cfgSnapHash) {
+        saveCfgSnapshot(cfgSnapName, cfgSnapHash, (uint8_t *)&settings, sizeof(settings), -1);
+    }
+    cfgSnapPending = false;
+    #endif
+
     #ifdef SETTINGS_TRANSITION_2
     if(haveSD) {
         for(int i = 0; ; i++) {
@@ -427,6 +516,8 @@ void settings_setup()
     // Load user-config's and learned IR keys
     loadIRKeys();
 
+    BOOTPROF("ir_keys");
+
     // Load car mode
     if(*settings.cm_ssid) {
         loadCarMode();
@@ -444,6 +535,116 @@ void settings_setup()
     }
 }
 
+#ifdef FC_SDCAL
+/*
+ * SD clock calibration
+ * 
+ * Step up the SPI clock from the one the card was mounted
+ * with, while multi-block reads pass the CRC check, and use 
+ * the highest clock that worked. A clock above the mount 
+ * clock is only kept if reads pass at SDCAL_REGIONS places
+ * spread across the card; otherwise the mount clock stays.
+ * The result is stored per card (CID) and re-used on next 
+ * boot.
+ */
+#define SDCAL_REGIONS 8
+static bool sdCalTest(uint8_t *buf, uint32_t numSecs, int numRuns, uint32_t cardSecs, unsigned long& us)
+{
+    us = micros();
+    for(int j = 0; j < numRuns; j++) {
+        for(int k = 0; k < SDCAL_REGIONS; k++) {
+            // First and last region at start and end of card
+            uint32_t sec = (uint32_t)(((uint64_t)(cardSecs - numSecs) * k) / (SDCAL_REGIONS - 1));
+            if(!SD.testRead(buf, sec, numSecs))
+                return false;
+        }
+    }
+    us = micros() - us;
+    
+    return true;
+}
+
+static void sdCalibrate()
+{
+    static const uint32_t freqs[] = { 16000000, 20000000, 25000000 };
+    const int numSecs = 16, numRuns = 2;
+    uint32_t mountClock, cardSecs;
+    unsigned long us;
+    uint8_t cid[16];
+    uint8_t *buf;
+    int vb;
+
+    if(!SD.readCID(cid))
+        return;
+
+    sdClock = mountClock = SD.getFrequency();
+    sdKBps = 0;
+
+    if(loadConfigFile(sdCalName, (uint8_t *)&sdCal, sizeof(sdCal), vb, -1)) {
+        if(vb == sizeof(sdCal) && !memcmp(sdCal.cid, cid, sizeof(cid)) && sdCal.freq &&
+           sdCal.regions == SDCAL_REGIONS) {
+            SD.setFrequency(sdCal.freq);
+            sdClock = sdCal.freq;
+            sdKBps = sdCal.kbps;
+            #ifdef FC_DBG
+            Serial.printf("sdCalibrate: Using stored clock %d, %d KB/s\n", sdClock, sdKBps);
+            #endif
+            return;
+        }
+    }
+
+    if((cardSecs = SD.numSectors()) < numSecs * SDCAL_REGIONS)
+        return;
+
+    if(!(buf = (uint8_t *)malloc(numSecs * 512)))
+        return;
+
+    // Mount clock first: If the card fails there, it does
+    // not do CRC (or the test is of no use); keep it.
+    if(sdCalTest(buf, numSecs, numRuns, cardSecs, us)) {
+
+        sdKBps = (uint32_t)(((uint64_t)numRuns * SDCAL_REGIONS * numSecs * 512 * 1000000ULL) / ((uint64_t)us * 1000));
+        
+        #ifdef FC_DBG
+        Serial.printf("sdCalibrate: %d Hz (mount): ok, %d us\n", mountClock, us);
+        #endif
+
+        for(int i = 0; i < (int)(sizeof(freqs) / sizeof(freqs[0])); i++) {
+            bool ok;
+
+            if(freqs[i] <= mountClock)
+                continue;
+            
+            SD.setFrequency(freqs[i]);
+
+            ok = sdCalTest(buf, numSecs, numRuns, cardSecs, us);
+
+            #ifdef FC_DBG
+            Serial.printf("sdCalibrate: %d Hz: %s, %d us\n", freqs[i], ok ? "ok" : "failed", ok ? us : 0);
+            #endif
+
+            if(!ok) break;
+
+            sdClock = freqs[i];
+            sdKBps = (uint32_t)(((uint64_t)numRuns * SDCAL_REGIONS * numSecs * 512 * 1000000ULL) / ((uint64_t)us * 1000));
+        }
+    }
+
+    free(buf);
+
+    SD.setFrequency(sdClock);
+
+    if(!sdKBps)
+        return;
+
+    memcpy(sdCal.cid, cid, sizeof(cid));
+    sdCal.freq = sdClock;
+    sdCal.kbps = sdKBps;
+    sdCal.regions = SDCAL_REGIONS;
+    saveConfigFile(sdCalName, (uint8_t *)&sdCal, sizeof(sdCal), -1);
+}
+#endif
+
 void unmount_fs()
 {
     if(haveFS) {
@@ -467,6 +668,20 @@ static bool read_settings(File configFile, int cfgReadCount)
     static const char *funcName = "read_settings";
     bool wd = false;
     size_t jsonSize = 0;
+
+    #ifdef FC_CFGCACHE
+    // On first read (flash), use snapshot if JSON file unchanged
+    if(!cfgReadCount && hashCfgFile(configFile, cfgSnapHash)) {
+        if(loadCfgSnapshot(cfgSnapName, cfgSnapHash, (uint8_t *)&settings, sizeof(settings), -1)) {
+            #ifdef FC_DBG
+            Serial.printf("%s: Using snapshot (%x)\n", funcName, cfgSnapHash);
+            #endif
+            mainConfigHash = cfgSnapHash;
+            return false;
+        }
+    }
+    #endif
+    
     DECLARE_D_JSON(JSON_SIZE,json);
     
     DeserializationError error = readJSONCfgFile(json, configFile, &mainConfigHash);
@@ -567,6 +782,12 @@ static bool read_settings(File configFile, int cfgReadCount)
 
     }
 
+    #ifdef FC_CFGCACHE
+    // Snapshot is written in settings_setup() once we know
+    // whether we are allowed to write to flash
+    cfgSnapPending = (!cfgReadCount && !wd && mainConfigHash == cfgSnapHash);
+    #endif
+
     return wd;
 }
 
@@ -766,9 +987,24 @@ static bool openCfgFileRead(const char *fn, File& f, bool SDonly = false)
 static bool loadIRkeysFromFile(File configFile, int index)
 {
     uint32_t ir_keys[NUM_IR_KEYS];
-    DECLARE_S_JSON(1024,json);
     bool ret = true;
 
+    #ifdef FC_CFGCACHE
+    uint32_t jsonHash;
+    bool haveHash = hashCfgFile(configFile, jsonHash);
+    
+    if(haveHash && loadCfgSnapshot(irSnapName, jsonHash, (uint8_t *)ir_keys, sizeof(ir_keys), 0)) {
+        #ifdef FC_DBG
+        Serial.printf("loadIRkeys: Using snapshot (%x)\n", jsonHash);
+        #endif
+        populateIRarray(ir_keys, index);
+        configFile.close();
+        return true;
+    }
+    #endif
+
+    DECLARE_S_JSON(1024,json);
+
     DeserializationError err = readJSONCfgFile(json, configFile);
 
     if(err) return false;
@@ -789,6 +1025,11 @@ static bool loadIRkeysFromFile(File configFile, int index)
 
     if(ret) {
         populateIRarray(ir_keys, index);
+        #ifdef FC_CFGCACHE
+        if(haveHash) {
+            saveCfgSnapshot(irSnapName, jsonHash, (uint8_t *)ir_keys, sizeof(ir_keys), 0);
+        }
+        #endif
     }
     
     configFile.close();
@@ -1333,11 +1574,13 @@ bool prepareCopyAudioFiles()
 
     File sfile;
     if(sfile = SD.open(CONFN, FILE_READ)) {
+        cpaBegin(sfile);
         sfile.seek(14);
         for(i = 0; i < NUM_AUDIOFILES+1; i++) {
            cfc(sfile, false, haveErr, haveWriteErr);
            if(haveErr) break;
         }
+        cpaEnd();
         sfile.close();
     } else {
         return false;
@@ -1362,6 +1605,9 @@ void doCopyAudioFiles()
 
     if(delIDfile) {
         delete_ID_file();
+        if(haveSD) {
+            SD.remove(cpaJnlName);
+        }
     } else {
         showCopyError();
         mydelay(5000, false);
@@ -1394,11 +1640,13 @@ static bool copy_audio_files(bool& delIDfile)
     if(ic) {
         File sfile;
         if(sfile = SD.open(CONFN, FILE_READ)) {
+            cpaBegin(sfile);
             sfile.seek(14);
             for(i = 0; i < NUM_AUDIOFILES+1; i++) {
                cfc(sfile, true, haveErr, haveWriteErr);
                if(haveErr) break;
             }
+            cpaEnd();
             sfile.close();
         } else {
             haveErr++;
@@ -1412,18 +1660,117 @@ static bool copy_audio_files(bool& delIDfile)
     return (haveWriteErr == 0);
 }
 
+// Set up installer for container sfile: Allocate block
+// buffer, load journal (if it belongs to this container)
+static bool cpaBegin(File& sfile)
+{
+    uint8_t hdr[14];
+    int validBytes = 0;
+    uint32_t id;
+
+    cpaBuf = (uint8_t *)malloc(CPA_BLKSIZE);
+
+    cpaTotal = sfile.size() - AC_OHSZ;
+    cpaDone = 0;
+
+    sfile.seek(0);
+    if(sfile.read(hdr, 14) != 14)
+        return false;
+    id = calcHash(hdr, 14) ^ sfile.size();
+
+    if(!loadConfigFile(cpaJnlName, (uint8_t *)&cpaJnl, sizeof(cpaJnl), validBytes, 1) ||
+       validBytes != sizeof(cpaJnl) || cpaJnl.id != id || cpaJnl.num > NUM_AUDIOFILES+1) {
+        memset((void *)&cpaJnl, 0, sizeof(cpaJnl));
+        cpaJnl.id = id;
+    }
+
+    return true;
+}
+
+static void cpaEnd()
+{
+    if(cpaBuf) {
+        free(cpaBuf);
+        cpaBuf = NULL;
+    }
+}
+
+// Hash file content; false if it can't be read completely
+static bool cpaHashFile(File& file, uint32_t size, uint32_t& hash, uint8_t *buf, uint32_t bufSize)
+{
+    hash = HASH_INIT;
+    while(size) {
+        uint32_t t = (size < bufSize) ? size : bufSize;
+        if(file.read(buf, t) != t)
+            return false;
+        hash = hashUpdate(hash, buf, t);
+        size -= t;
+    }
+    return true;
+}
+
+// Check if file is journaled as installed, and still there
+// with the journaled size and content
+static bool cpaIsInstalled(FS& fs, const char *fn, uint32_t nameHash, uint32_t size, uint8_t *buf, uint32_t bufSize)
+{
+    File file;
+    uint32_t hash;
+    bool ret = false;
+
+    for(int i = 0; i < cpaJnl.num; i++) {
+        if(cpaJnl.e[i].nameHash == nameHash && cpaJnl.e[i].size == size) {
+            if(fs.exists(fn) && (file = fs.open(fn, FILE_READ))) {
+                if(file.size() == size) {
+                    ret = cpaHashFile(file, size, hash, buf, bufSize) && (hash == cpaJnl.e[i].hash);
+                }
+                file.close();
+            }
+            break;
+        }
+    }
+
+    return ret;
+}
+
+static void cpaJournal(uint32_t nameHash, uint32_t size, uint32_t hash)
+{
+    int i;
+
+    for(i = 0; i < cpaJnl.num; i++) {
+        if(cpaJnl.e[i].nameHash == nameHash) break;
+    }
+    if(i >= NUM_AUDIOFILES+1) return;
+
+    cpaJnl.e[i].nameHash = nameHash;
+    cpaJnl.e[i].size = size;
+    cpaJnl.e[i].hash = hash;
+    if(i == cpaJnl.num) cpaJnl.num++;
+
+    saveConfigFile(cpaJnlName, (uint8_t *)&cpaJnl, sizeof(cpaJnl), 1);
+}
+
+static void cpaProgress(uint32_t bytes)
+{
+    cpaDone += bytes;
+    if(cpaTotal) {
+        showMPRProgress((int)((uint64_t)cpaDone * 100 / cpaTotal));
+    }
+}
+
 static void cfc(File& sfile, bool doCopy, int& haveErr, int& haveWriteErr)
 {
     static const char *funcName = "cfc";
     uint8_t buf1[1+32+4];
-    uint8_t buf2[1024];
-    uint32_t s;
+    uint8_t sbuf[CPA_CHUNK];
+    uint8_t *buf = cpaBuf ? cpaBuf : sbuf;
+    uint32_t bufSize = cpaBuf ? CPA_BLKSIZE : CPA_CHUNK;
+    uint32_t s, fsize, nameHash, hash = HASH_INIT, vhash;
     bool skip = false, tSD = false;
     File dfile;
 
     buf1[0] = '/';
     sfile.read(buf1 + 1, 32+4);   
-    s = getuint32((*r)(buf1 + 1, soa, 32) + 32);
+    s = fsize = getuint32((*r)(buf1 + 1, soa, 32) + 32);
     if(buf1[1] == '_') {
         tSD = true;
         skip = doCopy;
@@ -1431,18 +1778,32 @@ static void cfc(File& sfile, bool doCopy, int& haveErr, int& haveWriteErr)
         skip = !doCopy;
     }
     if(!skip) {
-        if((dfile = (tSD || FlashROMode) ? SD.open((const char *)buf1, FILE_WRITE) : MYNVS.open((const char *)buf1, FILE_WRITE))) {
-            uint32_t t = 1024;
+        FS& dfs = (tSD || FlashROMode) ? (FS&)SD : (FS&)MYNVS;
+        nameHash = calcHash(buf1 + 1, strlen((const char *)buf1 + 1));
+        if(cpaIsInstalled(dfs, (const char *)buf1, nameHash, s, buf, bufSize)) {
+            #ifdef FC_DBG
+            Serial.printf("%s: Already installed: %s, length %d\n", funcName, (const char *)buf1, s);
+            #endif
+            sfile.seek(sfile.position() + s);
+            if(doCopy) cpaProgress(s);
+            return;
+        }
+        if((dfile = dfs.open((const char *)buf1, FILE_WRITE))) {
             #ifdef FC_DBG
             Serial.printf("%s: Opened destination file: %s, length %d\n", funcName, (const char *)buf1, s);
             #endif
             while(s > 0) {
-                t = (s < t) ? s : t;
-                if(sfile.read(buf2, t) != t) {
+                uint32_t t = (s < bufSize) ? s : bufSize;
+                if(sfile.read(buf, t) != t) {
                     haveErr++;
                     break;
                 }
-                if(dfile.write((*r)(buf2, soa, t), t) != t) {
+                // Container is encoded in CPA_CHUNK units
+                for(uint32_t o = 0; o < t; o += CPA_CHUNK) {
+                    (*r)(buf + o, soa, (t - o < CPA_CHUNK) ? t - o : CPA_CHUNK);
+                }
+                hash = hashUpdate(hash, buf, t);
+                if(dfile.write(buf, t) != t) {
                     #ifdef FC_DBG
                     Serial.printf("%s: Write error\n", funcName);
                     #endif
@@ -1451,6 +1812,23 @@ static void cfc(File& sfile, bool doCopy, int& haveErr, int& haveWriteErr)
                     break;
                 }
                 s -= t;
+                if(doCopy) cpaProgress(t);
+            }
+            dfile.close();
+            if(!s) {
+                // Read back and verify
+                bool vok = false;
+                if((dfile = dfs.open((const char *)buf1, FILE_READ))) {
+                    vok = (dfile.size() == fsize) && cpaHashFile(dfile, fsize, vhash, buf, bufSize) && (vhash == hash);
+                    dfile.close();
+                }
+                if(vok) {
+                    cpaJournal(nameHash, fsize, hash);
+                } else {
+                    Serial.printf("%s: Verify failed: %s\n", funcName, buf1);
+                    haveErr++;
+                    haveWriteErr++;
+                }
             }
         } else {
             haveErr++;
@@ -1462,6 +1840,7 @@ static void cfc(File& sfile, bool doCopy, int& haveErr, int& haveWriteErr)
         Serial.printf("%s: Skipped file: %s, length %d\n", funcName, (const char *)buf1, s);
         #endif
         sfile.seek(sfile.position() + s);
+        if(doCopy) cpaProgress(s);
     }
 }
 
@@ -1862,15 +2241,97 @@ static bool saveConfigFile(const char *fn, uint8_t *buf, int len, int forcefs)
     return ret;
 }
 
-static uint32_t calcHash(uint8_t *buf, int len)
+static uint32_t hashUpdate(uint32_t hash, uint8_t *buf, int len)
 {
-    uint32_t hash = 2166136261UL;
     for(int i = 0; i < len; i++) {
         hash = (hash ^ buf[i]) * 16777619;
     }
     return hash;
 }
 
+static uint32_t calcHash(uint8_t *buf, int len)
+{
+    return hashUpdate(HASH_INIT, buf, len);
+}
+
+#ifdef FC_CFGCACHE
+/*
+ * Binary snapshots of parsed JSON config files
+ * 
+ * A snapshot is only valid for the firmware build it
+ * was written by, and for the JSON file it was made from.
+ * The build time is part of the key: Dev builds may 
+ * reorder or resize fields in Settings without changing
+ * its total size or the version.
+ */
+
+static uint32_t cfgSnapFWHash(int len)
+{
+    static const char fwv[] = FC_VERSION FC_VERSION_EXTRA " " __DATE__ " " __TIME__;
+    return calcHash((uint8_t *)fwv, sizeof(fwv)) ^ (uint32_t)len;
+}
+
+static bool hashCfgFile(File& configFile, uint32_t& hash)
+{
+    size_t bufSize = configFile.size();
+    uint8_t *buf;
+    bool ret;
+
+    if(!(buf = (uint8_t *)malloc(bufSize + 1)))
+        return false;
+
+    ret = (configFile.read(buf, bufSize) == bufSize);
+    hash = calcHash(buf, bufSize);
+    free(buf);
+    configFile.seek(0);
+
+    return ret;
+}
+
+static bool loadCfgSnapshot(const char *fn, uint32_t jsonHash, uint8_t *buf, int len, int forcefs)
+{
+    int bufSize = sizeof(CfgSnapHdr) + len;
+    int validBytes = 0;
+    uint8_t *bbuf;
+    bool ret = false;
+
+    if(!(bbuf = (uint8_t *)malloc(bufSize)))
+        return false;
+
+    if(loadConfigFile(fn, bbuf, bufSize, validBytes, forcefs) && validBytes == bufSize) {
+        CfgSnapHdr *hdr = (CfgSnapHdr *)bbuf;
+        if(hdr->fwHash == cfgSnapFWHash(len) && hdr->jsonHash == jsonHash) {
+            memcpy(buf, bbuf + sizeof(CfgSnapHdr), len);
+            ret = true;
+        }
+    }
+
+    free(bbuf);
+
+    return ret;
+}
+
+static bool saveCfgSnapshot(const char *fn, uint32_t jsonHash, uint8_t *buf, int len, int forcefs)
+{
+    int bufSize = sizeof(CfgSnapHdr) + len;
+    uint8_t *bbuf;
+    bool ret;
+
+    if(!(bbuf = (uint8_t *)malloc(bufSize)))
+        return false;
+
+    ((CfgSnapHdr *)bbuf)->fwHash = cfgSnapFWHash(len);
+    ((CfgSnapHdr *)bbuf)->jsonHash = jsonHash;
+    memcpy(bbuf + sizeof(CfgSnapHdr), buf, len);
+
+    ret = saveConfigFile(fn, bbuf, bufSize, forcefs);
+
+    free(bbuf);
+
+    return ret;
+}
+#endif
+
 static bool saveSecSettings(bool useCache)
 {
     uint32_t oldHash = secSettingsHash;
@@ -1939,7 +2400,7 @@ static char *allocateUploadFileName(const char *fn, int idx)
     return uploadRealFileNames[idx];
 }
 
-bool openUploadFile(String& fn, File& file, int idx, bool haveAC, int& opType, int& errNo)
+bool openUploadFile(String& fn, File& file, int idx, bool haveAC, int& opType, int& errNo, size_t sizeHint)
 {
     char *uploadFileName = NULL;
     bool ret = false;
@@ -1991,11 +2452,25 @@ bool openUploadFile(String& fn, File& file, int idx, bool haveAC, int& opType, i
         }
 
         if(opType >= 0) {
+            #ifdef FC_UPLBUF
+            // Sound-pack: Pre-allocate if size is known. sizeHint
+            // is the request's Content-Length, ie slightly larger
+            // than the file; we truncate to actual size on close.
+            bool prealloc = (opType == 1 && sizeHint && SD.preallocate(uploadFileName, sizeHint));
+            if((file = SD.open(uploadFileName, prealloc ? "r+" : FILE_WRITE))) {
+                ret = true;
+                uplwBegin(file, prealloc ? uploadFileName : NULL);
+            } else {
+                if(prealloc) SD.remove(uploadFileName);
+                errNo = UPL_OPENERR;
+            }
+            #else
             if((file = SD.open(uploadFileName, FILE_WRITE))) {
                 ret = true;
             } else {
                 errNo = UPL_OPENERR;
             }
+            #endif
         }
 
     } else {
@@ -2009,12 +2484,35 @@ bool openUploadFile(String& fn, File& file, int idx, bool haveAC, int& opType, i
 
 size_t writeACFile(File& file, uint8_t *buf, size_t len)
 {
+    #ifdef FC_UPLBUF
+    if(uplwFile == &file) {
+        return uplwWrite(buf, len);
+    }
+    #endif
     return file.write(buf, len);
 }
 
-void closeACFile(File& file)
+// Returns false if (deferred) write failed
+bool closeACFile(File& file)
 {
+    bool ret = true;
+
+    #ifdef FC_UPLBUF
+    if(uplwFile == &file) {
+        ret = uplwEnd();
+        file.close();
+        if(uplwTruncName) {
+            SD.truncate(uplwTruncName, uplwTotal);
+            uplwTruncName = NULL;
+        }
+        uplwFile = NULL;
+        return ret;
+    }
+    #endif
+
     file.close();
+
+    return ret;
 }
 
 void removeACFile(int idx)
@@ -134,9 +134,9 @@ void moveSettings();
 #define UPL_UNKNOWN 6
 #define UPL_DPLBIN  7
 #include <FS.h>
-bool   openUploadFile(String& fn, File& file, int idx, bool haveAC, int& opType, int& errNo);
+bool   openUploadFile(String& fn, File& file, int idx, bool haveAC, int& opType, int& errNo, size_t sizeHint = 0);
 size_t writeACFile(File& file, uint8_t *buf, size_t len);
-void   closeACFile(File& file);
+bool   closeACFile(File& file);
 void   removeACFile(int idx);
 void   renameUploadFile(int idx);
 char   *getUploadFileName(int idx);
@@ -247,4 +247,9 @@ extern bool     haveAudioFiles;
 
 extern uint8_t  musFolderNum;
 
+#ifdef FC_SDCAL
+extern uint32_t sdClock;
+extern uint32_t sdKBps;
+#endif
+
 #endif
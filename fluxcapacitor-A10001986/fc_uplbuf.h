@@ -0,0 +1,226 @@
+/*
+ * -------------------------------------------------------------------
+ * CircuitSetup.us Flux Capacitor
+ * (C) 2023-2026 Thomas Winischhofer (A10001986)
+ * https://github.com/realA10001986/Flux-Capacitor
+ * https://fc.out-a-ti.me
+ *
+ * Buffered upload writer
+ *
+ * -------------------------------------------------------------------
+ * License: Modified MIT NON-AI
+ * 
+ * Permission is hereby granted, free of charge, to any person 
+ * obtaining a copy of this software and associated documentation 
+ * files (the "Software"), to deal in the Software without restriction, 
+ * including without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell copies of the 
+ * Software, and to permit persons to whom the Software is furnished to 
+ * do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ * 
+ * Links inside the Software pointing to the original source must not 
+ * be changed or removed.
+ *
+ * In addition, the following restrictions apply:
+ * 
+ * 1. The Software and any modifications made to it may not be used 
+ * for the purpose of training or improving machine learning algorithms, 
+ * including but not limited to artificial intelligence, natural 
+ * language processing, or data mining. This condition applies to any 
+ * derivatives, modifications, or updates based on the Software code. 
+ * Any usage of the Software in an AI-training dataset is considered a 
+ * breach of this License.
+ *
+ * 2. The Software may not be included in any dataset used for 
+ * training or improving machine learning algorithms, including but 
+ * not limited to artificial intelligence, natural language processing, 
+ * or data mining.
+ *
+ * 3. Any person or organization found to be in violation of these 
+ * restrictions will be subject to legal action and may be held liable 
+ * for any damages resulting from such use.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY 
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _FC_UPLBUF_H
+#define _FC_UPLBUF_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+/*
+ * Buffered upload writer
+ *
+ * The web server hands us small chunks (HTTP_UPLOAD_BUFLEN); writing
+ * each of them separately means FatFS and SPI overhead per chunk, and
+ * the web server stalls while the card is busy. Instead, chunks are
+ * collected in one of two buffers. A full buffer is passed to a writer
+ * task, while the other one is filled with the next chunks. Buffers are
+ * a multiple of the cluster size on most cards, so writes (apart from
+ * the last one) are whole clusters.
+ * Header-only so that it can be tested on the host (tests/host/upl);
+ * to be included by one file only (fc_settings.cpp).
+ */
+
+#define UPLW_BUFSIZE    (16*1024)
+#define UPLW_BUFSIZE_LO (4*1024)
+
+typedef struct {
+    int      idx;     // <0: quit
+    uint32_t len;
+} uplwMsg;
+
+static File          *uplwFile = NULL;
+static uint8_t       *uplwBuf[2] = { NULL, NULL };
+static uint32_t      uplwBufSize = 0;
+static uint32_t      uplwFill = 0;
+static int           uplwCur = 0;
+static uint32_t      uplwTotal = 0;
+static const char    *uplwTruncName = NULL;
+static QueueHandle_t uplwToWriter = NULL;
+static QueueHandle_t uplwToFiller = NULL;
+static TaskHandle_t  uplwTask = NULL;
+static bool          uplwErr = false;    // set by writer task, __atomic
+
+static void uplwWriter(void *parm)
+{
+    uplwMsg msg;
+
+    for(;;) {
+        xQueueReceive(uplwToWriter, &msg, portMAX_DELAY);
+        if(msg.idx < 0) break;
+        if(!__atomic_load_n(&uplwErr, __ATOMIC_RELAXED)) {
+            if(uplwFile->write(uplwBuf[msg.idx], msg.len) != msg.len) {
+                __atomic_store_n(&uplwErr, true, __ATOMIC_RELAXED);
+            }
+        }
+        xQueueSend(uplwToFiller, &msg.idx, portMAX_DELAY);
+    }
+
+    // Tell filler we are gone
+    xQueueSend(uplwToFiller, &msg.idx, portMAX_DELAY);
+    vTaskDelete(NULL);
+}
+
+static void uplwFree()
+{
+    for(int i = 0; i < 2; i++) {
+        if(uplwBuf[i]) {
+            free(uplwBuf[i]);
+            uplwBuf[i] = NULL;
+        }
+    }
+    if(uplwToWriter) vQueueDelete(uplwToWriter);
+    if(uplwToFiller) vQueueDelete(uplwToFiller);
+    uplwToWriter = uplwToFiller = NULL;
+    uplwTask = NULL;
+    uplwBufSize = 0;
+}
+
+// If this fails, we write unbuffered
+static void uplwBegin(File& file, const char *truncName)
+{
+    int idx = 1;
+
+    uplwFile = &file;
+    uplwFill = uplwTotal = 0;
+    uplwCur = 0;
+    uplwErr = false;
+    uplwTruncName = truncName;
+
+    for(uplwBufSize = UPLW_BUFSIZE; uplwBufSize >= UPLW_BUFSIZE_LO; uplwBufSize >>= 1) {
+        if((uplwBuf[0] = (uint8_t *)malloc(uplwBufSize))) {
+            if((uplwBuf[1] = (uint8_t *)malloc(uplwBufSize))) break;
+            free(uplwBuf[0]);
+            uplwBuf[0] = NULL;
+        }
+    }
+    if(!uplwBuf[1]) {
+        uplwBufSize = 0;
+        return;
+    }
+
+    uplwToWriter = xQueueCreate(2, sizeof(uplwMsg));
+    uplwToFiller = xQueueCreate(3, sizeof(int));
+    if(uplwToWriter && uplwToFiller) {
+        if(xTaskCreate(uplwWriter, "fcUplW", 4096, NULL, 1, &uplwTask) == pdPASS) {
+            // buf[1] is free, buf[0] is being filled
+            xQueueSend(uplwToFiller, &idx, 0);
+            #ifdef FC_DBG
+            Serial.printf("Upload: Using 2x%d buffers\n", uplwBufSize);
+            #endif
+            return;
+        }
+    }
+
+    uplwFree();
+}
+
+static void uplwSubmit()
+{
+    uplwMsg msg = { uplwCur, uplwFill };
+
+    xQueueSend(uplwToWriter, &msg, portMAX_DELAY);
+    xQueueReceive(uplwToFiller, &uplwCur, portMAX_DELAY);
+    uplwFill = 0;
+}
+
+// Returns len, or 0 if a previous write failed
+static size_t uplwWrite(uint8_t *buf, size_t len)
+{
+    size_t left = len;
+
+    if(!uplwBufSize) {
+        uplwTotal += len;
+        return uplwFile->write(buf, len);
+    }
+
+    if(__atomic_load_n(&uplwErr, __ATOMIC_RELAXED)) return 0;
+
+    while(left) {
+        uint32_t t = uplwBufSize - uplwFill;
+        if(t > left) t = left;
+        memcpy(uplwBuf[uplwCur] + uplwFill, buf, t);
+        uplwFill += t;
+        buf += t;
+        left -= t;
+        if(uplwFill == uplwBufSize) {
+            uplwSubmit();
+        }
+    }
+    uplwTotal += len;
+
+    return len;
+}
+
+// Returns false if any write failed
+static bool uplwEnd()
+{
+    uplwMsg msg = { -1, 0 };
+    int idx;
+
+    if(!uplwBufSize) return true;
+
+    if(uplwFill && !__atomic_load_n(&uplwErr, __ATOMIC_RELAXED)) {
+        uplwSubmit();
+    }
+    xQueueSend(uplwToWriter, &msg, portMAX_DELAY);
+    do {
+        xQueueReceive(uplwToFiller, &idx, portMAX_DELAY);
+    } while(idx >= 0);
+
+    uplwFree();
+
+    return !uplwErr;
+}
+#endif
@@ -57,6 +57,9 @@
 #include <Arduino.h>
 
 #include "src/WiFiManager/WiFiManager.h"
+#ifdef WM_ASSETS
+#include "fc_assets.h"
+#endif
 
 #ifndef WM_MDNS
 #define FC_MDNS
@@ -86,6 +89,9 @@ PubSubClient mqttClient(mqttWClient);
 #endif
 
 static const char R_updateacdone[] = "/uac";
+#ifdef FC_TELEMETRY
+static const char R_metrics[] = "/metrics";
+#endif
 
 static const char acul_part1[]  = "</style>";
 static const char acul_part3[]  = "</head><body><div id='wrap'><h1 id='h1'>";
@@ -189,6 +195,9 @@ static const char badWiFi[]  = "<br><i>Operating in AP mode not recommended</i>"
 
 static const char bannerGen[] = "%s%s%s%s</div>";
 static const char haveNoSD[] = "<i>No SD card present</i>";
+#ifdef FC_SDCAL
+static const char sdCalInfo[] = "SD card: %d.%d MHz, %d.%02d MB/s";
+#endif
 
 #ifdef FC_HAVEMQTT
 static const char mqttStatus[] = "%s%s%s%s%s (%d)</div>";
@@ -288,8 +297,16 @@ static const int8_t wifiMenu[] = {
 static const char apName[] = "FC-AP";
 
 static const char myTitle[] = AA_TITLE;
+#ifdef WM_ASSETS
+// Images, script and style are served from fc_assets.h, which is generated
+// from webassets/ by src/WiFiManager/tools/wm_mkassets.py (see fc_assets.h).
+// The script takes the title from its data-t attribute.
+static const char myHead[]  = "<link rel='icon' type='image/png' href='" FCA_FCICON_PNG "'><script src='" FCA_FC_JS "' data-t='" AA_TITLE "'></script><link rel='stylesheet' href='" FCA_FC_CSS "'>";
+static const char *myCustMenu = "<a href='https://circuitsetup.us' target=_blank><img style='display:block;margin:10px auto 5px auto;' src='" FCA_FCLOGO_PNG "'></a><div style='font-size:0.75em;line-height:1.2em;font-weight:bold;text-align:center;text-transform:uppercase'>" UNI_VERSION " (" UNI_VERSION_EXTRA ")<br>Powered by <a href='https://out-a-ti.me' target=_blank>A10001986</a> <a href='https://" WEBHOME ".out-a-ti.me' target=_blank>[Home/Updates]</a></div>";
+#else
 static const char myHead[]  = "<link rel='icon' type='image/png' href='data:image/png;base64," AA_ICON "'><script>window.onload=function(){xxx='" AA_TITLE "';yyy='?';wr=ge('wrap');if(wr){aa=ge('h3');if(aa){yyy=aa.innerHTML;aa.remove();dlel('h1')}zz=(Math.random()>0.8);dd=document.createElement('div');dd.classList.add('tpm0');dd.innerHTML='<div class=\"tpm\" onClick=\"shsp(1);window.location=\\'/\\'\"><div class=\"tpm2\"><img id=\"spi\" src=\"data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAAEAAAABAAQMAAACQp+OdAAAABlBMVEUAAABKnW0vhlhrAAAAAXRSTlMAQObYZgAAA'+(zz?'GBJREFUKM990aEVgCAABmF9BiIjsIIbsJYNRmMURiASePwSDPD0vPT12347GRejIfaOOIQwigSrRHDKBK9CCKoEqQF2qQMOSQAzEL9hB9ICNyMv8DPKgjCjLtAD+AV4dQM7O4VX9m1RYAAAAABJRU5ErkJggg==':'HtJREFUKM990bENwyAUBuFnuXDpNh0rZIBIrJUqMBqjMAIlBeIihQIF/fZVX39229PscYG32esCzeyjsXUzNHZsI0ocxJ0kcZIOsoQjnxQJT3FUiUD1NAloga6wQQd+4B/7QBQ4BpLAOZAn3IIy4RfUibCgTTDq+peG6AvsL/jPTu1L9wAAAABJRU5ErkJggg==')+'\" class=\"tpm3\"></div><H1 class=\"tpmh1\"'+(zz?' style=\"margin-left:1.4em\"':'')+'>'+xxx+'</H1>'+'<H3 class=\"tpmh3\"'+(zz?' style=\"padding-left:5em\"':'')+'>'+yyy+'</div></div>';wr.insertBefore(dd,wr.firstChild);wr.style.position='relative'}var lc=ge('lc');if(lc){lc.style.transform='rotate('+(358+[0,1,3,4,5][Math.floor(Math.random()*4)])+'deg)'}}</script><style>H1{font-family:Bahnschrift,-apple-system,'Segoe UI Semibold',Roboto,'Helvetica Neue',Arial,Verdana,sans-serif;margin:0;text-align:center;}H3{margin:0 0 5px 0;text-align:center;}input{border:thin inset}em > small{display:inline}form{margin-block-end:0;}.tpm{background-color:#fff;cursor:pointer;border:1px solid black;border-radius:5px;padding:0 0 0 0px;min-width:18em;}.tpm2{position:absolute;top:-0.7em;z-index:130;left:0.7em;}.tpm3{width:4em;height:4em;}.tpmh1{font-variant-caps:all-small-caps;font-weight:normal;margin-left:2.2em;overflow:clip;}.tpmh3{background:#000;font-size:0.6em;color:#ffa;padding-left:7.2em;margin-left:0.5em;margin-right:0.5em;border-radius:5px;overflow:hidden;white-space:nowrap}.tpm0{position:relative;width:20em;padding:5px 0px 5px 0px;margin:0 auto 0 auto;}.cmp0{margin:0;padding:0;}.sel0{font-size:90%;width:auto;margin-left:10px;vertical-align:baseline;}.mt5{margin-top:5px!important}.mb10{margin-bottom:10px!important}.mb0{margin-bottom:0px!important}.mb15{margin-bottom:15px!important}.ml20{margin-left:20px}.ss>label span{font-size:80%}</style>";
 static const char *myCustMenu = "<a href='https://circuitsetup.us' target=_blank><img style='display:block;margin:10px auto 5px auto;' src='data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAAQsAAAAsCAMAAABFVW1aAAAAQlBMVEUAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAACO4fbyAAAAFXRSTlMAgMBAd0Twu98QIDGuY1KekNBwiMxE8vI7AAAG9klEQVRo3uSY3Y7cIAyFA5EQkP9IvP+r1sZn7CFMdrLtZa1qMxBjH744QDq0lke2abjaNMLycGdJHAaz8VwnvZX0MtRLhm+2mOPLkrpmFsMNWG6UvLw7g1c2ZcjgToSFTRDqRFipFlztdUVsuyTwBea0y7zDJoHEPEiuobZqavoxiseCVh27cgyLWV42VtdT7npuWHpTogPi+iYmLtCLWUGZKSpbZl+IZW4Rui3RJgFhR3rKAt4WKEw18XsggXDyeHFMdez2I4vjIQvFBlve9W7GYtTwDYscNAg8EMNZ1scsIAaBAHuIBbZLgwZi+gtdpBF+ZFHyYxZwtYa3WMriKLChYbEVmNSF9+wXRVl0Dq2WRXRsth403l4yOuchZuHrtvOEEw9nJLM4OvwlW68sNseWZfonfDN1QcDYKOF4bg/qGt2Ocb7eidSYXyxyVUSBkNyx0fMP7OTmEuAoOifkFlapYSH9rcGbgUcNtMgUZ4FwSmuvjl4QU2MGi+3KAqiFxSEZNFWnRKojBQRExSOVa5XpErQuknyACa9hcjqFbM8BL/v4lAUiI1ASgSRpQ6a9ehzcRyY6wSLcs2DLj1igCx4zTR85WmWjhu9YnJaVuyEeAcdfsdiKFRgEJsmAgbiH+fkXdUq5/sji/C0LTPOWxfmZxdyw0IBWF9NjFpGiNXWxGMy5VsRETf7juZdvSakQ/nsWPpT5X1ns+pREQ1g/sWDfexYzx7iwCJ5subKIsnatGuhkjGBhWblJfY49bYc4SrywODjJVINFEpE6FqZEWWS8h/07kqJVJXY2n1+qOMguAyjv+JFFlPV3+7inuisLdCOQbkFXFpGaRIlxICFLd4St21PtWEb/ehamBPvIVt6X/YS1s94JHOVyvgh2dGBPPV/sysJ2OlhIv2ARJwTCXHoWnjnRL8o52ilqouY9i1TK/JWFnWHsMZ7qxalsiqeGNxZ2HD37ukCIPDxjEbwvoG/Hzp7FRkPnEqk+/KnvtadmvGfB1fudBX43j9G85qQsyKaj3r+wGPJcG7lnEXyUeE/Xzux1hfKcrGMhl9mTsy9HnTzG7tR9u4/wUWX7tnZGj927O4NHH+GqLFAaI1SZjXJe+7B2Tgj4iAVyTQgUpGBtH9GNiUTvPPmNs75lumeRiPHXfQQ7urKYR3g5ZlmysjAYZ8eiCnHqGHQxxib5OxajBFJlryl6dTm4x2FftUz3LCrI7yxW++D1ptcOOS0L7nM9Cxbi4YhaQMCdGumvWEAZcCK1rgUrO0UuIs30I4vlOws74vYshqNdO9nWri4MERzTYbs+wGCOHQvrhXfajIUq28RrBxrq5g68FDZ2+pFFesICpdizkBciKwtPQtLcrRc7DmVg4T2S9idJYxE82269to/YSVeVrdx5MIFgy3+S+ojNmbU/a/lJvxh7FqYELFCKn1hkcQBYWWj1P098NVbAuwWWPJi9xXhJWhYwf2EBm6/fqcPRbHiMCGUDyZqp31OtyM6ehSkBi+ZTCtZ/pzIy2P4ufMgWz1iclxVg+QWLYJWYcGadAgaYq0eg/ZLpnkV+wAJfDD2L5oOAqYsdqWGx2LEILOI8NikDXR+z8LueaKBMTzAB86wpPerDXTLdsxiOrywQe/nIIr8vie5gQVWrsaDRtYLnPPxn9ocdOxYAAABAANafv28EGWwYO43fBgAAWDNWszMpCATr0E0Dih6g3v9VV76eBXWdwx5MvjqMTVI/Y2WAZH49crVd0SECh0oGsugxHChntq62F1etx1PKwXOSytI91Neirh8jUFar+eY01f5I8mN+kQwOillVvIjIA9n/q4FDqIBSjqGjTvLGjgUaeEBAg7LDIIwHgeJriuvHiLWP4e401Z7U+JO/nSQjofryRZQN0oNTsIcuFFvgJBsXLNILlKxr9i7kI+oDJak2qua/erhVYdtyqXenqfak2hXGs2RwGBO2glfhYbvJYxewcxf+cgtXX1+6sJDQF664dbFywcBwmurRQQW4XiSzi4zXIdygzKcumln7vEuO4cxkrMm/3egimhk6l/XahRt5XaPRm5OrZ1Jo2ChnyeCsZBO8iyUYEAWnLn4gPsQNE6WR7dZFRxfpznzvouOhi+nkjJm0MlXms2RwkkSy4k0soSVIUN25/LNH9v2eno2qrA97RFNYv+4RYwIenFw9kwpLi1eJc3yMxHvwKiDssIfzIjIja/6QD2rtLx0WoNy7gPC5C68VSBscw2mqPQmZK+tFMhK6V3u1C2Mzq32S53uEu180HS3YGkKCMFhjmedFdVH82kUKbBYiHMNpqj2pW3C7Sj6cxLgaDS/Cxg/i6z2iowuJn/NDAmnLPC/MudvXLrAYGdxmOl3V1j8qeZN8OGn3zP/BH6Wx/qV3/+q3AAAAAElFTkSuQmCC'></a><div style='font-size:0.75em;line-height:1.2em;font-weight:bold;text-align:center;text-transform:uppercase'>" UNI_VERSION " (" UNI_VERSION_EXTRA ")<br>Powered by <a href='https://out-a-ti.me' target=_blank>A10001986</a> <a href='https://" WEBHOME ".out-a-ti.me' target=_blank>[Home/Updates]</a></div>";
+#endif
 static const char r_link[]  = WEBHOME "r.out-a-ti.me";
 
 static char newversion[8];
@@ -333,6 +350,8 @@ static bool haveAC = false;
 static int  numUploads = 0;
 static int  *ACULerr = NULL;
 static int  *opType = NULL;
+static unsigned long uplStart = 0;
+static uint32_t uplBytes = 0;
 
 #ifdef FC_HAVEMQTT
 #define       MQTT_SHORT_INT  (30*1000)
@@ -389,6 +408,9 @@ static void setupWebServerCallback();
 static void handleUploadDone();
 static void handleUploading();
 static void handleUploadDone();
+#ifdef FC_TELEMETRY
+static void handleMetrics();
+#endif
 
 #ifdef FC_HAVEMQTT
 static void strcpyutf8(char *dst, const char *src, unsigned int len);
@@ -614,6 +636,8 @@ void wifi_setup()
     // Connect, but defer starting the CP
     wifiConnect(true);
 
+    BOOTPROF("wifi_connect");
+
     #ifdef FC_MDNS
     if(MDNS.begin(settings.hostName)) {
         MDNS.addService("http", "tcp", 80);
@@ -728,6 +752,8 @@ void wifi_setup()
  */
 void wifi_loop()
 {
+    TELEM_SPAN(TELEM_WIFI);
+    
     char oldCfgOnSD = 0;
 
 #ifdef FC_HAVEMQTT
@@ -1698,8 +1724,16 @@ static const char *wmBuildHaveSD(const char *dest, int op)
         return NULL;
     }
     
-    if(haveSD)
+    if(haveSD) {
+        #ifdef FC_SDCAL
+        if(sdKBps) {
+            char buf[64];
+            snprintf(buf, sizeof(buf), sdCalInfo, sdClock / 1000000, (sdClock / 100000) % 10, sdKBps / 1000, (sdKBps / 10) % 100);
+            return buildBanner(buf, col_gr, op);
+        }
+        #endif
         return NULL;
+    }
 
     return buildBanner(haveNoSD, col_r, op);
 }
@@ -1825,15 +1859,50 @@ static void allocUplArrays()
 static void setupWebServerCallback()
 {
     wm.server->on(R_updateacdone, HTTP_POST, &handleUploadDone, &handleUploading);
+
+    #ifdef WM_ASSETS
+    wm.addStaticAssets(fcAssets, FCA_COUNT);
+    #endif
+
+    #ifdef FC_TELEMETRY
+    wm.server->on(R_metrics, HTTP_GET, &handleMetrics);
+    #endif
+}
+
+#ifdef FC_TELEMETRY
+static void handleMetrics()
+{
+    int size = 4096, l;
+    char *buf = (char *)malloc(size);
+
+    if(!buf) {
+        wm.server->send(503, "text/plain", "");
+        return;
+    }
+
+    if((l = telemFormat(buf, size)) < 0) {
+        wm.server->send(500, "text/plain", "");
+    } else {
+        wm.server->sendHeader("Cache-Control", "no-store");
+        wm.server->send(200, "text/plain; version=0.0.4", buf);
+    }
+
+    free(buf);
 }
+#endif
 
-static void doCloseACFile(int idx, bool doRemove)
+// Returns false if closing revealed a write error
+static bool doCloseACFile(int idx, bool doRemove)
 {
+    bool ret = true;
+    
     if(haveACFile) {
-        closeACFile(acFile);
+        ret = closeACFile(acFile);
         haveACFile = false;
     }
-    if(doRemove) removeACFile(idx);  
+    if(doRemove) removeACFile(idx);
+
+    return ret;
 }
 
 static void handleUploading()
@@ -1878,9 +1947,14 @@ static void handleUploading()
               if(!numUploads) {
                   allocUplArrays();
                   preUpdateCallback();
+                  uplStart = millis();
+                  uplBytes = 0;
               }
+
+              // Request size as size hint for first file
+              size_t sizeHint = numUploads ? 0 : wm.server->header("Content-Length").toInt();
     
-              haveACFile = openUploadFile(c, acFile, numUploads, haveAC, opType[numUploads], ACULerr[numUploads]);
+              haveACFile = openUploadFile(c, acFile, numUploads, haveAC, opType[numUploads], ACULerr[numUploads], sizeHint);
 
               if(haveACFile && opType[numUploads] == 1) {
                   haveAC = true;
@@ -1894,6 +1968,8 @@ static void handleUploading()
               if(writeACFile(acFile, upload.buf, upload.currentSize) != upload.currentSize) {
                   doCloseACFile(numUploads, true);
                   ACULerr[numUploads] = UPL_WRERR;
+              } else {
+                  uplBytes += upload.currentSize;
               }
           }
 
@@ -1901,9 +1977,10 @@ static void handleUploading()
 
         if(numUploads < MAX_SIM_UPLOADS) {
 
-            doCloseACFile(numUploads, false);
-    
-            if(opType[numUploads] >= 0) {
+            if(!doCloseACFile(numUploads, false)) {
+                removeACFile(numUploads);
+                ACULerr[numUploads] = UPL_WRERR;
+            } else if(opType[numUploads] >= 0) {
                 renameUploadFile(numUploads);
             }
     
@@ -1932,6 +2009,7 @@ static void handleUploadDone()
     bool haveErrs = false;
     bool haveAC = false;
     int titStart = -1;
+    char rate[64];
     int buflen  = strlen(wm.getHTTPSTART(titStart)) +  // includes </title>
                   STRLEN(myTitle)    +
                   strlen(wm.getHTTPSCRIPT()) +
@@ -1980,6 +2058,16 @@ static void handleUploadDone()
         } else {
             buflen += strlen(wm.getHTTPSTYLEOK());
             buflen += STRLEN(acul_part7);
+            if(numUploads) {
+                unsigned long ms = millis() - uplStart;
+                if(!ms) ms = 1;
+                snprintf(rate, sizeof(rate), "<br>%u KB in %lu.%lus (%u KB/s)",
+                    uplBytes / 1024, ms / 1000, (ms % 1000) / 100,
+                    (uint32_t)(((uint64_t)uplBytes * 1000) / ms / 1024));
+            } else {
+                *rate = 0;
+            }
+            buflen += strlen(rate);
         }
         if(haveAC) {
             buflen += STRLEN(acul_part7a);
@@ -2029,6 +2117,7 @@ static void handleUploadDone()
                 }
             } else {
                 strcat(buf, acul_part7);
+                strcat(buf, rate);
             }
             if(haveAC) {
                 strcat(buf, acul_part7a);
@@ -2346,45 +2435,35 @@ static void mqttCallback(char *topic, byte *payload, unsigned int length)
             // sound (if to be played)
             // We don't ignore this if TCD is connected by wire,
             // because this signal does not come via wire.
-            doPrepareTT = true;
+            fcPostEvent(FCEV_PREPARE_TT);
             break;
         case 1:
             // Trigger Time Travel (if not running already)
-            // Ignore command if TCD is connected by wire
-            if(!TCDconnected && !TTrunning && !IRLearning && !fcBusy) {
-                networkTimeTravel = true;
-                networkTCDTT = true;
-                networkReentry = false;
-                networkAbort = false;
+            // Conditions are checked in main_loop()
+            {
+                uint32_t lead = ETTO_LEAD, p1 = 6600;
                 if(strlen(tempBuf) == 20) {
-                    networkLead = a2i(&tempBuf[11]);
-                    networkP1 = a2i(&tempBuf[16]);
-                } else {
-                    networkLead = ETTO_LEAD;
-                    networkP1 = 6600;
+                    lead = a2i(&tempBuf[11]) & 0xffff;
+                    p1 = a2i(&tempBuf[16]) & 0xffff;
                 }
+                fcPostEvent(FCEV_NET_TT, lead | (p1 << 16));
             }
             break;
         case 2:   // Re-entry
             // Start re-entry (if TT currently running)
-            // Ignore command if TCD is connected by wire
-            if(!TCDconnected && TTrunning && networkTCDTT) {
-                networkReentry = true;
-            }
+            fcPostEvent(FCEV_NET_REENTRY, 0);
             break;
         case 3:   // Abort TT (TCD fake-powered down during TT)
-            // Ignore command if TCD is connected by wire
-            // (mainly because this is no network-triggered TT)
-            if(!TCDconnected && TTrunning && networkTCDTT) {
-                networkAbort = true;
-            }
+            // (Ignored if TCD is connected by wire, mainly 
+            // because this is no network-triggered TT)
+            fcPostEvent(FCEV_NET_ABORT, 0);
             break;
         case 4:
-            networkAlarm = true;
+            fcPostEvent(FCEV_ALARM);
             // Eval this at our convenience
             break;
         case 5:
-            doWakeup = true;
+            fcPostEvent(FCEV_WAKEUP);
             break;
         }
        
@@ -2427,7 +2506,7 @@ static void mqttCallback(char *topic, byte *payload, unsigned int length)
             break;
         case 9:
         case 10:
-            networkUserSignal = i - 8;
+            fcPostEvent(FCEV_USERSIG, i - 8);
             // Eval this at our convenience
             break;
         case 11:
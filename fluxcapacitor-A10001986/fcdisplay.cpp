@@ -57,6 +57,9 @@
 #include <Arduino.h>
 
 #include "fcdisplay.h"
+#ifdef FC_TELEMETRY
+#include "fc_main.h"
+#endif
 
 /*
  * PWM LED class for Center and Box LEDs
@@ -413,6 +416,10 @@ static void IRAM_ATTR updateShiftRegister(byte val)
 // ISR: Play sequences
 static void IRAM_ATTR FCLEDTimer_ISR()
 {
+     #ifdef FC_TELEMETRY
+     TELEM_SPAN(TELEM_ISR_FCLED);
+     #endif
+     
      if(_critical)
         return;
      
@@ -707,11 +707,22 @@ void setup()
     Serial.println();
 
     main_boot();
+    BOOTPROF("main_boot");
     settings_setup();
+    BOOTPROF("settings_setup");
+    #ifdef FC_FASTBOOT
+    audio_preload();
+    #endif
     wifi_setup();
+    BOOTPROF("wifi_setup");
     audio_setup();
+    BOOTPROF("audio_setup");
     main_setup();
+    BOOTPROF("main_setup");
     bttfn_loop();
+    #ifdef FC_BOOTPROF
+    bootProfDump();
+    #endif
 }
 
 void loop()
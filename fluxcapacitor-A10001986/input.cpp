@@ -53,9 +53,14 @@
  * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include "fc_global.h"
+
 #include <Arduino.h>
 
 #include "input.h"
+#ifdef FC_TELEMETRY
+#include "fc_main.h"
+#endif
 
 /*
  * IRRemote class
@@ -86,6 +91,10 @@ static volatile uint32_t _irbuf[IRBUFSIZE];
 // Record duration of marks/spaces through a simple state machine
 static void IRAM_ATTR IRTimer_ISR()
 {
+    #ifdef FC_TELEMETRY
+    TELEM_SPAN(TELEM_ISR_IR);
+    #endif
+    
     uint8_t irpin = (uint8_t)digitalRead(_ir_pin);
 
     _cnt++;
@@ -23,6 +23,13 @@
 
 #include "AudioGeneratorMP3.h"
 
+// Sample loop in IRAM with libmad's top placement tier
+#if defined(ESP32) && defined(OPT_IRAM) && OPT_IRAM > 2
+#define MP3_IRAM IRAM_ATTR
+#else
+#define MP3_IRAM
+#endif
+
 AudioGeneratorMP3::AudioGeneratorMP3()
 {
   running = false;
@@ -195,12 +202,12 @@ bool AudioGeneratorMP3::DecodeNextFrame()
   return true;
 }
 
-bool AudioGeneratorMP3::GetOneSample(int16_t& saL, int16_t& saR)
+bool MP3_IRAM AudioGeneratorMP3::GetOneSample(int16_t& saL, int16_t& saR)
 {
   // If we're here, we have one decoded frame and sent 0 or more samples out
   if (samplePtr < synth->pcm.length) {
     saL = synth->pcm.samples[0][samplePtr];
-    saR = synth->pcm.samples[1][samplePtr];
+    saR = (synth->pcm.channels == 1) ? saL : synth->pcm.samples[1][samplePtr];
     samplePtr++;
   } else {
     samplePtr = 0;
@@ -227,14 +234,14 @@ bool AudioGeneratorMP3::GetOneSample(int16_t& saL, int16_t& saR)
 
     // for IGNORE and CONTINUE, just play what we have now
     saL = synth->pcm.samples[0][samplePtr];
-    saR = synth->pcm.samples[1][samplePtr];
+    saR = (synth->pcm.channels == 1) ? saL : synth->pcm.samples[1][samplePtr];
     samplePtr++;
   }
   return true;
 }
 
 
-bool AudioGeneratorMP3::loop()
+bool MP3_IRAM AudioGeneratorMP3::loop()
 {
   if (!running) goto done; // Nothing to do here!
 
@@ -288,6 +295,13 @@ done:
   return running;
 }
 
+void AudioGeneratorMP3::SetDecodeMode(int mode)
+{
+  decodeOptions = 0;
+  if (mode & MODE_MONO) decodeOptions |= MAD_OPTION_SINGLECHANNEL;
+  if (mode & MODE_HALFRATE) decodeOptions |= MAD_OPTION_HALFSAMPLERATE;
+}
+
 bool AudioGeneratorMP3::begin(AudioFileSource *source, AudioOutput *output)
 {
   if (!source)  return false;
@@ -378,7 +392,7 @@ bool AudioGeneratorMP3::begin(AudioFileSource *source, AudioOutput *output)
   mad_frame_init(frame);
   mad_synth_init(synth);
   synth->pcm.length = 0;
-  mad_stream_options(stream, 0); // TODO - add options support
+  mad_stream_options(stream, decodeOptions);
   madInitted = true;
 
   running = true;
@@ -40,6 +40,12 @@ class AudioGeneratorMP3 : public AudioGenerator
     virtual bool isRunning() override;
     virtual void desync () override;
 
+    // Decoder quality; takes effect at next begin()
+    // MONO: synthesize one channel (downmix of both)
+    // HALFRATE: synthesize at half the sample rate
+    enum { MODE_FULL = 0, MODE_MONO = 1, MODE_HALFRATE = 2 };
+    void SetDecodeMode(int mode);
+
     static constexpr int preAllocSize () { return preAllocBuffSize() + preAllocStreamSize() + preAllocFrameSize() + preAllocSynthSize(); }
     static constexpr int preAllocBuffSize () { return ((buffLen + 7) & ~7); }
     static constexpr int preAllocStreamSize () { return ((sizeof(struct mad_stream) + 7) & ~7); }
@@ -80,6 +86,7 @@ class AudioGeneratorMP3 : public AudioGenerator
 
   private:
     int unrecoverable = 0;
+    int decodeOptions = 0;
 };
 
 #endif
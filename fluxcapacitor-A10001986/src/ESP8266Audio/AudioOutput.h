@@ -30,7 +30,11 @@
 class AudioOutput
 {
   public:
+    #ifndef TWESP32
     AudioOutput() { };
+    #else
+    AudioOutput() { gainL = gainR = gainTgtL = gainTgtR = 0; gainRamp = 0; };
+    #endif
     virtual ~AudioOutput() {};
     virtual bool SetRate(int hz) { hertz = hz; return true; }
     virtual bool SetBitsPerSample(int bits) { bps = bits; return true; }
@@ -43,15 +47,22 @@ class AudioOutput
               return true;
     }
     #else
+    // TW: Only sets the target; the gain is ramped there
+    // linearly within AO_GAINRAMP samples (see StepGain()).
     virtual bool SetGain(float f1, int mutechnls = 0) {
-              int16_t g;
-              // TW: We know the limits. Also, 4.0 would be 0, hence mute.
+              int32_t g, tL, tR;
+              // TW: We know the limits.
               //if (f1>4.0) f1 = 4.0; if (f1<0.0) f1=0.0;
-              g = (int16_t)(f1*(1<<6));
-              if(!mutechnls)           gainF2P6_R = gainF2P6_L = g;
-              else if(mutechnls > 0) { gainF2P6_R = g; gainF2P6_L = 0; }
-              else {                   gainF2P6_L = g; gainF2P6_R = 0; }
-              gainF2P6_R <<= 10;
+              g = (int32_t)(f1*(1<<14));
+              if(!mutechnls)           { tR = tL = g; }
+              else if(mutechnls > 0)   { tR = g; tL = 0; }
+              else                     { tL = g; tR = 0; }
+              if(tL == gainTgtL && tR == gainTgtR) return true;
+              gainTgtL = tL;
+              gainTgtR = tR;
+              gainStepL = (tL - gainL) / AO_GAINRAMP;
+              gainStepR = (tR - gainR) / AO_GAINRAMP;
+              gainRamp = AO_GAINRAMP;
               return true;
     }
     #endif
@@ -100,13 +111,25 @@ class AudioOutput
       else return (int16_t)(v&0xffff);
     }
     #else
+    // TW: Call once per consumed sample
+    inline void StepGain() {
+      if (gainRamp) {
+        if (--gainRamp) {
+          gainL += gainStepL;
+          gainR += gainStepR;
+        } else {
+          gainL = gainTgtL;
+          gainR = gainTgtR;
+        }
+      }
+    }
     inline void AmplifyL(int16_t& s) {
-      int32_t v = (s * gainF2P6_L) >> 6;
+      int32_t v = (s * gainL) >> 14;
       // TW: We NEVER amplify, we only ever attenuate
       s = v;
     }
     inline int32_t AmplifyR(int16_t s) {
-      return (s * gainF2P6_R) & 0xffff0000;
+      return (s * (gainR << 2)) & 0xffff0000;
       // TW: We NEVER amplify, we only ever attenuate
     }
     #endif
@@ -118,8 +141,10 @@ class AudioOutput
     #ifndef TWESP32
     uint8_t gainF2P6; // Fixed point 2.6
     #else
-    int16_t gainF2P6_L; // Fixed point 2.6
-    int32_t gainF2P6_R; // Fixed point 2.6
+    int32_t gainL, gainR;         // Fixed point 2.14
+    int32_t gainTgtL, gainTgtR;
+    int32_t gainStepL, gainStepR;
+    uint16_t gainRamp;            // Samples left in ramp
     #endif
 };
 
@@ -23,6 +23,8 @@
 #include <Arduino.h>
 #ifdef ESP32
   #include "driver/i2s.h"
+  #include "esp_timer.h"
+  #include "esp_idf_version.h"
 #elif defined(ARDUINO_ARCH_RP2040) || ARDUINO_ESP8266_MAJOR >= 3
   #include <I2S.h>
 #elif ARDUINO_ESP8266_MAJOR < 3
@@ -30,6 +32,14 @@
 #endif
 #include "AudioOutputI2S.h"
 
+// Underruns from the driver: TX_Q_OVF is sent when the DMA
+// finished a buffer while all others were free, ie ran dry
+#ifdef ESP32
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0)
+#define AO_UR_EVENTS
+#endif
+#endif
+
 #if defined(ESP32) || defined(ESP8266)
 AudioOutputI2S::AudioOutputI2S(int port, int output_mode, int dma_buf_count, int use_apll)
 {
@@ -51,6 +61,23 @@ AudioOutputI2S::AudioOutputI2S(int port, int output_mode, int dma_buf_count, int
   bclkPin = 26;
   wclkPin = 25;
   doutPin = 22;
+  #ifdef TWESP32
+  hold = false;
+  i2sPaused = false;
+  #endif
+  #if defined(TWESP32) && defined(AO_FIRSTWRITE)
+  firstArmed = false;
+  firstWriteUs = 0;
+  #endif
+  #if defined(TWESP32) && defined(AO_UNDERRUNS)
+  urSynced = false;
+  underruns = 0;
+  urLastMs = 0;
+  urEvents = NULL;
+  #ifdef AO_ADAPTIVEDMA
+  trackUnderruns = trackFrames = cleanFrames = 0;
+  #endif
+  #endif
   SetGain(1.0);
 }
 
@@ -116,6 +143,9 @@ AudioOutputI2S::~AudioOutputI2S()
   #endif
   i2sOn = false;
   */
+  #ifdef TWESP32
+  hold = false;
+  #endif
   stop();
 }
 
@@ -165,6 +195,18 @@ bool AudioOutputI2S::SetLsbJustified(bool lsbJustified)
 bool AudioOutputI2S::begin(bool txDAC)
 {
   #ifdef ESP32
+    #ifdef TWESP32
+    if (i2sPaused)
+    {
+      // Driver kept by stop() (hold): just restart DMA
+      #if defined(AO_UNDERRUNS) && defined(AO_UR_EVENTS)
+      if (urEvents) xQueueReset(urEvents);
+      #endif
+      i2s_start((i2s_port_t)portNo);
+      i2sPaused = false;
+      i2sOn = true;
+    }
+    #endif
     if (!i2sOn)
     {
       if (use_apll == APLL_AUTO)
@@ -179,6 +221,10 @@ bool AudioOutputI2S::begin(bool txDAC)
         }
       }
 
+      #if defined(TWESP32) && defined(AO_UNDERRUNS) && defined(AO_ADAPTIVEDMA)
+      AdaptDMA();
+      #endif
+
       i2s_mode_t mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX);
       if (output_mode == INTERNAL_DAC)
       {
@@ -237,7 +283,12 @@ bool AudioOutputI2S::begin(bool txDAC)
       #ifdef HAVE_AUDIO_LOGGER
       audioLogger->printf("+%d %p\n", portNo, &i2s_config_dac);
       #endif
+      #if defined(TWESP32) && defined(AO_UNDERRUNS) && defined(AO_UR_EVENTS)
+      urEvents = NULL;
+      if (i2s_driver_install((i2s_port_t)portNo, &i2s_config_dac, 8, &urEvents) != ESP_OK)
+      #else
       if (i2s_driver_install((i2s_port_t)portNo, &i2s_config_dac, 0, NULL) != ESP_OK)
+      #endif
       {
         #ifdef HAVE_AUDIO_LOGGER
         audioLogger->println("ERROR: Unable to install I2S driver\n");
@@ -291,6 +342,9 @@ bool AudioOutputI2S::begin(bool txDAC)
     }
   #endif
   i2sOn = true;
+  #if defined(TWESP32) && defined(AO_UNDERRUNS)
+  urSynced = false;
+  #endif
   SetRate(hertz); // Default
   return true;
 }
@@ -327,6 +381,44 @@ size_t AudioOutputI2S::ConsumeSample(int16_t msL, int16_t msR)
 
     size_t i2s_bytes_written;
     i2s_write((i2s_port_t)portNo, (const char*)&s32, sizeof(uint32_t), &i2s_bytes_written, 0);
+
+    if(i2s_bytes_written) {
+        StepGain();
+        #ifdef AO_FIRSTWRITE
+        if(firstArmed) {
+            firstWriteUs = esp_timer_get_time();
+            firstArmed = false;
+        }
+        #endif
+    }
+
+    #ifdef AO_UNDERRUNS
+    // Underrun detection: When the write fails, the DMA buffers
+    // are full; this is our sync point. With AO_UR_EVENTS, the
+    // driver tells us when it ran dry (see loop()). Otherwise:
+    // From the sync point, the DMA consumes "hertz" frames per 
+    // second; if that exceeds what was buffered at sync plus what 
+    // we wrote since, the DMA ran dry. Checked once per DMA 
+    // buffer (64 frames).
+    if(i2s_bytes_written) {
+        #ifdef AO_ADAPTIVEDMA
+        trackFrames++;
+        #endif
+        #ifndef AO_UR_EVENTS
+        if(urSynced && !(++urFrames & 63)) {
+            int64_t played = ((esp_timer_get_time() - urSyncUs) * hertz) / 1000000;
+            if(played > (int64_t)urFrames + (dma_buf_count + 1) * 64) {
+                Underrun();
+            }
+        }
+        #endif
+    } else {
+        urSynced = true;
+        urSyncUs = esp_timer_get_time();
+        urFrames = 0;
+    }
+    #endif
+
     return i2s_bytes_written;
 }
 #else
@@ -391,10 +483,32 @@ void AudioOutputI2S::flush()
 
 bool AudioOutputI2S::stop()
 {
+  #if defined(ESP32) && defined(TWESP32)
+  if (!i2sOn && !i2sPaused)
+    return false;
+  #else
   if (!i2sOn)
     return false;
+  #endif
 
   #ifdef ESP32
+    #ifdef TWESP32
+    bool pause = hold && i2sOn;
+    #if defined(AO_UNDERRUNS) && defined(AO_ADAPTIVEDMA)
+    if (trackUnderruns) pause = false;    // reinstall to grow ring
+    #endif
+    if (pause) {
+      i2s_zero_dma_buffer((i2s_port_t)portNo);
+      i2s_stop((i2s_port_t)portNo);
+      i2sPaused = true;
+      i2sOn = false;
+      #ifdef AO_UNDERRUNS
+      urSynced = false;
+      #endif
+      return true;
+    }
+    i2sPaused = false;
+    #endif
     i2s_zero_dma_buffer((i2s_port_t)portNo);
     i2s_driver_uninstall((i2s_port_t)portNo); //stop & destroy i2s driver
   #elif defined(ESP8266)
@@ -402,6 +516,62 @@ bool AudioOutputI2S::stop()
   #elif defined(ARDUINO_ARCH_RP2040)
     I2S.end();
   #endif
+  #if defined(TWESP32) && defined(AO_UNDERRUNS)
+  urSynced = false;
+  urEvents = NULL;    // deleted with driver
+  #endif
   i2sOn = false;
   return true;
 }
+
+#if defined(TWESP32) && defined(AO_UNDERRUNS)
+bool AudioOutputI2S::loop()
+{
+  #ifdef AO_UR_EVENTS
+  i2s_event_t ev;
+
+  // Count once per episode, and only after the ring was full
+  // once (the DMA also runs dry while it is first filled)
+  if (urEvents) {
+    while (xQueueReceive(urEvents, &ev, 0) == pdTRUE) {
+      if (ev.type == I2S_EVENT_TX_Q_OVF && urSynced) {
+        Underrun();
+      }
+    }
+  }
+  #endif
+  return true;
+}
+
+void AudioOutputI2S::Underrun()
+{
+  underruns++;
+  urLastMs = millis();
+  if (!urLastMs) urLastMs = 1;
+  urSynced = false;
+  #ifdef AO_ADAPTIVEDMA
+  trackUnderruns++;
+  #endif
+}
+
+#ifdef AO_ADAPTIVEDMA
+// Called from begin(), before installing the driver; decides
+// on the ring size based on the previous sound(s)
+void AudioOutputI2S::AdaptDMA()
+{
+  if (trackUnderruns) {
+    dma_buf_count += AO_DMA_GROW;
+    cleanFrames = 0;
+  } else {
+    cleanFrames += trackFrames;
+    if (cleanFrames >= (uint32_t)hertz * AO_DMA_CLEANSECS) {
+      dma_buf_count -= AO_DMA_SHRINK;
+      cleanFrames = 0;
+    }
+  }
+  if (dma_buf_count > AO_DMA_MAX) dma_buf_count = AO_DMA_MAX;
+  if (dma_buf_count < AO_DMA_MIN) dma_buf_count = AO_DMA_MIN;
+  trackUnderruns = trackFrames = 0;
+}
+#endif
+#endif
@@ -51,6 +51,23 @@ class AudioOutputI2S : public AudioOutput
     bool begin(bool txDAC);
     bool SetOutputModeMono(bool mono);  // Force mono output no matter the input
     bool SetLsbJustified(bool lsbJustified);  // Allow supporting non-I2S chips, e.g. PT8211
+    int GetDMABufCount() { return dma_buf_count; }
+    #ifdef TWESP32
+    // hold: stop() only pauses the driver, begin() restarts it
+    // (no driver reinstall and DMA allocation per sound)
+    void SetHold(bool hold) { this->hold = hold; }
+    #endif
+    #if defined(TWESP32) && defined(AO_FIRSTWRITE)
+    // Time (esp_timer_get_time()) of first sample written
+    // after ArmFirstWrite(); 0 while none written yet
+    void ArmFirstWrite() { firstWriteUs = 0; firstArmed = true; }
+    int64_t GetFirstWriteUs() { return firstWriteUs; }
+    #endif
+    #if defined(TWESP32) && defined(AO_UNDERRUNS)
+    virtual bool loop() override;
+    uint32_t GetUnderruns() { return underruns; }
+    uint32_t GetLastUnderrun() { return urLastMs; }  // millis(); 0 if none
+    #endif
 
   protected:
     bool SetPinout();
@@ -69,4 +86,29 @@ class AudioOutputI2S : public AudioOutput
     uint8_t bclkPin;
     uint8_t wclkPin;
     uint8_t doutPin;
+
+    #ifdef TWESP32
+    bool     hold;
+    bool     i2sPaused;
+    #endif
+    #if defined(TWESP32) && defined(AO_FIRSTWRITE)
+    volatile bool firstArmed;
+    volatile int64_t firstWriteUs;
+    #endif
+
+    #if defined(TWESP32) && defined(AO_UNDERRUNS)
+    void Underrun();
+    bool     urSynced;
+    int64_t  urSyncUs;
+    uint32_t urFrames;
+    uint32_t underruns;
+    uint32_t urLastMs;
+    QueueHandle_t urEvents;
+    #ifdef AO_ADAPTIVEDMA
+    void AdaptDMA();
+    uint32_t trackUnderruns;  // since begin()
+    uint32_t trackFrames;
+    uint32_t cleanFrames;
+    #endif
+    #endif
 };
@@ -1,4 +1,6 @@
 
+#include "../../fc_global.h"
+
 // Run optimized versions
 #define TWESP32
 
@@ -6,4 +8,33 @@
 #define AUTO_MONO
 
 // If not AUTO_MONO: Force mono output
-//#define FORCE_MONO
\ No newline at end of file
+//#define FORCE_MONO
+
+// Count DMA underruns (ESP32, TWESP32 only); only wanted
+// for telemetry
+#ifdef FC_TELEMETRY
+#define AO_UNDERRUNS
+#endif
+
+// Timestamp first sample written after ArmFirstWrite() (ESP32,
+// TWESP32 only); for telemetry (trigger latency)
+#ifdef FC_TELEMETRY
+#define AO_FIRSTWRITE
+#endif
+
+// Adapt the number of DMA buffers (64 frames each) at every begin():
+// Grow after a sound with underruns, shrink after AO_DMA_CLEANSECS
+// of underrun-free playback (needs AO_UNDERRUNS, ie FC_TELEMETRY)
+//#define AO_ADAPTIVEDMA
+#define AO_DMA_MIN       8
+#define AO_DMA_MAX       64
+#define AO_DMA_GROW      8
+#define AO_DMA_SHRINK    2
+#define AO_DMA_CLEANSECS 60
+
+// Gain changes are ramped linearly over this many samples (one
+// DMA buffer) to avoid zipper noise (TWESP32 only, >= 1)
+#define AO_GAINRAMP 64
+
+// Count CPU cycles spent mixing (AudioOutputMixer)
+//#define AO_MIXPROF
@@ -0,0 +1,257 @@
+/*
+  AudioOutputMixer
+  Simple mixer which can combine multiple inputs to a single output stream
+
+  Copyright (C) 2018  Earle F. Philhower, III
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  Adapted by Thomas Winischhofer, 2026
+*/
+
+#include <Arduino.h>
+#include "AudioOutputMixer.h"
+
+#ifdef AO_MIXPROF
+#define MIXPROF_BEGIN()    uint32_t _mpc = ESP.getCycleCount()
+#define MIXPROF_END(m)     (m)->mixCycles += ESP.getCycleCount() - _mpc
+#else
+#define MIXPROF_BEGIN()
+#define MIXPROF_END(m)
+#endif
+
+static inline int16_t saturate16(int32_t v)
+{
+  if (v > 32767) return 32767;
+  if (v < -32768) return -32768;
+  return (int16_t)v;
+}
+
+// Stub ----------------------------------------------------------
+
+AudioOutputMixerStub::AudioOutputMixerStub(AudioOutputMixer *sink, int id) : AudioOutput()
+{
+  this->sink = sink;
+  this->id = id;
+  gainL = gainR = gainTgtL = gainTgtR = 1 << 14;
+  hertz = sink->GetRate();
+  step = 1 << 16;
+  phase = 0;
+  lastL = lastR = 0;
+  channels = 2;
+  bps = 16;
+}
+
+AudioOutputMixerStub::~AudioOutputMixerStub()
+{
+  sink->RemoveInput(this);
+}
+
+bool AudioOutputMixerStub::SetRate(int hz)
+{
+  if (hz <= 0) return false;
+  hertz = hz;
+  step = ((uint32_t)hz << 16) / sink->GetRate();
+  return true;
+}
+
+bool AudioOutputMixerStub::begin()
+{
+  phase = 0;
+  lastL = lastR = 0;
+  sink->StartInput(id);
+  return true;
+}
+
+size_t AudioOutputMixerStub::ConsumeSample(int16_t sL, int16_t sR)
+{
+  int32_t l, r;
+
+  if (channels == 1) sR = sL;
+
+  if (sink->Space(id) < 2 + (1 << 16) / step) return 0;
+
+  MIXPROF_BEGIN();
+
+  l = saturate16((sL * gainL) >> 14);
+  r = saturate16((sR * gainR) >> 14);
+  StepGain();
+
+  if (step == (1 << 16)) {
+    sink->Mix(id, l, r);
+  } else {
+    // Emit all output samples between last and this input
+    // sample; positions are linearly interpolated
+    while (phase < (1 << 16)) {
+      int32_t f = phase >> 1;
+      sink->Mix(id, lastL + (((l - lastL) * f) >> 15), lastR + (((r - lastR) * f) >> 15));
+      phase += step;
+    }
+    phase -= 1 << 16;
+    lastL = l;
+    lastR = r;
+  }
+
+  MIXPROF_END(sink);
+
+  return 1;
+}
+
+bool AudioOutputMixerStub::stop()
+{
+  sink->StopInput(id);
+  return true;
+}
+
+// Mixer ---------------------------------------------------------
+
+AudioOutputMixer::AudioOutputMixer(int samples, AudioOutput *sink, int rate) : AudioOutput()
+{
+  this->sink = sink;
+  sinkStarted = false;
+  buffSize = samples;
+  accL = (int32_t *)calloc(buffSize, sizeof(int32_t));
+  accR = (int32_t *)calloc(buffSize, sizeof(int32_t));
+  readPtr = hiPtr = 0;
+  for (int i = 0; i < maxStubs; i++) {
+    writePtr[i] = 0;
+    stubs[i] = NULL;
+    stubRunning[i] = false;
+  }
+  hertz = rate;
+  channels = 2;
+  bps = 16;
+  #ifdef AO_MIXPROF
+  mixFrames = 0;
+  mixCycles = 0;
+  #endif
+}
+
+AudioOutputMixer::~AudioOutputMixer()
+{
+  for (int i = 0; i < maxStubs; i++) {
+    if (stubs[i]) delete stubs[i];
+  }
+  free(accL);
+  free(accR);
+}
+
+bool AudioOutputMixer::SetRate(int hz)
+{
+  hertz = hz;
+  for (int i = 0; i < maxStubs; i++) {
+    if (stubs[i]) stubs[i]->SetRate(stubs[i]->hertz);
+  }
+  if (sinkStarted) sink->SetRate(hz);
+  return true;
+}
+
+AudioOutputMixerStub *AudioOutputMixer::NewInput()
+{
+  if (!accL || !accR) return NULL;
+  for (int i = 0; i < maxStubs; i++) {
+    if (!stubs[i]) {
+      stubs[i] = new AudioOutputMixerStub(this, i);
+      stubRunning[i] = false;
+      return stubs[i];
+    }
+  }
+  return NULL;
+}
+
+void AudioOutputMixer::RemoveInput(AudioOutputMixerStub *stub)
+{
+  for (int i = 0; i < maxStubs; i++) {
+    if (stubs[i] == stub) {
+      stubs[i] = NULL;
+      stubRunning[i] = false;
+    }
+  }
+}
+
+void AudioOutputMixer::StartInput(int id)
+{
+  // New voice mixes in at the current read position
+  writePtr[id] = readPtr;
+  stubRunning[id] = true;
+}
+
+void AudioOutputMixer::StopInput(int id)
+{
+  stubRunning[id] = false;
+}
+
+bool AudioOutputMixer::loop()
+{
+  uint32_t lo = hiPtr, idx;
+  bool running = false;
+  int16_t l, r;
+
+  // Flush as far as all running voices have written; when
+  // none is running anymore, flush what is left
+  for (int i = 0; i < maxStubs; i++) {
+    if (stubRunning[i]) {
+      if (!running || (int32_t)(writePtr[i] - lo) < 0) lo = writePtr[i];
+      running = true;
+    }
+  }
+
+  if (lo != readPtr && !sinkStarted) {
+    sink->SetRate(hertz);
+    sink->SetBitsPerSample(16);
+    sink->SetChannels(2);
+    sinkStarted = sink->begin();
+  }
+
+  if (sinkStarted) {
+    while (readPtr != lo) {
+      MIXPROF_BEGIN();
+      idx = readPtr % buffSize;
+      l = saturate16(accL[idx]);
+      r = saturate16(accR[idx]);
+      MIXPROF_END(this);
+      if (!sink->ConsumeSample(l, r)) break;
+      accL[idx] = accR[idx] = 0;
+      readPtr++;
+      #ifdef AO_MIXPROF
+      mixFrames++;
+      #endif
+    }
+
+    if (!running && readPtr == hiPtr) {
+      sink->stop();
+      sinkStarted = false;
+    }
+
+    sink->loop();
+  }
+
+  return true;
+}
+
+bool AudioOutputMixer::stop()
+{
+  for (int i = 0; i < maxStubs; i++) {
+    stubRunning[i] = false;
+  }
+  while (readPtr != hiPtr) {
+    uint32_t idx = readPtr++ % buffSize;
+    accL[idx] = accR[idx] = 0;
+  }
+  if (sinkStarted) {
+    sink->stop();
+    sinkStarted = false;
+  }
+  return true;
+}
@@ -0,0 +1,110 @@
+/*
+  AudioOutputMixer
+  Simple mixer which can combine multiple inputs to a single output stream
+
+  Copyright (C) 2018  Earle F. Philhower, III
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  Adapted by Thomas Winischhofer, 2026
+*/
+
+#ifndef _AUDIOOUTPUTMIXER_H
+#define _AUDIOOUTPUTMIXER_H
+
+#include "AudioOutput.h"
+
+class AudioOutputMixer;
+
+// Mixer inputs (voices); each generator gets one as its output.
+// Gain is applied (and ramped) per voice; input at a different
+// sample rate is linearly resampled to the mixer rate.
+class AudioOutputMixerStub : public AudioOutput
+{
+  public:
+    AudioOutputMixerStub(AudioOutputMixer *sink, int id);
+    virtual ~AudioOutputMixerStub() override;
+    virtual bool SetRate(int hz) override;
+    virtual bool begin() override;
+    virtual size_t ConsumeSample(int16_t sL, int16_t sR) override;
+    virtual bool stop() override;
+
+  protected:
+    friend class AudioOutputMixer;
+
+    AudioOutputMixer *sink;
+    int id;
+    uint32_t step;      // input samples per output sample, Q16
+    uint32_t phase;     // Q16
+    int32_t  lastL, lastR;
+};
+
+// The mixer sums all running voices into a ring of 32 bit
+// accumulators, and hands saturated samples to the sink as far
+// as all running voices have delivered. The sink is started
+// when there is something to play and stopped when all voices
+// are done.
+class AudioOutputMixer : public AudioOutput
+{
+  public:
+    AudioOutputMixer(int samples, AudioOutput *sink, int rate = 44100);
+    virtual ~AudioOutputMixer() override;
+    virtual bool SetRate(int hz) override;
+    virtual bool begin() override { return true; }
+    virtual size_t ConsumeSample(int16_t sL, int16_t sR) override { (void)sL;(void)sR; return 0; }
+    virtual bool stop() override;
+    virtual bool loop() override;
+
+    AudioOutputMixerStub *NewInput();
+    void RemoveInput(AudioOutputMixerStub *stub);
+
+    #ifdef AO_MIXPROF
+    uint32_t GetMixedFrames() { return mixFrames; }
+    uint64_t GetMixCycles()   { return mixCycles; }
+    #endif
+
+  protected:
+    friend class AudioOutputMixerStub;
+
+    static const int maxStubs = 4;
+
+    int GetRate() { return hertz; }
+    void StartInput(int id);
+    void StopInput(int id);
+    inline uint32_t Space(int id) { return buffSize - (writePtr[id] - readPtr); }
+    inline void Mix(int id, int32_t l, int32_t r) {
+      uint32_t idx = writePtr[id]++ % buffSize;
+      accL[idx] += l;
+      accR[idx] += r;
+      if ((int32_t)(writePtr[id] - hiPtr) > 0) hiPtr = writePtr[id];
+    }
+
+    AudioOutput *sink;
+    bool sinkStarted;
+    uint32_t buffSize;
+    int32_t *accL;
+    int32_t *accR;
+    uint32_t readPtr;
+    uint32_t hiPtr;
+    uint32_t writePtr[maxStubs];
+    AudioOutputMixerStub *stubs[maxStubs];
+    bool stubRunning[maxStubs];
+
+    #ifdef AO_MIXPROF
+    uint32_t mixFrames;
+    uint64_t mixCycles;
+    #endif
+};
+
+#endif
@@ -46,7 +46,13 @@ extern int stackfree();
 /* Define if your MIPS CPU supports a 2-operand MADD16 instruction. */
 /* #undef HAVE_MADD16_ASM */
 
+/* Fixed-point math: FPM_DEFAULT is the portable, lossy variant.
+   FPM_XTENSA (opt-in) keeps the full 64-bit products on the ESP32;
+   more accurate, but a full MLA per tap in the synthesis and IMDCT
+   loops. Its speed has not been measured against FPM_DEFAULT.
+   Takes precedence if both are defined. */
 #define FPM_DEFAULT
+/* #define FPM_XTENSA */
 
 /* Define if your MIPS CPU supports a 2-operand MADD instruction. */
 #define HAVE_MADD_ASM 1
@@ -90,12 +96,76 @@ extern int stackfree();
 /* Define to optimize for accuracy over speed. */
 /* #undef OPT_ACCURACY */
 
-/* Define to optimize for speed over accuracy. */
+/* Define to optimize for speed over accuracy. (Implies OPT_SSO; not
+   wanted with FPM_XTENSA, which keeps full accuracy.) */
 #define OPT_SPEED 1
 
 /* Define to enable a fast subband synthesis approximation optimization. */
 #define OPT_SSO 1
 
+#ifdef FPM_XTENSA
+# undef OPT_SPEED
+# undef OPT_SSO
+#endif
+
+/* Define to requantize Layer III values with small tables in DRAM and
+   interpolation instead of the 32KB rq_table in flash. Approximate
+   (within 2 ULP, see tests/host); off by default until the gain is
+   measured on the device (MAD_PROFILE). */
+/* #define OPT_RQ_COMPACT 1 */
+
+/* Define to decode Layer III Huffman codes through multi-bit lookup
+   tables built in RAM at first use. HUFF_FAST_BITS is the width of the
+   first level (codes up to this length take one probe), HUFF_FAST_BUDGET
+   the RAM used at most, in bytes (allocated at first use, only as much
+   as the tables fitting need); all tables take about 13KB with 6 bits.
+   Tables not fitting are decoded from flash as before. Off by default
+   until the gain is measured on the device (MAD_PROFILE). */
+/* #define OPT_HUFF_FAST 1 */
+#define HUFF_FAST_BITS 6
+#ifndef HUFF_FAST_BUDGET
+# define HUFF_FAST_BUDGET 16384
+#endif
+
+/* Place the hot decode routines and their tables in IRAM/DRAM (ESP32),
+   out of the way of flash cache misses caused by WiFi and web server
+   code. Off by default: IRAM is shared with WiFi and the core, so
+   check the linker map (and MAD_PROFILE cycle counts) before raising
+   this. Tiers, sizes are rough:
+     0: all in flash
+     1: synthesis: synth_full(), dct32(), D[]  (~6KB IRAM, 2KB DRAM)
+     2: + IMDCT and alias reduction            (~4KB IRAM more)
+     3: + Huffman decoding and the AudioGeneratorMP3 sample loop
+                                               (~5KB IRAM more) */
+#define OPT_IRAM 0
+
+/* Define to count CPU cycles per decode stage in mad_prof[]. */
+/* #define MAD_PROFILE */
+
+# if defined(MAD_PROFILE)
+#  ifdef __cplusplus
+extern "C" {
+#  endif
+enum {
+  MAD_PROF_FRAME,	/* mad_frame_decode(), all of it */
+  MAD_PROF_HUFF,	/* III_huffdecode() */
+  MAD_PROF_ALIAS,	/* III_aliasreduce() */
+  MAD_PROF_IMDCT,	/* III_imdct_l() */
+  MAD_PROF_SYNTH,	/* synth_full/half(), including dct32() */
+  MAD_PROF_DCT32,	/* dct32() */
+  MAD_PROF_NUM
+};
+struct mad_prof {
+  unsigned long long cycles;
+  unsigned long calls;
+};
+extern struct mad_prof mad_prof[MAD_PROF_NUM];
+extern char const *const mad_prof_names[MAD_PROF_NUM];
+#  ifdef __cplusplus
+}
+#  endif
+# endif
+
 /* Define to influence a strict interpretation of the ISO/IEC standards, even
    if this is in opposition with best accepted practices. */
 #undef OPT_STRICT
@@ -420,6 +420,62 @@ mad_fixed_t mad_f_mul_inline(mad_fixed_t x, mad_fixed_t y)
 
 #  define MAD_F_SCALEBITS  MAD_F_FRACBITS
 
+/* --- Xtensa (ESP32) ------------------------------------------------------ */
+
+# elif defined(FPM_XTENSA)
+
+/*
+ * This Xtensa LX6 version is as accurate as FPM_64BIT: MULL and MULSH
+ * deliver the full 64-bit product in two instructions, and SRC
+ * extracts the scaled result in one. The MAC16 option is of no use
+ * here, its multipliers are only 16 bits wide.
+ *
+ * The C variant is the portable reference (and is used when building
+ * for anything else than Xtensa); both produce identical results.
+ */
+#  if defined(__XTENSA__)
+#   define MAD_F_MLX(hi, lo, x, y)  \
+    asm ("mull	%0, %2, %3\n\t"  \
+	 "mulsh	%1, %2, %3"  \
+	 : "=&r" (lo), "=&r" (hi)  \
+	 : "%r" (x), "r" (y))
+
+#   if !defined(OPT_ACCURACY)
+#    define mad_f_scale64(hi, lo)  \
+    ({ mad_fixed_t __result;  \
+       asm ("ssai	%3\n\t"  \
+	    "src	%0, %2, %1"  \
+	    : "=r" (__result)  \
+	    : "r" (lo), "r" (hi), "i" (MAD_F_SCALEBITS));  \
+       __result;  \
+    })
+#   endif
+#  else
+#   define MAD_F_MLX(hi, lo, x, y)  \
+    do {  \
+      mad_fixed64_t __p = (mad_fixed64_t) (x) * (y);  \
+      (lo) = (mad_fixed64lo_t) __p;  \
+      (hi) = (mad_fixed64hi_t) (__p >> 32);  \
+    }  \
+    while (0)
+#  endif
+
+/*
+ * Accumulate in 64 bits; the carry out of the low word is derived
+ * from an unsigned compare (LX6 has no add-with-carry).
+ */
+#  define MAD_F_MLA(hi, lo, x, y)  \
+    do {  \
+      mad_fixed64hi_t __hi;  \
+      mad_fixed64lo_t __lo;  \
+      MAD_F_MLX(__hi, __lo, (x), (y));  \
+      (lo) += __lo;  \
+      (hi) += __hi + ((lo) < __lo);  \
+    }  \
+    while (0)
+
+#  define MAD_F_SCALEBITS  MAD_F_FRACBITS
+
 /* --- Default ------------------------------------------------------------- */
 
 # elif defined(FPM_DEFAULT)
@@ -61,6 +61,14 @@ int (*const decoder_table[3])(struct mad_stream *, struct mad_frame *) = {
   mad_layer_III
 };
 
+# if defined(MAD_PROFILE)
+struct mad_prof mad_prof[MAD_PROF_NUM];
+
+char const *const mad_prof_names[MAD_PROF_NUM] = {
+  "frame", "huffdecode", "aliasreduce", "imdct_l", "synth", "dct32"
+};
+# endif
+
 /*
  * NAME:	header->init()
  * DESCRIPTION:	initialize header struct
@@ -433,6 +441,8 @@ int mad_header_decode(struct mad_header *header, struct mad_stream *stream)
  */
 int mad_frame_decode(struct mad_frame *frame, struct mad_stream *stream)
 {
+  MAD_PROF_BEGIN(prof);
+
   frame->options = stream->options;
 
   /* header() */
@@ -471,10 +481,29 @@ int mad_frame_decode(struct mad_frame *frame, struct mad_stream *stream)
     mad_bit_finish(&next_frame);
   }
 
+  /* single channel output: as synthesis is linear, downmixing the
+     subband samples equals mixing the PCM, at half the synthesis cost */
+
+  if ((frame->options & MAD_OPTION_SINGLECHANNEL) == MAD_OPTION_SINGLECHANNEL &&
+      frame->header.mode != MAD_MODE_SINGLE_CHANNEL) {
+    unsigned int ns, s, sb;
+
+    ns = MAD_NSBSAMPLES(&frame->header);
+
+    for (s = 0; s < ns; ++s) {
+      for (sb = 0; sb < 32; ++sb) {
+        frame->sbsample[0][s][sb] = (frame->sbsample[0][s][sb] >> 1) +
+                                    (frame->sbsample[1][s][sb] >> 1);
+      }
+    }
+  }
+
+  MAD_PROF_END(MAD_PROF_FRAME, prof);
   return 0;
 
  fail:
   stream->anc_bitlen = 0;
+  MAD_PROF_END(MAD_PROF_FRAME, prof);
   return -1;
 }
 
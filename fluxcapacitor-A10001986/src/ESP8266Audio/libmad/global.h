@@ -42,6 +42,59 @@
 #  define OPT_SSO
 # endif
 
+/* code and data placement, see OPT_IRAM */
+
+# if defined(ESP32) && defined(OPT_IRAM) && OPT_IRAM > 0
+#  include <esp_attr.h>
+#  define MAD_IRAM1	IRAM_ATTR
+#  define MAD_DRAM1	DRAM_ATTR
+# else
+#  define MAD_IRAM1
+#  define MAD_DRAM1
+# endif
+
+# if defined(ESP32) && defined(OPT_IRAM) && OPT_IRAM > 1
+#  define MAD_IRAM2	IRAM_ATTR
+#  define MAD_DRAM2	DRAM_ATTR
+# else
+#  define MAD_IRAM2
+#  define MAD_DRAM2
+# endif
+
+# if defined(ESP32) && defined(OPT_IRAM) && OPT_IRAM > 2
+#  define MAD_IRAM3	IRAM_ATTR
+# else
+#  define MAD_IRAM3
+# endif
+
+/* cycle counting, see MAD_PROFILE */
+
+# if defined(MAD_PROFILE)
+#  if defined(__XTENSA__)
+static inline unsigned long mad_ccount(void)
+{
+  unsigned long c;
+  __asm__ __volatile__ ("rsr %0, ccount" : "=r" (c));
+  return c;
+}
+#  else
+#   include <time.h>
+/* host builds: nanoseconds */
+static inline unsigned long mad_ccount(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000UL + ts.tv_nsec;
+}
+#  endif
+#  define MAD_PROF_BEGIN(v)	unsigned long v = mad_ccount()
+#  define MAD_PROF_END(id, v)	\
+    (mad_prof[id].cycles += mad_ccount() - (v), ++mad_prof[id].calls)
+# else
+#  define MAD_PROF_BEGIN(v)	do { } while (0)
+#  define MAD_PROF_END(id, v)	do { } while (0)
+# endif
+
 # if defined(HAVE_UNISTD_H) && defined(HAVE_WAITPID) &&  \
     defined(HAVE_FCNTL) && defined(HAVE_PIPE) && defined(HAVE_FORK)
 #  define USE_ASYNC
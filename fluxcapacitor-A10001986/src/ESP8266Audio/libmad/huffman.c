@@ -28,6 +28,17 @@
 
 # include "huffman.h"
 
+# if defined(OPT_HUFF_FAST)
+#  include <stdlib.h>
+#  if defined(ESP32)
+#   include <esp_heap_caps.h>
+/* internal RAM; larger blocks might otherwise end up in PSRAM */
+#   define huff_alloc(n)	heap_caps_malloc((n), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#  else
+#   define huff_alloc(n)	malloc(n)
+#  endif
+# endif
+
 /*
  * These are the Huffman code words for Layer III.
  * The data for these tables are derived from Table B.7 of ISO/IEC 11172-3.
@@ -3108,3 +3119,198 @@ struct hufftable const mad_huff_pair_table[32] PROGMEM = {
   /* 30 */ { hufftab24, 11, 4 },
   /* 31 */ { hufftab24, 13, 4 }
 };
+
+# if defined(OPT_HUFF_FAST)
+
+/*
+ * Fast lookup tables, built at first use from the tables above and
+ * kept in RAM, at most HUFF_FAST_BUDGET bytes. The pool is allocated
+ * at first use, sized to what actually fits the budget. Each starts
+ * with a first level of 2^HUFF_FAST_BITS entries (or 2^startbits,
+ * if more) which resolves all codes up to that length in a single
+ * probe; longer codes continue in a packed copy of the original
+ * table. Tables which do not fit the budget are decoded from the
+ * original tables.
+ */
+
+# if HUFF_FAST_BITS > 10
+#  error "HUFF_FAST_BITS must not exceed 10"
+# endif
+
+struct huffast mad_huff_fast_quad[2];
+struct huffast mad_huff_fast_pair[32];
+
+static unsigned int *huffpool;
+static unsigned int huffsize;	/* in entries */
+static unsigned int huffused;
+static int huffready;
+
+struct huffent {
+  unsigned int final;
+  unsigned int hlen;
+  unsigned int bits;
+  unsigned int offset;
+  unsigned int payload;
+};
+
+static
+void huff_get_quad(void const *table, unsigned int i, struct huffent *e)
+{
+  union huffquad const *q = (union huffquad const *) table + i;
+
+  e->final = q->final;
+  if (e->final) {
+    e->hlen    = q->value.hlen;
+    e->payload = q->value.v | (q->value.w << 1) |
+                 (q->value.x << 2) | (q->value.y << 3);
+  }
+  else {
+    e->bits   = q->ptr.bits;
+    e->offset = q->ptr.offset;
+  }
+}
+
+static
+void huff_get_pair(void const *table, unsigned int i, struct huffent *e)
+{
+  union huffpair const *p = (union huffpair const *) table + i;
+
+  e->final = p->final;
+  if (e->final) {
+    e->hlen    = p->value.hlen;
+    e->payload = p->value.x | (p->value.y << 4);
+  }
+  else {
+    e->bits   = p->ptr.bits;
+    e->offset = p->ptr.offset;
+  }
+}
+
+static
+unsigned int const *huff_build(void const *table, unsigned int size,
+                               unsigned int startbits, unsigned int fbits,
+                               void (*get)(void const *, unsigned int,
+                                           struct huffent *))
+{
+  unsigned int *out, base, i;
+  struct huffent e;
+
+  base = 1U << fbits;
+
+  if (huffused + base + size > huffsize)
+    return 0;
+
+  /* sizing pass: count only */
+  if (!huffpool) {
+    huffused += base + size;
+    return 0;
+  }
+
+  out = &huffpool[huffused];
+  huffused += base + size;
+
+  /* packed copy of the original table, behind the first level */
+  for (i = 0; i < size; ++i) {
+    get(table, i, &e);
+    out[base + i] = e.final ?
+      (0x80000000U | e.hlen | (e.payload << 8)) :
+      ((e.bits << 5) | ((base + e.offset) << 9));
+  }
+
+  /* first level: walk the original table with fbits of code */
+  for (i = 0; i < base; ++i) {
+    unsigned int k = 0, bits = startbits, offset = 0;
+
+    for (;;) {
+      if (k + bits > fbits) {
+        out[i] = k | (bits << 5) | ((base + offset) << 9);
+        break;
+      }
+
+      get(table, offset + ((i >> (fbits - k - bits)) & ((1U << bits) - 1)), &e);
+
+      if (e.final) {
+        out[i] = 0x80000000U | (k + e.hlen) | (e.payload << 8);
+        break;
+      }
+
+      k += bits;
+      bits   = e.bits;
+      offset = e.offset;
+    }
+  }
+
+  return out;
+}
+
+# define HUFF_SIZE(t)	(sizeof(t) / sizeof((t)[0]))
+# define HUFF_FBITS(s)	((s) > HUFF_FAST_BITS ? (s) : HUFF_FAST_BITS)
+
+static
+void huff_build_all(void)
+{
+  /* in order of priority, small tables first */
+  static struct {
+    union huffpair const *table;
+    unsigned int size;
+  } const pairs[] = {
+    { hufftab1,  HUFF_SIZE(hufftab1)  }, { hufftab2,  HUFF_SIZE(hufftab2)  },
+    { hufftab3,  HUFF_SIZE(hufftab3)  }, { hufftab5,  HUFF_SIZE(hufftab5)  },
+    { hufftab6,  HUFF_SIZE(hufftab6)  }, { hufftab7,  HUFF_SIZE(hufftab7)  },
+    { hufftab8,  HUFF_SIZE(hufftab8)  }, { hufftab9,  HUFF_SIZE(hufftab9)  },
+    { hufftab10, HUFF_SIZE(hufftab10) }, { hufftab11, HUFF_SIZE(hufftab11) },
+    { hufftab12, HUFF_SIZE(hufftab12) }, { hufftab13, HUFF_SIZE(hufftab13) },
+    { hufftab15, HUFF_SIZE(hufftab15) }, { hufftab16, HUFF_SIZE(hufftab16) },
+    { hufftab24, HUFF_SIZE(hufftab24) }
+  };
+  unsigned int i, j, fbits;
+  unsigned int const *fast;
+
+  fbits = HUFF_FBITS(4);
+  mad_huff_fast_quad[0].table = huff_build(hufftabA, HUFF_SIZE(hufftabA),
+                                           4, fbits, huff_get_quad);
+  mad_huff_fast_quad[0].bits  = fbits;
+  mad_huff_fast_quad[1].table = huff_build(hufftabB, HUFF_SIZE(hufftabB),
+                                           4, fbits, huff_get_quad);
+  mad_huff_fast_quad[1].bits  = fbits;
+
+  for (i = 0; i < HUFF_SIZE(pairs); ++i) {
+    /* all table_selects sharing this table, startbits are equal */
+    for (j = 0; j < 32; ++j) {
+      if (mad_huff_pair_table[j].table == pairs[i].table)
+        break;
+    }
+
+    fbits = HUFF_FBITS(mad_huff_pair_table[j].startbits);
+    fast  = huff_build(pairs[i].table, pairs[i].size,
+                       mad_huff_pair_table[j].startbits, fbits, huff_get_pair);
+
+    for (; j < 32; ++j) {
+      if (mad_huff_pair_table[j].table == pairs[i].table) {
+        mad_huff_fast_pair[j].table = fast;
+        mad_huff_fast_pair[j].bits  = fbits;
+      }
+    }
+  }
+}
+
+void mad_huff_fast_init(void)
+{
+  if (huffready)
+    return;
+
+  /* first pass sizes the pool (tables stay unset, ie. slow path) */
+  huffpool = 0;
+  huffsize = HUFF_FAST_BUDGET / sizeof(unsigned int);
+  huffused = 0;
+  huff_build_all();
+
+  huffsize = huffused;
+  huffused = 0;
+  if (huffsize && (huffpool = huff_alloc(huffsize * sizeof(unsigned int))))
+    huff_build_all();
+
+  huffready = 1;
+}
+
+# endif
@@ -66,4 +66,39 @@ struct hufftable {
 extern union huffquad const *const mad_huff_quad_table[2];
 extern struct hufftable const mad_huff_pair_table[32];
 
+# if defined(OPT_HUFF_FAST)
+/*
+ * Fast lookup tables, see huffman.c. Entries are packed into
+ * one word:
+ *
+ *   final: 1 (31), hlen (0..4), x/y or v/w/x/y (8..15)
+ *   ptr:   0 (31), skip (0..4), bits (5..8), offset (9..30)
+ *
+ * Only first-level pointers use skip (the number of bits consumed
+ * before the next clump); below, the clump size is that of the
+ * pointer that led there, as in the original tables.
+ */
+struct huffast {
+  unsigned int const *table;	/* 0 if not built */
+  unsigned int bits;		/* first-level width */
+};
+
+#  define HUFF_FINAL(e)		((e) & 0x80000000U)
+#  define HUFF_HLEN(e)		((e) & 0x1f)
+#  define HUFF_SKIP(e)		((e) & 0x1f)
+#  define HUFF_BITS(e)		(((e) >> 5) & 0x0f)
+#  define HUFF_OFFSET(e)	(((e) >> 9) & 0x3fffff)
+#  define HUFF_X(e)		(((e) >>  8) & 0x0f)
+#  define HUFF_Y(e)		(((e) >> 12) & 0x0f)
+#  define HUFF_QV(e)		(((e) >>  8) & 1)
+#  define HUFF_QW(e)		(((e) >>  9) & 1)
+#  define HUFF_QX(e)		(((e) >> 10) & 1)
+#  define HUFF_QY(e)		(((e) >> 11) & 1)
+
+extern struct huffast mad_huff_fast_quad[2];
+extern struct huffast mad_huff_fast_pair[32];
+
+void mad_huff_fast_init(void);
+# endif
+
 # endif
@@ -47,6 +47,13 @@
 # include "huffman.h"
 # include "layer3.h"
 
+# if defined(OPT_RQ_COMPACT) && defined(ESP32)
+#  include <esp_attr.h>
+#  define RQ_ATTR  DRAM_ATTR
+# elif defined(OPT_RQ_COMPACT)
+#  define RQ_ATTR
+# endif
+
 /* --- Layer III ----------------------------------------------------------- */
 
 enum {
@@ -341,10 +348,38 @@ static
 struct fixedfloat {
   unsigned long mantissa  : 27;
   unsigned short exponent :  5;
-} const rq_table[8207] PROGMEM = {
-# include "rq_table.dat.h"
+}
+# if defined(OPT_RQ_COMPACT)
+const rq_small[256] RQ_ATTR = {
+#  define RQ_SMALL
+#  include "rq_compact.dat.h"
+#  undef RQ_SMALL
+};
+
+/*
+   compact requantization, see III_rqpower()
+
+   rq_small[x]  = rq_table[x], for x < 256
+   rq_interp[x - 128] = x^(4/3) * 2^20, for 128 <= x <= 257
+   rq_cbrt2[k]  = 2^(k/3) * 2^30
+*/
+static
+uint32_t const rq_interp[130] RQ_ATTR = {
+#  define RQ_INTERP
+#  include "rq_compact.dat.h"
+#  undef RQ_INTERP
 };
 
+static
+uint32_t const rq_cbrt2[3] RQ_ATTR = {
+  0x40000000UL /* 2^(0/3) */, 0x50a28be6UL /* 2^(1/3) */, 0x6597fa95UL /* 2^(2/3) */
+};
+# else
+const rq_table[8207] PROGMEM = {
+#  include "rq_table.dat.h"
+};
+# endif
+
 /*
    fractional powers of two
    used for requantization and joint stereo decoding
@@ -375,7 +410,7 @@ static inline mad_fixed_t root_table(int i)
 */
 static inline mad_fixed_t cs(int i)
 {
-  static mad_fixed_t const cs_val[8] PROGMEM = {
+  static mad_fixed_t const cs_val[8] MAD_DRAM2 = {
     +MAD_F(0x0db84a81) /* +0.857492926 */, +MAD_F(0x0e1b9d7f) /* +0.881741997 */,
     +MAD_F(0x0f31adcf) /* +0.949628649 */, +MAD_F(0x0fbba815) /* +0.983314592 */,
     +MAD_F(0x0feda417) /* +0.995517816 */, +MAD_F(0x0ffc8fc8) /* +0.999160558 */,
@@ -387,7 +422,7 @@ static inline mad_fixed_t cs(int i)
 
 static inline mad_fixed_t ca(int i)
 {
-  static mad_fixed_t const ca_val[8] PROGMEM = {
+  static mad_fixed_t const ca_val[8] MAD_DRAM2 = {
     -MAD_F(0x083b5fe7) /* -0.514495755 */, -MAD_F(0x078c36d2) /* -0.471731969 */,
     -MAD_F(0x05039814) /* -0.313377454 */, -MAD_F(0x02e91dd1) /* -0.181913200 */,
     -MAD_F(0x0183603a) /* -0.094574193 */, -MAD_F(0x00a7cb87) /* -0.040965583 */,
@@ -418,7 +453,7 @@ mad_fixed_t const imdct_s[6][6] PROGMEM  = {
 */
 static inline mad_fixed_t window_l(int i)
 {
-  static mad_fixed_t const window_l_val[36] PROGMEM = {
+  static mad_fixed_t const window_l_val[36] MAD_DRAM2 = {
     MAD_F(0x00b2aa3e) /* 0.043619387 */, MAD_F(0x0216a2a2) /* 0.130526192 */,
     MAD_F(0x03768962) /* 0.216439614 */, MAD_F(0x04cfb0e2) /* 0.300705800 */,
     MAD_F(0x061f78aa) /* 0.382683432 */, MAD_F(0x07635284) /* 0.461748613 */,
@@ -910,11 +945,56 @@ void III_exponents(struct channel const *channel,
   }
 }
 
+# if defined(OPT_RQ_COMPACT)
+/*
+   NAME:	III_rqpower()
+   DESCRIPTION:	compute x^(4/3) in the form of rq_table[x]
+*/
+static MAD_IRAM3
+struct fixedfloat III_rqpower(unsigned int value)
+{
+  struct fixedfloat power;
+  uint32_t f0, d1, d2, t, w;
+  unsigned int s, n, hi;
+
+  if (value < 256)
+    return rq_small[value];
+
+  /* value = (hi + t / 2^s) * 2^s, with 128 <= hi < 256 */
+  s  = (31 - __builtin_clz(value)) - 7;
+  hi = value >> s;
+  t  = value & ((1U << s) - 1);
+
+  /* quadratic interpolation (forward differences) */
+  f0 = rq_interp[hi - 128];
+  d1 = rq_interp[hi - 127] - f0;
+  d2 = rq_interp[hi - 126] - rq_interp[hi - 127] - d1;
+  w  = f0 + (uint32_t) (((uint64_t) d1 * t) >> s)
+          - (uint32_t) (((uint64_t) d2 * t * ((1U << s) - t)) >> (2 * s + 1));
+
+  /* times 2^(4s/3); the integral part goes to the exponent */
+  w = (uint32_t) (((uint64_t) w * rq_cbrt2[s % 3] + (1UL << 29)) >> 30);
+
+  /* normalize to 27-bit mantissa, with rounding */
+  n = 31 - __builtin_clz(w);
+  w = (w + (1U << (n - 27))) >> (n - 26);
+  if (w >= (1U << 27)) {
+    w >>= 1;
+    ++n;
+  }
+
+  power.mantissa = w;
+  power.exponent = n - 18 + s + s / 3;
+
+  return power;
+}
+# endif
+
 /*
    NAME:	III_requantize()
    DESCRIPTION:	requantize one (positive) value
 */
-static
+static MAD_IRAM3
 mad_fixed_t III_requantize(unsigned int value, signed int exp)
 {
   mad_fixed_t requantized;
@@ -925,10 +1005,14 @@ mad_fixed_t III_requantize(unsigned int value, signed int exp)
   frac = exp % 4;  /* assumes sign(frac) == sign(exp) */
   exp /= 4;
 
+# if defined(OPT_RQ_COMPACT)
+  power = III_rqpower(value);
+# else
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstrict-aliasing"
   *(uint32_t*)&power = *(uint32_t*)&rq_table[value]; //memcpy_P(&power, &rq_table[value], sizeof(power)); // Avoid byte access to PROGMEM
 #pragma GCC diagnostic pop
+# endif
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wuninitialized"
   requantized = power.mantissa;
@@ -970,7 +1054,7 @@ mad_fixed_t III_requantize(unsigned int value, signed int exp)
    NAME:	III_huffdecode()
    DESCRIPTION:	decode Huffman code words of one channel of one granule
 */
-static
+static MAD_IRAM3
 enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
                               struct channel *channel,
                               unsigned int const *sfbwidth,
@@ -991,6 +1075,10 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
 
   III_exponents(channel, sfbwidth, exponents);
 
+# if defined(OPT_HUFF_FAST)
+  mad_huff_fast_init();
+# endif
+
   peek = *ptr;
   mad_bit_skip(ptr, bits_left);
 
@@ -1010,6 +1098,9 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
     union huffpair const *table;
     unsigned int linbits, startbits, big_values, reqhits;
     mad_fixed_t reqcache[16];
+# if defined(OPT_HUFF_FAST)
+    struct huffast const *fast;
+# endif
 
     sfbound = xrptr + *sfbwidth++;
     rcount  = channel->region0_count + 1;
@@ -1018,6 +1109,9 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
     table     = entry->table;
     linbits   = entry->linbits;
     startbits = entry->startbits;
+# if defined(OPT_HUFF_FAST)
+    fast      = &mad_huff_fast_pair[channel->table_select[region]];
+# endif
 
     if (table == 0)
       return MAD_ERROR_BADHUFFTABLE;
@@ -1029,8 +1123,7 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
     big_values = channel->big_values;
 
     while (big_values-- && cachesz + bits_left > 0) {
-      union huffpair const *pair;
-      unsigned int clumpsz, value;
+      unsigned int clumpsz, value, x, y;
       register mad_fixed_t requantized;
 
       if (xrptr == sfbound) {
@@ -1048,6 +1141,9 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
           table     = entry->table;
           linbits   = entry->linbits;
           startbits = entry->startbits;
+# if defined(OPT_HUFF_FAST)
+          fast      = &mad_huff_fast_pair[channel->table_select[region]];
+# endif
 
           if (table == 0)
             return MAD_ERROR_BADHUFFTABLE;
@@ -1072,22 +1168,57 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
 
       /* hcod (0..19) */
 
-      clumpsz = startbits;
-      pair    = &table[MASK(bitcache, cachesz, clumpsz)];
+# if defined(OPT_HUFF_FAST)
+      if (fast->table) {
+        unsigned int const *ftab = fast->table;
+        unsigned int e;
+
+        e = ftab[MASK(bitcache, cachesz, fast->bits)];
 
-      while (!pair->final) {
-        cachesz -= clumpsz;
+        if (!HUFF_FINAL(e)) {
+          cachesz -= HUFF_SKIP(e);
 
-        clumpsz = pair->ptr.bits;
-        pair    = &table[pair->ptr.offset + MASK(bitcache, cachesz, clumpsz)];
+          clumpsz = HUFF_BITS(e);
+          e       = ftab[HUFF_OFFSET(e) + MASK(bitcache, cachesz, clumpsz)];
+
+          while (!HUFF_FINAL(e)) {
+            cachesz -= clumpsz;
+
+            clumpsz = HUFF_BITS(e);
+            e       = ftab[HUFF_OFFSET(e) + MASK(bitcache, cachesz, clumpsz)];
+          }
+        }
+
+        cachesz -= HUFF_HLEN(e);
+
+        x = HUFF_X(e);
+        y = HUFF_Y(e);
       }
+      else
+# endif
+      {
+        union huffpair const *pair;
 
-      cachesz -= pair->value.hlen;
+        clumpsz = startbits;
+        pair    = &table[MASK(bitcache, cachesz, clumpsz)];
+
+        while (!pair->final) {
+          cachesz -= clumpsz;
+
+          clumpsz = pair->ptr.bits;
+          pair    = &table[pair->ptr.offset + MASK(bitcache, cachesz, clumpsz)];
+        }
+
+        cachesz -= pair->value.hlen;
+
+        x = pair->value.x;
+        y = pair->value.y;
+      }
 
       if (linbits) {
         /* x (0..14) */
 
-        value = pair->value.x;
+        value = x;
 
         switch (value) {
           case 0:
@@ -1122,7 +1253,7 @@ x_final:
 
         /* y (0..14) */
 
-        value = pair->value.y;
+        value = y;
 
         switch (value) {
           case 0:
@@ -1158,7 +1289,7 @@ y_final:
       else {
         /* x (0..1) */
 
-        value = pair->value.x;
+        value = x;
 
         if (value == 0)
           xrptr[0] = 0;
@@ -1176,7 +1307,7 @@ y_final:
 
         /* y (0..1) */
 
-        value = pair->value.y;
+        value = y;
 
         if (value == 0)
           xrptr[1] = 0;
@@ -1204,13 +1335,18 @@ y_final:
   {
     union huffquad const *table;
     register mad_fixed_t requantized;
+# if defined(OPT_HUFF_FAST)
+    struct huffast const *fast;
+
+    fast  = &mad_huff_fast_quad[channel->flags & count1table_select];
+# endif
 
     table = mad_huff_quad_table[channel->flags & count1table_select];
 
     requantized = III_requantize(1, exp);
 
     while (cachesz + bits_left > 0 && xrptr <= &xr[572]) {
-      union huffquad const *quad;
+      unsigned int v, w, x, y;
 
       /* hcod (1..6) */
 
@@ -1220,17 +1356,49 @@ y_final:
         bits_left -= 16;
       }
 
-      quad = &table[MASK(bitcache, cachesz, 4)];
+# if defined(OPT_HUFF_FAST)
+      if (fast->table) {
+        unsigned int const *ftab = fast->table;
+        unsigned int e;
+
+        e = ftab[MASK(bitcache, cachesz, fast->bits)];
 
-      /* quad tables guaranteed to have at most one extra lookup */
-      if (!quad->final) {
-        cachesz -= 4;
+        /* at most one extra lookup, as below */
+        if (!HUFF_FINAL(e)) {
+          cachesz -= HUFF_SKIP(e);
 
-        quad = &table[quad->ptr.offset +
-                      MASK(bitcache, cachesz, quad->ptr.bits)];
+          e = ftab[HUFF_OFFSET(e) + MASK(bitcache, cachesz, HUFF_BITS(e))];
+        }
+
+        cachesz -= HUFF_HLEN(e);
+
+        v = HUFF_QV(e);
+        w = HUFF_QW(e);
+        x = HUFF_QX(e);
+        y = HUFF_QY(e);
       }
+      else
+# endif
+      {
+        union huffquad const *quad;
+
+        quad = &table[MASK(bitcache, cachesz, 4)];
 
-      cachesz -= quad->value.hlen;
+        /* quad tables guaranteed to have at most one extra lookup */
+        if (!quad->final) {
+          cachesz -= 4;
+
+          quad = &table[quad->ptr.offset +
+                        MASK(bitcache, cachesz, quad->ptr.bits)];
+        }
+
+        cachesz -= quad->value.hlen;
+
+        v = quad->value.v;
+        w = quad->value.w;
+        x = quad->value.x;
+        y = quad->value.y;
+      }
 
       if (xrptr == sfbound) {
         sfbound += *sfbwidth++;
@@ -1245,12 +1413,12 @@ y_final:
 
       /* v (0..1) */
 
-      xrptr[0] = quad->value.v ?
+      xrptr[0] = v ?
                  (MASK1BIT(bitcache, cachesz--) ? -requantized : requantized) : 0;
 
       /* w (0..1) */
 
-      xrptr[1] = quad->value.w ?
+      xrptr[1] = w ?
                  (MASK1BIT(bitcache, cachesz--) ? -requantized : requantized) : 0;
 
       xrptr += 2;
@@ -1268,12 +1436,12 @@ y_final:
 
       /* x (0..1) */
 
-      xrptr[0] = quad->value.x ?
+      xrptr[0] = x ?
                  (MASK1BIT(bitcache, cachesz--) ? -requantized : requantized) : 0;
 
       /* y (0..1) */
 
-      xrptr[1] = quad->value.y ?
+      xrptr[1] = y ?
                  (MASK1BIT(bitcache, cachesz--) ? -requantized : requantized) : 0;
 
       xrptr += 2;
@@ -1595,11 +1763,12 @@ enum mad_error III_stereo(mad_fixed_t xr[2][576],
    NAME:	III_aliasreduce()
    DESCRIPTION:	perform frequency line alias reduction
 */
-static
+static MAD_IRAM2
 void III_aliasreduce(mad_fixed_t xr[576], int lines)
 {
   mad_fixed_t const *bound;
   int i;
+  MAD_PROF_BEGIN(prof);
   stack(__FUNCTION__, __FILE__, __LINE__);
 
   bound = &xr[lines];
@@ -1629,13 +1798,15 @@ void III_aliasreduce(mad_fixed_t xr[576], int lines)
 # endif
     }
   }
+
+  MAD_PROF_END(MAD_PROF_ALIAS, prof);
 }
 
 # if defined(ASO_IMDCT)
 void III_imdct_l(mad_fixed_t const [18], mad_fixed_t [36], unsigned int);
 # else
 #  if 1
-static
+static MAD_IRAM2
 void fastsdct(mad_fixed_t const x[9], mad_fixed_t y[18])
 {
   mad_fixed_t a0,  a1,  a2,  a3,  a4,  a5,  a6,  a7,  a8,  a9,  a10, a11, a12;
@@ -2122,11 +2293,12 @@ void imdct36(mad_fixed_t const X[18], mad_fixed_t x[36])
    NAME:	III_imdct_l()
    DESCRIPTION:	perform IMDCT and windowing for long blocks
 */
-static
+static MAD_IRAM2
 void III_imdct_l(mad_fixed_t const X[18], mad_fixed_t z[36],
                  unsigned int block_type)
 {
   unsigned int i;
+  MAD_PROF_BEGIN(prof);
   stack(__FUNCTION__, __FILE__, __LINE__);
 
   /* IMDCT */
@@ -2203,6 +2375,8 @@ void III_imdct_l(mad_fixed_t const X[18], mad_fixed_t z[36],
       }
       break;
   }
+
+  MAD_PROF_END(MAD_PROF_IMDCT, prof);
 }
 # endif  /* ASO_IMDCT */
 
@@ -2478,7 +2652,9 @@ enum mad_error III_decode(struct mad_bitptr *ptr, struct mad_frame *frame,
                                         gr == 0 ? 0 : si->scfsi[ch]);
       }
 
+      MAD_PROF_BEGIN(prof);
       error = III_huffdecode(ptr, xr[ch], channel, sfbwidth[ch], part2_length);
+      MAD_PROF_END(MAD_PROF_HUFF, prof);
       if (error) {
 //        free(xr_raw);
         return error;
@@ -0,0 +1,448 @@
+/*
+ * libmad - MPEG audio decoder library
+ * Copyright (C) 2000-2004 Underbit Technologies, Inc.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * These are the lookup tables used by the compact Layer III requantizer.
+ * rq_small[] holds x^(4/3) for 0 <= x < 256 in the same mantissa/exponent
+ * form as rq_table[]; rq_interp[] holds x^(4/3) for 128 <= x <= 257 as
+ * unsigned fixed-point numbers with 20 fractional bits, for interpolation.
+ */
+
+# if defined(RQ_SMALL)
+  /*    0 */  { MAD_F(0x00000000) /* 0.000000000 */,  0 },
+  /*    1 */  { MAD_F(0x04000000) /* 0.250000000 */,  2 },
+  /*    2 */  { MAD_F(0x050a28be) /* 0.314980262 */,  3 },
+  /*    3 */  { MAD_F(0x0453a5cd) /* 0.270421794 */,  4 },
+  /*    4 */  { MAD_F(0x06597fa9) /* 0.396850263 */,  4 },
+  /*    5 */  { MAD_F(0x04466275) /* 0.267183742 */,  5 },
+  /*    6 */  { MAD_F(0x05738c72) /* 0.340710111 */,  5 },
+  /*    7 */  { MAD_F(0x06b1fc81) /* 0.418453696 */,  5 },
+  /*    8 */  { MAD_F(0x04000000) /* 0.250000000 */,  6 },
+  /*    9 */  { MAD_F(0x04ae20d7) /* 0.292511788 */,  6 },
+  /*   10 */  { MAD_F(0x0562d694) /* 0.336630420 */,  6 },
+  /*   11 */  { MAD_F(0x061dae96) /* 0.382246578 */,  6 },
+  /*   12 */  { MAD_F(0x06de47f4) /* 0.429267841 */,  6 },
+  /*   13 */  { MAD_F(0x07a44f7a) /* 0.477614858 */,  6 },
+  /*   14 */  { MAD_F(0x0437be65) /* 0.263609310 */,  7 },
+  /*   15 */  { MAD_F(0x049fc824) /* 0.289009227 */,  7 },
+
+  /*   16 */  { MAD_F(0x050a28be) /* 0.314980262 */,  7 },
+  /*   17 */  { MAD_F(0x0576c6f5) /* 0.341498336 */,  7 },
+  /*   18 */  { MAD_F(0x05e58c0b) /* 0.368541759 */,  7 },
+  /*   19 */  { MAD_F(0x06566361) /* 0.396090870 */,  7 },
+  /*   20 */  { MAD_F(0x06c93a2e) /* 0.424127753 */,  7 },
+  /*   21 */  { MAD_F(0x073dff3e) /* 0.452635998 */,  7 },
+  /*   22 */  { MAD_F(0x07b4a2bc) /* 0.481600510 */,  7 },
+  /*   23 */  { MAD_F(0x04168b05) /* 0.255503674 */,  8 },
+  /*   24 */  { MAD_F(0x0453a5cd) /* 0.270421794 */,  8 },
+  /*   25 */  { MAD_F(0x04919b6a) /* 0.285548607 */,  8 },
+  /*   26 */  { MAD_F(0x04d065fb) /* 0.300878507 */,  8 },
+  /*   27 */  { MAD_F(0x05100000) /* 0.316406250 */,  8 },
+  /*   28 */  { MAD_F(0x05506451) /* 0.332126919 */,  8 },
+  /*   29 */  { MAD_F(0x05918e15) /* 0.348035890 */,  8 },
+  /*   30 */  { MAD_F(0x05d378bb) /* 0.364128809 */,  8 },
+  /*   31 */  { MAD_F(0x06161ff3) /* 0.380401563 */,  8 },
+
+  /*   32 */  { MAD_F(0x06597fa9) /* 0.396850263 */,  8 },
+  /*   33 */  { MAD_F(0x069d9400) /* 0.413471222 */,  8 },
+  /*   34 */  { MAD_F(0x06e2594c) /* 0.430260942 */,  8 },
+  /*   35 */  { MAD_F(0x0727cc11) /* 0.447216097 */,  8 },
+  /*   36 */  { MAD_F(0x076de8fc) /* 0.464333519 */,  8 },
+  /*   37 */  { MAD_F(0x07b4ace3) /* 0.481610189 */,  8 },
+  /*   38 */  { MAD_F(0x07fc14bf) /* 0.499043224 */,  8 },
+  /*   39 */  { MAD_F(0x04220ed7) /* 0.258314934 */,  9 },
+  /*   40 */  { MAD_F(0x04466275) /* 0.267183742 */,  9 },
+  /*   41 */  { MAD_F(0x046b03e7) /* 0.276126771 */,  9 },
+  /*   42 */  { MAD_F(0x048ff1e8) /* 0.285142811 */,  9 },
+  /*   43 */  { MAD_F(0x04b52b3f) /* 0.294230696 */,  9 },
+  /*   44 */  { MAD_F(0x04daaec0) /* 0.303389310 */,  9 },
+  /*   45 */  { MAD_F(0x05007b49) /* 0.312617576 */,  9 },
+  /*   46 */  { MAD_F(0x05268fc6) /* 0.321914457 */,  9 },
+  /*   47 */  { MAD_F(0x054ceb2a) /* 0.331278957 */,  9 },
+
+  /*   48 */  { MAD_F(0x05738c72) /* 0.340710111 */,  9 },
+  /*   49 */  { MAD_F(0x059a72a5) /* 0.350206992 */,  9 },
+  /*   50 */  { MAD_F(0x05c19cd3) /* 0.359768701 */,  9 },
+  /*   51 */  { MAD_F(0x05e90a12) /* 0.369394372 */,  9 },
+  /*   52 */  { MAD_F(0x0610b982) /* 0.379083164 */,  9 },
+  /*   53 */  { MAD_F(0x0638aa48) /* 0.388834268 */,  9 },
+  /*   54 */  { MAD_F(0x0660db91) /* 0.398646895 */,  9 },
+  /*   55 */  { MAD_F(0x06894c90) /* 0.408520284 */,  9 },
+  /*   56 */  { MAD_F(0x06b1fc81) /* 0.418453696 */,  9 },
+  /*   57 */  { MAD_F(0x06daeaa1) /* 0.428446415 */,  9 },
+  /*   58 */  { MAD_F(0x07041636) /* 0.438497744 */,  9 },
+  /*   59 */  { MAD_F(0x072d7e8b) /* 0.448607009 */,  9 },
+  /*   60 */  { MAD_F(0x075722ef) /* 0.458773552 */,  9 },
+  /*   61 */  { MAD_F(0x078102b8) /* 0.468996735 */,  9 },
+  /*   62 */  { MAD_F(0x07ab1d3e) /* 0.479275937 */,  9 },
+  /*   63 */  { MAD_F(0x07d571e0) /* 0.489610555 */,  9 },
+
+  /*   64 */  { MAD_F(0x04000000) /* 0.250000000 */, 10 },
+  /*   65 */  { MAD_F(0x04156381) /* 0.255221850 */, 10 },
+  /*   66 */  { MAD_F(0x042ae32a) /* 0.260470548 */, 10 },
+  /*   67 */  { MAD_F(0x04407eb1) /* 0.265745823 */, 10 },
+  /*   68 */  { MAD_F(0x045635cf) /* 0.271047409 */, 10 },
+  /*   69 */  { MAD_F(0x046c083e) /* 0.276375048 */, 10 },
+  /*   70 */  { MAD_F(0x0481f5bb) /* 0.281728487 */, 10 },
+  /*   71 */  { MAD_F(0x0497fe03) /* 0.287107481 */, 10 },
+  /*   72 */  { MAD_F(0x04ae20d7) /* 0.292511788 */, 10 },
+  /*   73 */  { MAD_F(0x04c45df6) /* 0.297941173 */, 10 },
+  /*   74 */  { MAD_F(0x04dab524) /* 0.303395408 */, 10 },
+  /*   75 */  { MAD_F(0x04f12624) /* 0.308874267 */, 10 },
+  /*   76 */  { MAD_F(0x0507b0bc) /* 0.314377532 */, 10 },
+  /*   77 */  { MAD_F(0x051e54b1) /* 0.319904987 */, 10 },
+  /*   78 */  { MAD_F(0x053511cb) /* 0.325456423 */, 10 },
+  /*   79 */  { MAD_F(0x054be7d4) /* 0.331031635 */, 10 },
+
+  /*   80 */  { MAD_F(0x0562d694) /* 0.336630420 */, 10 },
+  /*   81 */  { MAD_F(0x0579ddd8) /* 0.342252584 */, 10 },
+  /*   82 */  { MAD_F(0x0590fd6c) /* 0.347897931 */, 10 },
+  /*   83 */  { MAD_F(0x05a8351c) /* 0.353566275 */, 10 },
+  /*   84 */  { MAD_F(0x05bf84b8) /* 0.359257429 */, 10 },
+  /*   85 */  { MAD_F(0x05d6ec0e) /* 0.364971213 */, 10 },
+  /*   86 */  { MAD_F(0x05ee6aef) /* 0.370707448 */, 10 },
+  /*   87 */  { MAD_F(0x0606012b) /* 0.376465960 */, 10 },
+  /*   88 */  { MAD_F(0x061dae96) /* 0.382246578 */, 10 },
+  /*   89 */  { MAD_F(0x06357302) /* 0.388049134 */, 10 },
+  /*   90 */  { MAD_F(0x064d4e43) /* 0.393873464 */, 10 },
+  /*   91 */  { MAD_F(0x0665402d) /* 0.399719406 */, 10 },
+  /*   92 */  { MAD_F(0x067d4896) /* 0.405586801 */, 10 },
+  /*   93 */  { MAD_F(0x06956753) /* 0.411475493 */, 10 },
+  /*   94 */  { MAD_F(0x06ad9c3d) /* 0.417385331 */, 10 },
+  /*   95 */  { MAD_F(0x06c5e72b) /* 0.423316162 */, 10 },
+
+  /*   96 */  { MAD_F(0x06de47f4) /* 0.429267841 */, 10 },
+  /*   97 */  { MAD_F(0x06f6be73) /* 0.435240221 */, 10 },
+  /*   98 */  { MAD_F(0x070f4a80) /* 0.441233161 */, 10 },
+  /*   99 */  { MAD_F(0x0727ebf7) /* 0.447246519 */, 10 },
+  /*  100 */  { MAD_F(0x0740a2b2) /* 0.453280160 */, 10 },
+  /*  101 */  { MAD_F(0x07596e8d) /* 0.459333946 */, 10 },
+  /*  102 */  { MAD_F(0x07724f64) /* 0.465407744 */, 10 },
+  /*  103 */  { MAD_F(0x078b4514) /* 0.471501425 */, 10 },
+  /*  104 */  { MAD_F(0x07a44f7a) /* 0.477614858 */, 10 },
+  /*  105 */  { MAD_F(0x07bd6e75) /* 0.483747918 */, 10 },
+  /*  106 */  { MAD_F(0x07d6a1e2) /* 0.489900479 */, 10 },
+  /*  107 */  { MAD_F(0x07efe9a1) /* 0.496072418 */, 10 },
+  /*  108 */  { MAD_F(0x0404a2c9) /* 0.251131807 */, 11 },
+  /*  109 */  { MAD_F(0x04115aca) /* 0.254236974 */, 11 },
+  /*  110 */  { MAD_F(0x041e1cc4) /* 0.257351652 */, 11 },
+  /*  111 */  { MAD_F(0x042ae8a7) /* 0.260475783 */, 11 },
+
+  /*  112 */  { MAD_F(0x0437be65) /* 0.263609310 */, 11 },
+  /*  113 */  { MAD_F(0x04449dee) /* 0.266752177 */, 11 },
+  /*  114 */  { MAD_F(0x04518733) /* 0.269904329 */, 11 },
+  /*  115 */  { MAD_F(0x045e7a26) /* 0.273065710 */, 11 },
+  /*  116 */  { MAD_F(0x046b76b9) /* 0.276236269 */, 11 },
+  /*  117 */  { MAD_F(0x04787cdc) /* 0.279415952 */, 11 },
+  /*  118 */  { MAD_F(0x04858c83) /* 0.282604707 */, 11 },
+  /*  119 */  { MAD_F(0x0492a59f) /* 0.285802482 */, 11 },
+  /*  120 */  { MAD_F(0x049fc824) /* 0.289009227 */, 11 },
+  /*  121 */  { MAD_F(0x04acf402) /* 0.292224893 */, 11 },
+  /*  122 */  { MAD_F(0x04ba292e) /* 0.295449429 */, 11 },
+  /*  123 */  { MAD_F(0x04c7679a) /* 0.298682788 */, 11 },
+  /*  124 */  { MAD_F(0x04d4af3a) /* 0.301924921 */, 11 },
+  /*  125 */  { MAD_F(0x04e20000) /* 0.305175781 */, 11 },
+  /*  126 */  { MAD_F(0x04ef59e0) /* 0.308435322 */, 11 },
+  /*  127 */  { MAD_F(0x04fcbcce) /* 0.311703498 */, 11 },
+
+  /*  128 */  { MAD_F(0x050a28be) /* 0.314980262 */, 11 },
+  /*  129 */  { MAD_F(0x05179da4) /* 0.318265572 */, 11 },
+  /*  130 */  { MAD_F(0x05251b73) /* 0.321559381 */, 11 },
+  /*  131 */  { MAD_F(0x0532a220) /* 0.324861647 */, 11 },
+  /*  132 */  { MAD_F(0x054031a0) /* 0.328172327 */, 11 },
+  /*  133 */  { MAD_F(0x054dc9e7) /* 0.331491377 */, 11 },
+  /*  134 */  { MAD_F(0x055b6ae9) /* 0.334818756 */, 11 },
+  /*  135 */  { MAD_F(0x0569149c) /* 0.338154423 */, 11 },
+  /*  136 */  { MAD_F(0x0576c6f5) /* 0.341498336 */, 11 },
+  /*  137 */  { MAD_F(0x058481e9) /* 0.344850455 */, 11 },
+  /*  138 */  { MAD_F(0x0592456d) /* 0.348210741 */, 11 },
+  /*  139 */  { MAD_F(0x05a01176) /* 0.351579152 */, 11 },
+  /*  140 */  { MAD_F(0x05ade5fa) /* 0.354955651 */, 11 },
+  /*  141 */  { MAD_F(0x05bbc2ef) /* 0.358340200 */, 11 },
+  /*  142 */  { MAD_F(0x05c9a84a) /* 0.361732758 */, 11 },
+  /*  143 */  { MAD_F(0x05d79601) /* 0.365133291 */, 11 },
+
+  /*  144 */  { MAD_F(0x05e58c0b) /* 0.368541759 */, 11 },
+  /*  145 */  { MAD_F(0x05f38a5d) /* 0.371958126 */, 11 },
+  /*  146 */  { MAD_F(0x060190ee) /* 0.375382356 */, 11 },
+  /*  147 */  { MAD_F(0x060f9fb3) /* 0.378814413 */, 11 },
+  /*  148 */  { MAD_F(0x061db6a5) /* 0.382254261 */, 11 },
+  /*  149 */  { MAD_F(0x062bd5b8) /* 0.385701865 */, 11 },
+  /*  150 */  { MAD_F(0x0639fce4) /* 0.389157191 */, 11 },
+  /*  151 */  { MAD_F(0x06482c1f) /* 0.392620204 */, 11 },
+  /*  152 */  { MAD_F(0x06566361) /* 0.396090870 */, 11 },
+  /*  153 */  { MAD_F(0x0664a2a0) /* 0.399569155 */, 11 },
+  /*  154 */  { MAD_F(0x0672e9d4) /* 0.403055027 */, 11 },
+  /*  155 */  { MAD_F(0x068138f3) /* 0.406548452 */, 11 },
+  /*  156 */  { MAD_F(0x068f8ff5) /* 0.410049398 */, 11 },
+  /*  157 */  { MAD_F(0x069deed1) /* 0.413557833 */, 11 },
+  /*  158 */  { MAD_F(0x06ac557f) /* 0.417073724 */, 11 },
+  /*  159 */  { MAD_F(0x06bac3f6) /* 0.420597041 */, 11 },
+
+  /*  160 */  { MAD_F(0x06c93a2e) /* 0.424127753 */, 11 },
+  /*  161 */  { MAD_F(0x06d7b81f) /* 0.427665827 */, 11 },
+  /*  162 */  { MAD_F(0x06e63dc0) /* 0.431211234 */, 11 },
+  /*  163 */  { MAD_F(0x06f4cb09) /* 0.434763944 */, 11 },
+  /*  164 */  { MAD_F(0x07035ff3) /* 0.438323927 */, 11 },
+  /*  165 */  { MAD_F(0x0711fc75) /* 0.441891153 */, 11 },
+  /*  166 */  { MAD_F(0x0720a087) /* 0.445465593 */, 11 },
+  /*  167 */  { MAD_F(0x072f4c22) /* 0.449047217 */, 11 },
+  /*  168 */  { MAD_F(0x073dff3e) /* 0.452635998 */, 11 },
+  /*  169 */  { MAD_F(0x074cb9d3) /* 0.456231906 */, 11 },
+  /*  170 */  { MAD_F(0x075b7bdb) /* 0.459834914 */, 11 },
+  /*  171 */  { MAD_F(0x076a454c) /* 0.463444993 */, 11 },
+  /*  172 */  { MAD_F(0x07791620) /* 0.467062117 */, 11 },
+  /*  173 */  { MAD_F(0x0787ee50) /* 0.470686258 */, 11 },
+  /*  174 */  { MAD_F(0x0796cdd4) /* 0.474317388 */, 11 },
+  /*  175 */  { MAD_F(0x07a5b4a5) /* 0.477955481 */, 11 },
+
+  /*  176 */  { MAD_F(0x07b4a2bc) /* 0.481600510 */, 11 },
+  /*  177 */  { MAD_F(0x07c39812) /* 0.485252449 */, 11 },
+  /*  178 */  { MAD_F(0x07d294a0) /* 0.488911273 */, 11 },
+  /*  179 */  { MAD_F(0x07e1985f) /* 0.492576954 */, 11 },
+  /*  180 */  { MAD_F(0x07f0a348) /* 0.496249468 */, 11 },
+  /*  181 */  { MAD_F(0x07ffb554) /* 0.499928790 */, 11 },
+  /*  182 */  { MAD_F(0x0407673f) /* 0.251807447 */, 12 },
+  /*  183 */  { MAD_F(0x040ef75e) /* 0.253653877 */, 12 },
+  /*  184 */  { MAD_F(0x04168b05) /* 0.255503674 */, 12 },
+  /*  185 */  { MAD_F(0x041e2230) /* 0.257356825 */, 12 },
+  /*  186 */  { MAD_F(0x0425bcdd) /* 0.259213318 */, 12 },
+  /*  187 */  { MAD_F(0x042d5b07) /* 0.261073141 */, 12 },
+  /*  188 */  { MAD_F(0x0434fcad) /* 0.262936282 */, 12 },
+  /*  189 */  { MAD_F(0x043ca1c9) /* 0.264802730 */, 12 },
+  /*  190 */  { MAD_F(0x04444a5a) /* 0.266672472 */, 12 },
+  /*  191 */  { MAD_F(0x044bf65d) /* 0.268545497 */, 12 },
+
+  /*  192 */  { MAD_F(0x0453a5cd) /* 0.270421794 */, 12 },
+  /*  193 */  { MAD_F(0x045b58a9) /* 0.272301352 */, 12 },
+  /*  194 */  { MAD_F(0x04630eed) /* 0.274184158 */, 12 },
+  /*  195 */  { MAD_F(0x046ac896) /* 0.276070203 */, 12 },
+  /*  196 */  { MAD_F(0x047285a2) /* 0.277959474 */, 12 },
+  /*  197 */  { MAD_F(0x047a460c) /* 0.279851960 */, 12 },
+  /*  198 */  { MAD_F(0x048209d3) /* 0.281747652 */, 12 },
+  /*  199 */  { MAD_F(0x0489d0f4) /* 0.283646538 */, 12 },
+  /*  200 */  { MAD_F(0x04919b6a) /* 0.285548607 */, 12 },
+  /*  201 */  { MAD_F(0x04996935) /* 0.287453849 */, 12 },
+  /*  202 */  { MAD_F(0x04a13a50) /* 0.289362253 */, 12 },
+  /*  203 */  { MAD_F(0x04a90eba) /* 0.291273810 */, 12 },
+  /*  204 */  { MAD_F(0x04b0e66e) /* 0.293188507 */, 12 },
+  /*  205 */  { MAD_F(0x04b8c16c) /* 0.295106336 */, 12 },
+  /*  206 */  { MAD_F(0x04c09faf) /* 0.297027285 */, 12 },
+  /*  207 */  { MAD_F(0x04c88135) /* 0.298951346 */, 12 },
+
+  /*  208 */  { MAD_F(0x04d065fb) /* 0.300878507 */, 12 },
+  /*  209 */  { MAD_F(0x04d84dff) /* 0.302808759 */, 12 },
+  /*  210 */  { MAD_F(0x04e0393e) /* 0.304742092 */, 12 },
+  /*  211 */  { MAD_F(0x04e827b6) /* 0.306678497 */, 12 },
+  /*  212 */  { MAD_F(0x04f01963) /* 0.308617963 */, 12 },
+  /*  213 */  { MAD_F(0x04f80e44) /* 0.310560480 */, 12 },
+  /*  214 */  { MAD_F(0x05000655) /* 0.312506041 */, 12 },
+  /*  215 */  { MAD_F(0x05080195) /* 0.314454634 */, 12 },
+  /*  216 */  { MAD_F(0x05100000) /* 0.316406250 */, 12 },
+  /*  217 */  { MAD_F(0x05180194) /* 0.318360880 */, 12 },
+  /*  218 */  { MAD_F(0x0520064f) /* 0.320318516 */, 12 },
+  /*  219 */  { MAD_F(0x05280e2d) /* 0.322279147 */, 12 },
+  /*  220 */  { MAD_F(0x0530192e) /* 0.324242764 */, 12 },
+  /*  221 */  { MAD_F(0x0538274e) /* 0.326209359 */, 12 },
+  /*  222 */  { MAD_F(0x0540388a) /* 0.328178922 */, 12 },
+  /*  223 */  { MAD_F(0x05484ce2) /* 0.330151445 */, 12 },
+
+  /*  224 */  { MAD_F(0x05506451) /* 0.332126919 */, 12 },
+  /*  225 */  { MAD_F(0x05587ed5) /* 0.334105334 */, 12 },
+  /*  226 */  { MAD_F(0x05609c6e) /* 0.336086683 */, 12 },
+  /*  227 */  { MAD_F(0x0568bd17) /* 0.338070956 */, 12 },
+  /*  228 */  { MAD_F(0x0570e0cf) /* 0.340058145 */, 12 },
+  /*  229 */  { MAD_F(0x05790793) /* 0.342048241 */, 12 },
+  /*  230 */  { MAD_F(0x05813162) /* 0.344041237 */, 12 },
+  /*  231 */  { MAD_F(0x05895e39) /* 0.346037122 */, 12 },
+  /*  232 */  { MAD_F(0x05918e15) /* 0.348035890 */, 12 },
+  /*  233 */  { MAD_F(0x0599c0f4) /* 0.350037532 */, 12 },
+  /*  234 */  { MAD_F(0x05a1f6d5) /* 0.352042040 */, 12 },
+  /*  235 */  { MAD_F(0x05aa2fb5) /* 0.354049405 */, 12 },
+  /*  236 */  { MAD_F(0x05b26b92) /* 0.356059619 */, 12 },
+  /*  237 */  { MAD_F(0x05baaa69) /* 0.358072674 */, 12 },
+  /*  238 */  { MAD_F(0x05c2ec39) /* 0.360088563 */, 12 },
+  /*  239 */  { MAD_F(0x05cb3100) /* 0.362107278 */, 12 },
+
+  /*  240 */  { MAD_F(0x05d378bb) /* 0.364128809 */, 12 },
+  /*  241 */  { MAD_F(0x05dbc368) /* 0.366153151 */, 12 },
+  /*  242 */  { MAD_F(0x05e41105) /* 0.368180294 */, 12 },
+  /*  243 */  { MAD_F(0x05ec6190) /* 0.370210231 */, 12 },
+  /*  244 */  { MAD_F(0x05f4b507) /* 0.372242955 */, 12 },
+  /*  245 */  { MAD_F(0x05fd0b68) /* 0.374278458 */, 12 },
+  /*  246 */  { MAD_F(0x060564b1) /* 0.376316732 */, 12 },
+  /*  247 */  { MAD_F(0x060dc0e0) /* 0.378357769 */, 12 },
+  /*  248 */  { MAD_F(0x06161ff3) /* 0.380401563 */, 12 },
+  /*  249 */  { MAD_F(0x061e81e8) /* 0.382448106 */, 12 },
+  /*  250 */  { MAD_F(0x0626e6bc) /* 0.384497391 */, 12 },
+  /*  251 */  { MAD_F(0x062f4e6f) /* 0.386549409 */, 12 },
+  /*  252 */  { MAD_F(0x0637b8fd) /* 0.388604155 */, 12 },
+  /*  253 */  { MAD_F(0x06402666) /* 0.390661620 */, 12 },
+  /*  254 */  { MAD_F(0x064896a7) /* 0.392721798 */, 12 },
+  /*  255 */  { MAD_F(0x065109be) /* 0.394784681 */, 12 }
+# endif
+
+# if defined(RQ_INTERP)
+  /* 128 */  0x285145f3UL /* 645.079577446 */,
+  /* 129 */  0x28bced1fUL /* 651.807890892 */,
+  /* 130 */  0x2928db99UL /* 658.553612709 */,
+  /* 131 */  0x29951103UL /* 665.316653252 */,
+  /* 132 */  0x2a018d01UL /* 672.096924782 */,
+  /* 133 */  0x2a6e4f37UL /* 678.894339561 */,
+  /* 134 */  0x2adb574cUL /* 685.708812714 */,
+  /* 135 */  0x2b48a4e6UL /* 692.540258408 */,
+
+  /* 136 */  0x2bb637adUL /* 699.388592720 */,
+  /* 137 */  0x2c240f4aUL /* 706.253732681 */,
+  /* 138 */  0x2c922b68UL /* 713.135597229 */,
+  /* 139 */  0x2d008bb1UL /* 720.034104347 */,
+  /* 140 */  0x2d6f2fd1UL /* 726.949173927 */,
+  /* 141 */  0x2dde1777UL /* 733.880728722 */,
+  /* 142 */  0x2e4d4250UL /* 740.828689575 */,
+  /* 143 */  0x2ebcb00bUL /* 747.792979240 */,
+
+  /* 144 */  0x2f2c6058UL /* 754.773521423 */,
+  /* 145 */  0x2f9c52e9UL /* 761.770241737 */,
+  /* 146 */  0x300c876fUL /* 768.783064842 */,
+  /* 147 */  0x307cfd9dUL /* 775.811917305 */,
+  /* 148 */  0x30edb526UL /* 782.856725693 */,
+  /* 149 */  0x315eadc0UL /* 789.917419434 */,
+  /* 150 */  0x31cfe720UL /* 796.993927002 */,
+  /* 151 */  0x324160fbUL /* 804.086176872 */,
+
+  /* 152 */  0x32b31b0aUL /* 811.194101334 */,
+  /* 153 */  0x33251503UL /* 818.317629814 */,
+  /* 154 */  0x33974ea0UL /* 825.456695557 */,
+  /* 155 */  0x3409c799UL /* 832.611229897 */,
+  /* 156 */  0x347c7fa9UL /* 839.781167030 */,
+  /* 157 */  0x34ef768cUL /* 846.966442108 */,
+  /* 158 */  0x3562abfbUL /* 854.166987419 */,
+  /* 159 */  0x35d61fb5UL /* 861.382740974 */,
+
+  /* 160 */  0x3649d175UL /* 868.613636971 */,
+  /* 161 */  0x36bdc0faUL /* 875.859613419 */,
+  /* 162 */  0x3731ee03UL /* 883.120608330 */,
+  /* 163 */  0x37a6584dUL /* 890.396557808 */,
+  /* 164 */  0x381aff9aUL /* 897.687402725 */,
+  /* 165 */  0x388fe3a9UL /* 904.993081093 */,
+  /* 166 */  0x3905043cUL /* 912.313533783 */,
+  /* 167 */  0x397a6114UL /* 919.648700714 */,
+
+  /* 168 */  0x39eff9f4UL /* 926.998523712 */,
+  /* 169 */  0x3a65ce9eUL /* 934.362943649 */,
+  /* 170 */  0x3adbded6UL /* 941.741903305 */,
+  /* 171 */  0x3b522a61UL /* 949.135346413 */,
+  /* 172 */  0x3bc8b103UL /* 956.543215752 */,
+  /* 173 */  0x3c3f7281UL /* 963.965455055 */,
+  /* 174 */  0x3cb66ea2UL /* 971.402009964 */,
+  /* 175 */  0x3d2da52bUL /* 978.852824211 */,
+
+  /* 176 */  0x3da515e4UL /* 986.317844391 */,
+  /* 177 */  0x3e1cc094UL /* 993.797016144 */,
+  /* 178 */  0x3e94a503UL /* 1001.290286064 */,
+  /* 179 */  0x3f0cc2fbUL /* 1008.797602654 */,
+  /* 180 */  0x3f851a43UL /* 1016.318911552 */,
+  /* 181 */  0x3ffdaaa5UL /* 1023.854161263 */,
+  /* 182 */  0x407673ecUL /* 1031.403301239 */,
+  /* 183 */  0x40ef75e3UL /* 1038.966280937 */,
+
+  /* 184 */  0x4168b054UL /* 1046.543048859 */,
+  /* 185 */  0x41e2230aUL /* 1054.133554459 */,
+  /* 186 */  0x425bcdd3UL /* 1061.737750053 */,
+  /* 187 */  0x42d5b07aUL /* 1069.355585098 */,
+  /* 188 */  0x434fcaccUL /* 1076.987010956 */,
+  /* 189 */  0x43ca1c98UL /* 1084.631980896 */,
+  /* 190 */  0x4444a5aaUL /* 1092.290445328 */,
+  /* 191 */  0x44bf65d1UL /* 1099.962357521 */,
+
+  /* 192 */  0x453a5cdbUL /* 1107.647669792 */,
+  /* 193 */  0x45b58a99UL /* 1115.346337318 */,
+  /* 194 */  0x4630eed9UL /* 1123.058312416 */,
+  /* 195 */  0x46ac896bUL /* 1130.783549309 */,
+  /* 196 */  0x47285a21UL /* 1138.522004128 */,
+  /* 197 */  0x47a460caUL /* 1146.273630142 */,
+  /* 198 */  0x48209d38UL /* 1154.038383484 */,
+  /* 199 */  0x489d0f3cUL /* 1161.816219330 */,
+
+  /* 200 */  0x4919b6aaUL /* 1169.607095718 */,
+  /* 201 */  0x49969352UL /* 1177.410966873 */,
+  /* 202 */  0x4a13a507UL /* 1185.227789879 */,
+  /* 203 */  0x4a90eb9eUL /* 1193.057523727 */,
+  /* 204 */  0x4b0e66e9UL /* 1200.900124550 */,
+  /* 205 */  0x4b8c16bcUL /* 1208.755550385 */,
+  /* 206 */  0x4c09faecUL /* 1216.623760223 */,
+  /* 207 */  0x4c88134dUL /* 1224.504712105 */,
+
+  /* 208 */  0x4d065fb3UL /* 1232.398364067 */,
+  /* 209 */  0x4d84dff5UL /* 1240.304677010 */,
+  /* 210 */  0x4e0393e8UL /* 1248.223609924 */,
+  /* 211 */  0x4e827b62UL /* 1256.155122757 */,
+  /* 212 */  0x4f019639UL /* 1264.099175453 */,
+  /* 213 */  0x4f80e443UL /* 1272.055727959 */,
+  /* 214 */  0x50006558UL /* 1280.024742126 */,
+  /* 215 */  0x5080194fUL /* 1288.006178856 */,
+
+  /* 216 */  0x51000000UL /* 1296.000000000 */,
+  /* 217 */  0x51801942UL /* 1304.006166458 */,
+  /* 218 */  0x520064eeUL /* 1312.024641037 */,
+  /* 219 */  0x5280e2dbUL /* 1320.055384636 */,
+  /* 220 */  0x530192e4UL /* 1328.098361969 */,
+  /* 221 */  0x538274e1UL /* 1336.153534889 */,
+  /* 222 */  0x540388abUL /* 1344.220866203 */,
+  /* 223 */  0x5484ce1cUL /* 1352.300319672 */,
+
+  /* 224 */  0x5506450eUL /* 1360.391859055 */,
+  /* 225 */  0x5587ed5cUL /* 1368.495449066 */,
+  /* 226 */  0x5609c6dfUL /* 1376.611052513 */,
+  /* 227 */  0x568bd173UL /* 1384.738635063 */,
+  /* 228 */  0x570e0cf3UL /* 1392.878161430 */,
+  /* 229 */  0x5790793aUL /* 1401.029596329 */,
+  /* 230 */  0x58131624UL /* 1409.192905426 */,
+  /* 231 */  0x5895e38cUL /* 1417.368053436 */,
+
+  /* 232 */  0x5918e14fUL /* 1425.555006981 */,
+  /* 233 */  0x599c0f49UL /* 1433.753731728 */,
+  /* 234 */  0x5a1f6d57UL /* 1441.964194298 */,
+  /* 235 */  0x5aa2fb56UL /* 1450.186361313 */,
+  /* 236 */  0x5b26b923UL /* 1458.420199394 */,
+  /* 237 */  0x5baaa69aUL /* 1466.665674210 */,
+  /* 238 */  0x5c2ec39bUL /* 1474.922755241 */,
+  /* 239 */  0x5cb31003UL /* 1483.191409111 */,
+
+  /* 240 */  0x5d378bafUL /* 1491.471602440 */,
+  /* 241 */  0x5dbc367fUL /* 1499.763304710 */,
+  /* 242 */  0x5e411051UL /* 1508.066483498 */,
+  /* 243 */  0x5ec61904UL /* 1516.381107330 */,
+  /* 244 */  0x5f4b5076UL /* 1524.707143784 */,
+  /* 245 */  0x5fd0b687UL /* 1533.044562340 */,
+  /* 246 */  0x60564b17UL /* 1541.393332481 */,
+  /* 247 */  0x60dc0e06UL /* 1549.753423691 */,
+
+  /* 248 */  0x6161ff32UL /* 1558.124803543 */,
+  /* 249 */  0x61e81e7dUL /* 1566.507443428 */,
+  /* 250 */  0x626e6bc7UL /* 1574.901312828 */,
+  /* 251 */  0x62f4e6efUL /* 1583.306380272 */,
+  /* 252 */  0x637b8fd9UL /* 1591.722619057 */,
+  /* 253 */  0x64026663UL /* 1600.149996758 */,
+  /* 254 */  0x64896a6fUL /* 1608.588484764 */,
+  /* 255 */  0x65109bdfUL /* 1617.038054466 */,
+
+  /* 256 */  0x6597fa95UL /* 1625.498677254 */,
+  /* 257 */  0x661f8672UL /* 1633.970323563 */
+# endif
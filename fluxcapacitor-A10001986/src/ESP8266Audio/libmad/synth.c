@@ -140,7 +140,7 @@ void mad_synth_mute(struct mad_synth *synth)
    NAME:	dct32()
    DESCRIPTION:	perform fast in[32]->out[32] DCT
 */
-static
+static MAD_IRAM1
 void dct32(mad_fixed_t const in[32], unsigned int slot,
            mad_fixed_t lo[16][8], mad_fixed_t hi[16][8])
 {
@@ -167,6 +167,7 @@ void dct32(mad_fixed_t const in[32], unsigned int slot,
   mad_fixed_t t160, t161, t162, t163, t164, t165, t166, t167;
   mad_fixed_t t168, t169, t170, t171, t172, t173, t174, t175;
   mad_fixed_t t176;
+  MAD_PROF_BEGIN(prof);
   stack(__FUNCTION__, __FILE__, __LINE__);
   /* costab[i] = cos(PI / (2 * 32) * i) */
 
@@ -530,6 +531,8 @@ void dct32(mad_fixed_t const in[32], unsigned int slot,
      119 subtractions
       49 shifts (not counting SSO)
   */
+
+  MAD_PROF_END(MAD_PROF_DCT32, prof);
 }
 
 # undef MUL
@@ -563,7 +566,7 @@ void dct32(mad_fixed_t const in[32], unsigned int slot,
 # endif
 
 static
-mad_fixed_t const D[17][32] PROGMEM = {
+mad_fixed_t const D[17][32] MAD_DRAM1 = {
 # include "D.dat.h"
 };
 
@@ -575,7 +578,7 @@ void synth_full(struct mad_synth *, struct mad_frame const *,
    NAME:	synth->full()
    DESCRIPTION:	perform full frequency PCM synthesis
 */
-static
+static MAD_IRAM1
 enum mad_flow synth_full(struct mad_synth *synth, struct mad_frame const *frame,
                 unsigned int nch, unsigned int startns, unsigned int endns,
                 enum mad_flow (*output_func)(void *s, struct mad_header const *, struct mad_pcm *), void *cbdata)
@@ -722,7 +725,7 @@ enum mad_flow synth_full(struct mad_synth *synth, struct mad_frame const *frame,
    NAME:	synth->half()
    DESCRIPTION:	perform half frequency PCM synthesis
 */
-static
+static MAD_IRAM1
 enum mad_flow synth_half(struct mad_synth *synth, struct mad_frame const *frame,
                 unsigned int nch, unsigned int startns, unsigned int endns,
                 enum mad_flow (*output_func)(void *s, struct mad_header const *, struct mad_pcm *), void *cbdata )
@@ -879,6 +882,10 @@ enum mad_flow mad_synth_frame(struct mad_synth *synth, struct mad_frame const *f
   nch = MAD_NCHANNELS(&frame->header);
   ns  = MAD_NSBSAMPLES(&frame->header);
 
+  /* channels were downmixed by mad_frame_decode() */
+  if ((frame->options & MAD_OPTION_SINGLECHANNEL) == MAD_OPTION_SINGLECHANNEL)
+    nch = 1;
+
   synth->pcm.samplerate = frame->header.samplerate;
   synth->pcm.channels   = nch;
   synth->pcm.length     = 32;// * ns;
@@ -892,7 +899,9 @@ enum mad_flow mad_synth_frame(struct mad_synth *synth, struct mad_frame const *f
     synth_frame = synth_half;
   }
 
+  MAD_PROF_BEGIN(prof);
   enum mad_flow ret = synth_frame(synth, frame, nch, 0, ns, output_func, cbdata);
+  MAD_PROF_END(MAD_PROF_SYNTH, prof);
 
   synth->phase = (synth->phase + ns) % 16;
 
@@ -909,6 +918,10 @@ enum mad_flow mad_synth_frame_onens(struct mad_synth *synth, struct mad_frame co
   nch = MAD_NCHANNELS(&frame->header);
 //  ns  = MAD_NSBSAMPLES(&frame->header);
 
+  /* channels were downmixed by mad_frame_decode() */
+  if ((frame->options & MAD_OPTION_SINGLECHANNEL) == MAD_OPTION_SINGLECHANNEL)
+    nch = 1;
+
   synth->pcm.samplerate = frame->header.samplerate;
   synth->pcm.channels   = nch;
   synth->pcm.length     = 32;// * ns;
@@ -921,7 +934,9 @@ enum mad_flow mad_synth_frame_onens(struct mad_synth *synth, struct mad_frame co
 
     synth_frame = synth_half;
   }
+  MAD_PROF_BEGIN(prof);
   enum mad_flow ret = synth_frame(synth, frame, nch, ns, ns+1, NULL, NULL);
+  MAD_PROF_END(MAD_PROF_SYNTH, prof);
 
   if (ns==MAD_NSBSAMPLES(&frame->header)-1)
     synth->phase = (synth->phase + MAD_NSBSAMPLES(&frame->header)) % 16;
@@ -54,6 +54,8 @@ char const mad_build[] = ""
   "FPM_SPARC "
 # elif defined(FPM_PPC)
   "FPM_PPC "
+# elif defined(FPM_XTENSA)
+  "FPM_XTENSA "
 # elif defined(FPM_DEFAULT)
   "FPM_DEFAULT "
 # endif
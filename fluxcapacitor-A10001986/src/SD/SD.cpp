@@ -131,5 +131,72 @@ bool SDFS::writeRAW(uint8_t* buffer, uint32_t sector)
     return sd_write_raw(_pdrv, buffer, sector);
 }
 
+bool SDFS::readCID(uint8_t* cid)
+{
+    if(_pdrv == 0xFF) {
+        return false;
+    }
+    return sdcard_read_cid(_pdrv, cid);
+}
+
+uint32_t SDFS::getFrequency()
+{
+    if(_pdrv == 0xFF) {
+        return 0;
+    }
+    return sdcard_get_frequency(_pdrv);
+}
+
+void SDFS::setFrequency(uint32_t frequency)
+{
+    if(_pdrv != 0xFF) {
+        sdcard_set_frequency(_pdrv, frequency);
+    }
+}
+
+// Raw multi-sector read with CRC check, for clock calibration
+bool SDFS::testRead(uint8_t* buffer, uint32_t sector, int count)
+{
+    if(_pdrv == 0xFF) {
+        return false;
+    }
+    return sdcard_test_read(_pdrv, buffer, sector, count);
+}
+
+// Skip CRC check on data read (CRC is still sent
+// by the card, and still generated on write).
+void SDFS::setCRCVerify(bool verify)
+{
+    if(_pdrv != 0xFF) {
+        sdcard_set_crc_verify(_pdrv, verify);
+    }
+}
+
+bool SDFS::cacheStats(sd_cache_stats_t *stats)
+{
+    if(_pdrv == 0xFF) {
+        return false;
+    }
+    return sdcard_cache_stats(_pdrv, stats);
+}
+
+// Create path (relative to mount point) with size bytes
+// allocated; re-open with "r+" to write it.
+bool SDFS::preallocate(const char* path, uint64_t size)
+{
+    if(_pdrv == 0xFF) {
+        return false;
+    }
+    return sdcard_preallocate(_pdrv, path, size);
+}
+
+bool SDFS::truncate(const char* path, uint64_t size)
+{
+    if(_pdrv == 0xFF) {
+        return false;
+    }
+    return sdcard_truncate(_pdrv, path, size);
+}
+
 
 SDFS SD = SDFS(FSImplPtr(new VFSImpl()));
@@ -17,6 +17,7 @@
 #include "FS.h"
 #include "SPI.h"
 #include "sd_defines.h"
+#include "sd_cache.h"
 
 namespace fs
 {
@@ -38,6 +39,14 @@ public:
     uint64_t usedBytes();
     bool readRAW(uint8_t* buffer, uint32_t sector);
     bool writeRAW(uint8_t* buffer, uint32_t sector);
+    bool readCID(uint8_t* cid);
+    uint32_t getFrequency();
+    void setFrequency(uint32_t frequency);
+    bool testRead(uint8_t* buffer, uint32_t sector, int count);
+    void setCRCVerify(bool verify);
+    bool cacheStats(sd_cache_stats_t *stats);
+    bool preallocate(const char* path, uint64_t size);
+    bool truncate(const char* path, uint64_t size);
 };
 
 }
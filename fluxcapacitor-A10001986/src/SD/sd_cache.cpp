@@ -0,0 +1,208 @@
+// Sector cache for sd_diskio
+//
+// (C) 2026 Thomas Winischhofer (A10001986)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "sd_cache.h"
+
+#define SECSIZE 512
+
+typedef struct {
+    uint32_t base;      // first sector of line
+    uint32_t valid;     // valid bit per sector
+    uint32_t lru;       // tick of last access
+} sd_cache_line_t;
+
+struct sd_cache {
+    int sets;
+    int ways;
+    int lineSectors;
+    uint32_t tick;
+    uint32_t nextSector;
+    uint32_t numSectors;
+    sd_cache_line_t *lines;
+    uint8_t *data;
+    sd_cache_stats_t stats;
+};
+
+sd_cache_t *sd_cache_new(int sets, int ways, int lineSectors)
+{
+    sd_cache_t *c;
+
+    if (sets < 1 || ways < 1 || lineSectors < 1 || lineSectors > 32) {
+        return NULL;
+    }
+
+    if (!(c = (sd_cache_t *)calloc(1, sizeof(sd_cache_t)))) {
+        return NULL;
+    }
+
+    c->sets = sets;
+    c->ways = ways;
+    c->lineSectors = lineSectors;
+    c->lines = (sd_cache_line_t *)calloc(sets * ways, sizeof(sd_cache_line_t));
+    c->data = (uint8_t *)malloc(sets * ways * lineSectors * SECSIZE);
+
+    if (!c->lines || !c->data) {
+        sd_cache_free(c);
+        return NULL;
+    }
+
+    return c;
+}
+
+void sd_cache_free(sd_cache_t *c)
+{
+    if (c) {
+        free(c->lines);
+        free(c->data);
+        free(c);
+    }
+}
+
+static inline uint32_t lineMask(int off, int n)
+{
+    return ((n >= 32) ? 0xffffffff : ((1UL << n) - 1)) << off;
+}
+
+static int findLine(sd_cache_t *c, uint32_t base)
+{
+    int set = (base / c->lineSectors) % c->sets;
+    int i = set * c->ways;
+
+    for (int w = 0; w < c->ways; w++, i++) {
+        if (c->lines[i].valid && c->lines[i].base == base) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int victimLine(sd_cache_t *c, uint32_t base)
+{
+    int set = (base / c->lineSectors) % c->sets;
+    int i = set * c->ways, v = i;
+
+    for (int w = 0; w < c->ways; w++, i++) {
+        if (!c->lines[i].valid) {
+            return i;
+        }
+        if ((int32_t)(c->lines[i].lru - c->lines[v].lru) < 0) {
+            v = i;
+        }
+    }
+    return v;
+}
+
+bool sd_cache_read(sd_cache_t *c, uint8_t *buf, uint32_t sector, uint32_t count, sd_cache_rd_t rd, void *ctx)
+{
+    bool streaming;
+    uint32_t base, bits;
+    uint8_t *ldata;
+    int off, n, i;
+
+    if (count > 1) {
+        // FatFS does this for whole-sector file data
+        // only; no point in caching that.
+        c->nextSector = sector + count;
+        c->stats.bypassed += count;
+        c->stats.devReads++;
+        c->stats.devBytes += count * SECSIZE;
+        return rd(ctx, buf, sector, count);
+    }
+
+    streaming = (sector == c->nextSector);
+    c->nextSector = sector + 1;
+
+    off = sector % c->lineSectors;
+    base = sector - off;
+
+    if ((i = findLine(c, base)) >= 0) {
+        if (c->lines[i].valid & (1UL << off)) {
+            c->lines[i].lru = ++c->tick;
+            memcpy(buf, c->data + ((i * c->lineSectors) + off) * SECSIZE, SECSIZE);
+            c->stats.hits++;
+            return true;
+        }
+    } else {
+        i = victimLine(c, base);
+        c->lines[i].base = base;
+        c->lines[i].valid = 0;
+    }
+
+    c->stats.misses++;
+
+    // If streaming, fetch up to end of line
+    n = streaming ? c->lineSectors - off : 1;
+    if (c->numSectors && sector + n > c->numSectors) {
+        n = c->numSectors - sector;
+        if (n < 1) n = 1;
+    }
+    bits = lineMask(off, n);
+    ldata = c->data + ((i * c->lineSectors) + off) * SECSIZE;
+
+    c->stats.devReads++;
+    c->stats.devBytes += n * SECSIZE;
+
+    if (!rd(ctx, ldata, sector, n)) {
+        c->lines[i].valid &= ~bits;
+        return false;
+    }
+
+    c->stats.readAhead += n - 1;
+    c->lines[i].valid |= bits;
+    c->lines[i].lru = ++c->tick;
+    memcpy(buf, ldata, SECSIZE);
+
+    return true;
+}
+
+void sd_cache_invalidate(sd_cache_t *c, uint32_t sector, uint32_t count)
+{
+    while (count) {
+        int off = sector % c->lineSectors;
+        int n = c->lineSectors - off;
+        int i;
+
+        if ((uint32_t)n > count) n = count;
+
+        if ((i = findLine(c, sector - off)) >= 0) {
+            c->lines[i].valid &= ~lineMask(off, n);
+        }
+
+        sector += n;
+        count -= n;
+    }
+}
+
+void sd_cache_flush(sd_cache_t *c)
+{
+    for (int i = 0; i < c->sets * c->ways; i++) {
+        c->lines[i].valid = 0;
+    }
+    c->nextSector = 0;
+}
+
+void sd_cache_set_size(sd_cache_t *c, uint32_t numSectors)
+{
+    c->numSectors = numSectors;
+}
+
+void sd_cache_get_stats(sd_cache_t *c, sd_cache_stats_t *stats)
+{
+    *stats = c->stats;
+}
@@ -0,0 +1,54 @@
+// Sector cache for sd_diskio
+//
+// (C) 2026 Thomas Winischhofer (A10001986)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef _SD_CACHE_H_
+#define _SD_CACHE_H_
+
+#include <stdint.h>
+
+// N-way set associative, write-through sector cache. A cache line
+// holds lineSectors consecutive sectors (aligned), each with its own
+// valid bit. Single sector reads that continue the previous read
+// ("streaming") fetch the rest of the line in one multi-block read.
+// Reads of more than one sector bypass the cache.
+//
+// The cache does not know about SD cards; the block device is
+// accessed through a callback, so it can be used with any device
+// (eg a RAM disk on the host).
+
+typedef bool (*sd_cache_rd_t)(void *ctx, uint8_t *buf, uint32_t sector, uint32_t count);
+
+typedef struct {
+    uint32_t hits;          // sectors served from cache
+    uint32_t misses;        // single sector reads not in cache
+    uint32_t bypassed;      // sectors read by multi-sector reads
+    uint32_t readAhead;     // sectors fetched ahead of time
+    uint32_t devReads;      // read commands issued to device
+    uint64_t devBytes;      // bytes read from device
+} sd_cache_stats_t;
+
+typedef struct sd_cache sd_cache_t;
+
+sd_cache_t *sd_cache_new(int sets, int ways, int lineSectors);
+void sd_cache_free(sd_cache_t *c);
+
+bool sd_cache_read(sd_cache_t *c, uint8_t *buf, uint32_t sector, uint32_t count, sd_cache_rd_t rd, void *ctx);
+void sd_cache_invalidate(sd_cache_t *c, uint32_t sector, uint32_t count);
+void sd_cache_flush(sd_cache_t *c);
+void sd_cache_set_size(sd_cache_t *c, uint32_t numSectors);
+
+void sd_cache_get_stats(sd_cache_t *c, sd_cache_stats_t *stats);
+
+#endif /* _SD_CACHE_H_ */
@@ -62,7 +62,11 @@ typedef struct {
     sdcard_type_t type;
     unsigned long sectors;
     bool supports_crc;
+    bool verify_crc;
     int status;
+#ifdef TW_SD_CACHE
+    sd_cache_t *cache;
+#endif
 } ardu_sdcard_t;
 
 static ardu_sdcard_t* s_cards[FF_VOLUMES] = { NULL };
@@ -103,6 +107,12 @@ bool sdWait(uint8_t pdrv, int timeout)
 
     do {
         resp = s_cards[pdrv]->spi->transfer(0xFF);
+        #ifdef TW_SD_YIELD
+        // Card busy (eg programming): Let other tasks run
+        if (resp == 0x00 && (millis() - start) >= 2) {
+            delay(1);
+        }
+        #endif
     } while (resp == 0x00 && (millis() - start) < (unsigned int)timeout);
 
     #ifdef TW_SD_DEBUG
@@ -228,6 +238,11 @@ bool sdReadBytes(uint8_t pdrv, char* buffer, int length)
     uint32_t start = millis();
     do {
         token = card->spi->transfer(0xFF);
+        #ifdef TW_SD_YIELD
+        if (token == 0xFF && (millis() - start) >= 2) {
+            delay(1);
+        }
+        #endif
     } while (token == 0xFF && (millis() - start) < 500);
 
     if (token != 0xFE) {
@@ -236,7 +251,7 @@ bool sdReadBytes(uint8_t pdrv, char* buffer, int length)
 
     card->spi->transferBytes(NULL, (uint8_t*)buffer, length);
     crc = card->spi->transfer16(0xFFFF);
-    return (!card->supports_crc || crc == CRC16(buffer, length));
+    return (!card->supports_crc || !card->verify_crc || crc == CRC16(buffer, length));
 }
 
 char sdWriteBytes(uint8_t pdrv, const char* buffer, char token)
@@ -433,6 +448,20 @@ bool sdWriteSectors(uint8_t pdrv, const char* buffer, unsigned long long sector,
     return false;
 }
 
+bool sdReadCID(uint8_t pdrv, char* cid)
+{
+    bool success = false;
+
+    if(!sdSelectCard(pdrv)) {
+        return false;
+    }
+    if (!sdCommand(pdrv, SEND_CID, 0, NULL)) {
+        success = sdReadBytes(pdrv, cid, 16);
+    }
+    sdDeselectCard(pdrv);
+    return success;
+}
+
 unsigned long sdGetSectorsCount(uint8_t pdrv)
 {
     for (int f = 0; f < 3; f++) {
@@ -503,6 +532,18 @@ private:
 }
 
 
+#ifdef TW_SD_CACHE
+static bool sdCacheRead(void *ctx, uint8_t *buffer, uint32_t sector, uint32_t count)
+{
+    uint8_t pdrv = (uint8_t)(uintptr_t)ctx;
+
+    if (count > 1) {
+        return sdReadSectors(pdrv, (char*)buffer, sector, count);
+    }
+    return sdReadSector(pdrv, (char*)buffer, sector);
+}
+#endif
+
 /*
  * FATFS API
  * */
@@ -715,6 +756,13 @@ DSTATUS ff_sd_initialize(uint8_t pdrv)
         card->frequency = 25000000;
     }
 
+    #ifdef TW_SD_CACHE
+    if (card->cache) {
+        sd_cache_flush(card->cache);
+        sd_cache_set_size(card->cache, card->sectors);
+    }
+    #endif
+
     // Mark card as initialized
     card->status &= ~STA_NOINIT;
     return card->status;
@@ -748,6 +796,12 @@ DRESULT ff_sd_read(uint8_t pdrv, uint8_t* buffer, DWORD sector, UINT count)
 
     AcquireSPI lock(card);
 
+    #ifdef TW_SD_CACHE
+    if (card->cache) {
+        return sd_cache_read(card->cache, buffer, sector, count, sdCacheRead, (void *)(uintptr_t)pdrv) ? RES_OK : RES_ERROR;
+    }
+    #endif
+
     if (count > 1) {
         res = sdReadSectors(pdrv, (char*)buffer, sector, count) ? RES_OK : RES_ERROR;
     } else {
@@ -770,6 +824,12 @@ DRESULT ff_sd_write(uint8_t pdrv, const uint8_t* buffer, DWORD sector, UINT coun
 
     AcquireSPI lock(card);
 
+    #ifdef TW_SD_CACHE
+    if (card->cache) {
+        sd_cache_invalidate(card->cache, sector, count);
+    }
+    #endif
+
     if (count > 1) {
         res = sdWriteSectors(pdrv, (const char*)buffer, sector, count) ? RES_OK : RES_ERROR;
     } else {
@@ -832,6 +892,9 @@ uint8_t sdcard_uninit(uint8_t pdrv)
         err = esp_vfs_fat_unregister_path(card->base_path);
         free(card->base_path);
     }
+    #ifdef TW_SD_CACHE
+    sd_cache_free(card->cache);
+    #endif
     free(card);
     return err;
 }
@@ -855,9 +918,19 @@ uint8_t sdcard_init(uint8_t cs, SPIClass * spi, int hz)
     card->ssPin = cs;
 
     card->supports_crc = true;
+    card->verify_crc = true;
     card->type = CARD_NONE;
     card->status = STA_NOINIT;
 
+    #ifdef TW_SD_CACHE
+    card->cache = sd_cache_new(TW_SD_CACHE_SETS, TW_SD_CACHE_WAYS, TW_SD_CACHE_LINE);
+    #ifdef TW_SD_DEBUG
+    if (!card->cache) {
+        Serial.println("Failed to allocate sector cache");
+    }
+    #endif
+    #endif
+
     pinMode(card->ssPin, OUTPUT);
     digitalWrite(card->ssPin, HIGH);
 
@@ -884,6 +957,12 @@ uint8_t sdcard_unmount(uint8_t pdrv)
     card->status |= STA_NOINIT;
     card->type = CARD_NONE;
 
+    #ifdef TW_SD_CACHE
+    if (card->cache) {
+        sd_cache_flush(card->cache);
+    }
+    #endif
+
     char drv[3] = {(char)('0' + pdrv), ':', 0};
     f_mount(NULL, drv, 0);
     return 0;
@@ -941,6 +1020,11 @@ bool sdcard_mount(uint8_t pdrv, const char* path, uint8_t max_files, bool format
     }
     AcquireSPI lock(card);
     card->sectors = sdGetSectorsCount(pdrv);
+    #ifdef TW_SD_CACHE
+    if (card->cache) {
+        sd_cache_set_size(card->cache, card->sectors);
+    }
+    #endif
     return true;
 }
 
@@ -969,3 +1053,135 @@ sdcard_type_t sdcard_type(uint8_t pdrv)
     }
     return card->type;
 }
+
+void sdcard_set_crc_verify(uint8_t pdrv, bool verify)
+{
+    ardu_sdcard_t * card = s_cards[pdrv];
+    if(pdrv >= FF_VOLUMES || card == NULL){
+        return;
+    }
+    card->verify_crc = verify;
+}
+
+bool sdcard_cache_stats(uint8_t pdrv, sd_cache_stats_t *stats)
+{
+    #ifdef TW_SD_CACHE
+    ardu_sdcard_t * card = s_cards[pdrv];
+    if(pdrv >= FF_VOLUMES || card == NULL || card->cache == NULL){
+        return false;
+    }
+    sd_cache_get_stats(card->cache, stats);
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+/*
+ * Clock calibration helpers
+ * */
+
+bool sdcard_read_cid(uint8_t pdrv, uint8_t* cid)
+{
+    ardu_sdcard_t * card = s_cards[pdrv];
+    if(pdrv >= FF_VOLUMES || card == NULL || (card->status & STA_NOINIT)){
+        return false;
+    }
+    AcquireSPI lock(card);
+    return sdReadCID(pdrv, (char*)cid);
+}
+
+uint32_t sdcard_get_frequency(uint8_t pdrv)
+{
+    ardu_sdcard_t * card = s_cards[pdrv];
+    if(pdrv >= FF_VOLUMES || card == NULL){
+        return 0;
+    }
+    return card->frequency;
+}
+
+void sdcard_set_frequency(uint8_t pdrv, uint32_t hz)
+{
+    ardu_sdcard_t * card = s_cards[pdrv];
+    if(pdrv >= FF_VOLUMES || card == NULL){
+        return;
+    }
+    AcquireSPI lock(card);
+    card->frequency = (hz > 25000000) ? 25000000 : hz;
+}
+
+// Read count sectors at current clock, bypassing the
+// cache. Fails if the card does not do CRC, since the
+// result would be meaningless for calibration.
+bool sdcard_test_read(uint8_t pdrv, uint8_t* buffer, uint32_t sector, int count)
+{
+    ardu_sdcard_t * card = s_cards[pdrv];
+    if(pdrv >= FF_VOLUMES || card == NULL || (card->status & STA_NOINIT) || !card->supports_crc){
+        return false;
+    }
+    AcquireSPI lock(card);
+    bool oldVerify = card->verify_crc;
+    card->verify_crc = true;
+    bool success = sdReadSectors(pdrv, (char*)buffer, sector, count);
+    card->verify_crc = oldVerify;
+    return success;
+}
+
+// Pre-allocate a file of the given size through FatFS, contiguous
+// if possible, so that later writes through the VFS do not have to
+// walk and extend the FAT per cluster. path is relative to the
+// mount point. The file is left with the full size; truncate it
+// to the real size once written (sdcard_truncate).
+bool sdcard_preallocate(uint8_t pdrv, const char* path, uint64_t size)
+{
+    FIL fil;
+    FRESULT res;
+    char fpath[FF_MAX_LFN + 4];
+
+    if(pdrv >= FF_VOLUMES || s_cards[pdrv] == NULL || size > 0xffffffffULL){
+        return false;
+    }
+    snprintf(fpath, sizeof(fpath), "%u:%s", pdrv, path);
+
+    if((res = f_open(&fil, fpath, FA_CREATE_ALWAYS | FA_WRITE)) != FR_OK){
+        log_e("f_open failed: %s", fferr2str[res]);
+        return false;
+    }
+#if FF_USE_EXPAND
+    if((res = f_expand(&fil, (FSIZE_t)size, 1)) != FR_OK)
+#endif
+    {
+        // Seeking beyond the end in write mode extends the chain
+        res = f_lseek(&fil, (FSIZE_t)size);
+        if(res == FR_OK && f_tell(&fil) != (FSIZE_t)size){
+            res = FR_DENIED;    // Disk full
+        }
+    }
+    f_close(&fil);
+    if(res != FR_OK){
+        f_unlink(fpath);
+        return false;
+    }
+    return true;
+}
+
+bool sdcard_truncate(uint8_t pdrv, const char* path, uint64_t size)
+{
+    FIL fil;
+    FRESULT res;
+    char fpath[FF_MAX_LFN + 4];
+
+    if(pdrv >= FF_VOLUMES || s_cards[pdrv] == NULL){
+        return false;
+    }
+    snprintf(fpath, sizeof(fpath), "%u:%s", pdrv, path);
+
+    if((res = f_open(&fil, fpath, FA_OPEN_EXISTING | FA_WRITE)) != FR_OK){
+        return false;
+    }
+    if((res = f_lseek(&fil, (FSIZE_t)size)) == FR_OK){
+        res = f_truncate(&fil);
+    }
+    f_close(&fil);
+    return (res == FR_OK);
+}
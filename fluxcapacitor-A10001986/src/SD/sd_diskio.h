@@ -17,6 +17,7 @@
 #include "Arduino.h"
 #include "SPI.h"
 #include "sd_defines.h"
+#include "sd_cache.h"
 // #include "diskio.h"
 
 uint8_t sdcard_init(uint8_t cs, SPIClass * spi, int hz);
@@ -30,5 +31,13 @@ uint32_t sdcard_num_sectors(uint8_t pdrv);
 uint32_t sdcard_sector_size(uint8_t pdrv);
 bool sd_read_raw(uint8_t pdrv, uint8_t* buffer, uint32_t sector);
 bool sd_write_raw(uint8_t pdrv, uint8_t* buffer, uint32_t sector);
+bool sdcard_read_cid(uint8_t pdrv, uint8_t* cid);
+uint32_t sdcard_get_frequency(uint8_t pdrv);
+void sdcard_set_frequency(uint8_t pdrv, uint32_t hz);
+bool sdcard_test_read(uint8_t pdrv, uint8_t* buffer, uint32_t sector, int count);
+void sdcard_set_crc_verify(uint8_t pdrv, bool verify);
+bool sdcard_cache_stats(uint8_t pdrv, sd_cache_stats_t *stats);
+bool sdcard_preallocate(uint8_t pdrv, const char* path, uint64_t size);
+bool sdcard_truncate(uint8_t pdrv, const char* path, uint64_t size);
 
 #endif /* _SD_DISKIO_H_ */
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "sd_local.h"
+
 const char m_CRC7Table[] = {
     0x00, 0x09, 0x12, 0x1B, 0x24, 0x2D, 0x36, 0x3F,
     0x48, 0x41, 0x5A, 0x53, 0x6C, 0x65, 0x7E, 0x77,
@@ -93,11 +95,58 @@ const unsigned short m_CRC16Table[256] = {
     0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
 };
 
+#if TW_SD_CRC_SLICE > 1
+// Slice tables: m_CRC16Slice[k-1][b] is the CRC of byte b
+// followed by k zero bytes. Built on first use (DRAM).
+static unsigned short m_CRC16Slice[TW_SD_CRC_SLICE - 1][256];
+static volatile int m_CRC16SliceInit = 0;
+
+static void CRC16InitSlices(void)
+{
+    for (int i = 0; i < 256; i++) {
+        unsigned short crc = m_CRC16Table[i];
+        for (int k = 0; k < TW_SD_CRC_SLICE - 1; k++) {
+            crc = (crc << 8) ^ m_CRC16Table[crc >> 8];
+            m_CRC16Slice[k][i] = crc;
+        }
+    }
+    m_CRC16SliceInit = 1;
+}
+#endif
+
 unsigned short CRC16(const char* data, int length)
 {
     unsigned short crc = 0;
+#if TW_SD_CRC_SLICE > 1
+    const unsigned char *d = (const unsigned char *)data;
+
+    if (!m_CRC16SliceInit) {
+        CRC16InitSlices();
+    }
+
+    #if TW_SD_CRC_SLICE >= 8
+    while (length >= 8) {
+        crc = m_CRC16Slice[6][(crc >> 8) ^ d[0]] ^ m_CRC16Slice[5][(crc & 0xFF) ^ d[1]] ^
+              m_CRC16Slice[4][d[2]] ^ m_CRC16Slice[3][d[3]] ^
+              m_CRC16Slice[2][d[4]] ^ m_CRC16Slice[1][d[5]] ^
+              m_CRC16Slice[0][d[6]] ^ m_CRC16Table[d[7]];
+        d += 8;
+        length -= 8;
+    }
+    #endif
+    while (length >= 4) {
+        crc = m_CRC16Slice[2][(crc >> 8) ^ d[0]] ^ m_CRC16Slice[1][(crc & 0xFF) ^ d[1]] ^
+              m_CRC16Slice[0][d[2]] ^ m_CRC16Table[d[3]];
+        d += 4;
+        length -= 4;
+    }
+    while (length--) {
+        crc = (crc << 8) ^ m_CRC16Table[(crc >> 8) ^ *d++];
+    }
+#else
     for (int i = 0; i < length; i++) {
         crc = (crc << 8) ^ m_CRC16Table[((crc >> 8) ^ data[i]) & 0x00FF];
     }
+#endif
     return crc;
 }
@@ -6,4 +6,21 @@
 #define TW_SD_DEBUG
 #endif
 
+// Sleep instead of spinning while waiting for the card to
+// become ready or to send data (after 2ms)
+//#define TW_SD_YIELD
+
+// CRC16 for data blocks: 1 = byte-wise, 4 or 8 = slice-by-4/8
+// (slice tables use (N-1) * 512 bytes of DRAM)
+#ifndef TW_SD_CRC_SLICE
+#define TW_SD_CRC_SLICE   4
+#endif
+
+// Sector cache (see sd_cache.h)
+// Memory use is SETS * WAYS * LINE * 512 bytes
+//#define TW_SD_CACHE
+#define TW_SD_CACHE_SETS  2
+#define TW_SD_CACHE_WAYS  2
+#define TW_SD_CACHE_LINE  4     // sectors per line, max 32
+
 #endif
\ No newline at end of file
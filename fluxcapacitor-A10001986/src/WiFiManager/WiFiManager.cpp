@@ -945,6 +945,16 @@ void WiFiManager::setupHTTPServer()
     // This is not the safest way to reset the webserver, it can cause crashes
     // on callbacks initialized before this and since its a shared pointer...
 
+    {
+        // Headers available to handlers (including the app's)
+        static const char *hdrs[] = { "Content-Length", "If-None-Match" };
+        server->collectHeaders(hdrs, 2);
+    }
+
+    #ifdef WM_ASSETS
+    addStaticAssets(wmAssets, WMA_COUNT);
+    #endif
+
     if(_webservercallback) {
         _webservercallback();
     }
@@ -1287,29 +1297,47 @@ unsigned int WiFiManager::getHTTPHeadLength(const char *title, uint32_t incFlags
     #else
     bufSize += strlen(_title);
     #endif
-    bufSize += STRLEN(HTTP_SCRIPT) + STRLEN(HTTP_STYLE) + STRLEN(HTTP_STYLE_END);
-    if(incFlags & incSTA) {
-        bufSize += STRLEN(HTTP_STYLE_STA);
+    #ifdef WM_ASSETS
+    bufSize += STRLEN(HTTP_ASSET_HEAD) + STRLEN(HTTP_ASSET_STYLE) + STRLEN(HTTP_STYLE_END);
+    if(incFlags & incGFXMSG) {
+        bufSize += STRLEN(HTTP_ASSET_MSG);
     }
+    if(incFlags & incC80) {
+        bufSize += STRLEN(HTTP_ASSET_C80);
+    }
+    if(incFlags & incQI) {
+        bufSize += STRLEN(HTTP_ASSET_QI);
+    }
+    #else
+    bufSize += STRLEN(HTTP_SCRIPT) + STRLEN(HTTP_STYLE) + STRLEN(HTTP_STYLE_END);
     if(incFlags & incGFXMSG) {
         bufSize += STRLEN(HTTP_STYLE_MSG);
     }
     if(incFlags & incC80) {
         bufSize += STRLEN(HTTP_STYLE_C80);
+    }
+    if(incFlags & incQI) {
+        bufSize += STRLEN(HTTP_SCRIPT_QI) + STRLEN(HTTP_STYLE_QI);
+    }
+    if(incFlags & incUPL) {
+        bufSize += STRLEN(HTTP_SCRIPT_UPL);
+    }
+    #endif
+    if(incFlags & incSTA) {
+        bufSize += STRLEN(HTTP_STYLE_STA);
+    }
+    if(incFlags & incC80) {
         if(incFlags & incUPLF) {
             bufSize += STRLEN(HTTP_STYLE_UPLF);
         } else {
             bufSize += STRLEN(HTTP_STYLE_UPLN);
         }
     }
-    if(incFlags & incQI) {
-        bufSize += STRLEN(HTTP_SCRIPT_QI) + STRLEN(HTTP_STYLE_QI);
-    }
     if(incFlags & incSET) {
         bufSize += STRLEN(HTTP_STYLE_SET);
     }
     if(incFlags & incUPL) {
-        bufSize += STRLEN(HTTP_SCRIPT_UPL) + STRLEN(HTTP_STYLE_UPL);
+        bufSize += STRLEN(HTTP_STYLE_UPL);
     }
 
     if(_customHeadElement) {
@@ -1323,7 +1351,7 @@ unsigned int WiFiManager::getHTTPHeadLength(const char *title, uint32_t incFlags
 }
 
 // Construct header
-void WiFiManager::getHTTPHeadNew(String& page, const char *title, uint32_t incFlags)
+void WiFiManager::getHTTPHeadNew(WMPage& page, const char *title, uint32_t incFlags)
 {
     String temp;
     #ifdef INDIV_TITLES
@@ -1340,6 +1368,31 @@ void WiFiManager::getHTTPHeadNew(String& page, const char *title, uint32_t incFl
     #endif
     page += temp;
 
+    #ifdef WM_ASSETS
+    // Script and static CSS are linked; only the small
+    // page-specific fragments are inlined
+    page += FPSTR(HTTP_ASSET_HEAD);
+    if(incFlags & incGFXMSG) {
+        page += FPSTR(HTTP_ASSET_MSG);
+    }
+    if(incFlags & incC80) {
+        page += FPSTR(HTTP_ASSET_C80);
+    }
+    if(incFlags & incQI) {
+        page += FPSTR(HTTP_ASSET_QI);
+    }
+    page += FPSTR(HTTP_ASSET_STYLE);
+    if(incFlags & incSTA) {
+        page += FPSTR(HTTP_STYLE_STA);
+    }
+    if(incFlags & incC80) {
+        if(incFlags & incUPLF) {
+            page += FPSTR(HTTP_STYLE_UPLF);
+        } else {
+            page += FPSTR(HTTP_STYLE_UPLN);
+        }
+    }
+    #else
     page += FPSTR(HTTP_SCRIPT);
     if(incFlags & incUPL) {
         page += HTTP_SCRIPT_UPL;
@@ -1365,6 +1418,7 @@ void WiFiManager::getHTTPHeadNew(String& page, const char *title, uint32_t incFl
     if(incFlags & incQI) {
         page += FPSTR(HTTP_STYLE_QI);
     }
+    #endif
     if(incFlags & incSET) {
         page += FPSTR(HTTP_STYLE_SET);
     }
@@ -1445,7 +1499,7 @@ int WiFiManager::reportStatusLen(bool withMac)
     return bufSize + 8;
 }
 
-void WiFiManager::reportStatus(String& page, unsigned int estSize, bool withMac)
+void WiFiManager::reportStatus(WMPage& page, unsigned int estSize, bool withMac)
 {
     char pbssid[STRLEN(HTTP_BSSID_FOOT)-2+17+1];
     String SSID = String(_ssid);
@@ -1636,7 +1690,7 @@ unsigned int WiFiManager::getParamOutSize(WiFiManagerParameter** params,
     return totalsize;
 }
 
-void WiFiManager::getParamOut(String &page, WiFiManagerParameter** params,
+void WiFiManager::getParamOut(WMPage &page, WiFiManagerParameter** params,
                     int paramsCount, unsigned int maxItemSize)
 {
     if(paramsCount > 0) {
@@ -1847,6 +1901,28 @@ void WiFiManager::HTTPSend(const String& content, bool sendCC)
     yield();
 }
 
+void WiFiManager::HTTPSend(WMPage& page)
+{
+#ifdef WM_STREAM
+    #ifdef _A10001986_DBG
+    unsigned long now = millis();
+    #endif
+
+    // Headers (incl. cache-control, as passed to
+    // the WMPage constructor) went out with the
+    // first chunk; only the tail is left to send.
+    page.end();
+
+    #ifdef _A10001986_DBG
+    Serial.printf("HTTPSend (tail) took %d, content size %d, heap %d\n\n", millis() - now, page.length(), ESP.getFreeHeap());
+    #endif
+
+    yield();
+#else
+    HTTPSend(page, page.sendCC());
+#endif
+}
+
 /****************************************************************************
  *
  * Website handling: Page handlers
@@ -1893,7 +1969,7 @@ int WiFiManager::getMenuOutLength(unsigned int& appExtraSize)
 }
 
 // Construct root menu
-void WiFiManager::getMenuOut(String& page, unsigned int appExtraSize)
+void WiFiManager::getMenuOut(WMPage& page, unsigned int appExtraSize)
 {
     if(_menuIdArr) {
         int menuId = 0;
@@ -1950,7 +2026,7 @@ unsigned int WiFiManager::calcRootLen(unsigned int& repSize, unsigned int& appEx
     return bufSize;
 }
 
-void WiFiManager::buildRootPage(String& page, unsigned int repSize, unsigned int appExtraSize)
+void WiFiManager::buildRootPage(WMPage& page, unsigned int repSize, unsigned int appExtraSize)
 {
     // Build page
     uint32_t incFlags = incSTA|incC80;
@@ -1982,16 +2058,18 @@ void WiFiManager::handleRoot()
     Serial.println("<- HTTP Root");
     #endif
 
-    String page;
-    page.reserve(calcRootLen(repSize, appExtraSize) + 16);
-
-    buildRootPage(page, repSize, appExtraSize);
-
+    // Before building the page: With WM_STREAM, it goes
+    // out while it is being built.
     if(_gpcallback) {
         _gpcallback(WM_LP_PREHTTPSEND);
     }
 
-    HTTPSend(page, false);
+    WMPage page(server.get(), false);
+    page.reserve(calcRootLen(repSize, appExtraSize) + 16);
+
+    buildRootPage(page, repSize, appExtraSize);
+
+    HTTPSend(page);
 
     if(_gpcallback) {
         _gpcallback(WM_LP_POSTHTTPSEND);
@@ -2250,7 +2328,7 @@ unsigned int WiFiManager::getScanItemsLen(int n, bool scanErr, int *indices, uns
     return mySize;
 }
 
-void WiFiManager::getScanItemsOut(String& page, int n, bool scanErr, int *indices, unsigned int maxItemSize, bool showall)
+void WiFiManager::getScanItemsOut(WMPage& page, int n, bool scanErr, int *indices, unsigned int maxItemSize, bool showall)
 {
     char chnlnum[8];
     uint8_t bssid[6];
@@ -2330,7 +2408,7 @@ void WiFiManager::getScanItemsOut(String& page, int n, bool scanErr, int *indice
 
 // static ip fields
 
-void WiFiManager::getIpForm(String& page, const char *id, const char *title, IPAddress& value, const char *placeholder)
+void WiFiManager::getIpForm(WMPage& page, const char *id, const char *title, IPAddress& value, const char *placeholder)
 {
     // <label for='{i}'>{t}</label>
     // <input id='{i}' name='{n}' {l} value='{v}' {c} {f}>
@@ -2388,7 +2466,7 @@ unsigned int WiFiManager::getStaticLen()
     return mySize;
 }
 
-void WiFiManager::getStaticOut(String& page)
+void WiFiManager::getStaticOut(WMPage& page)
 {
     bool showSta = (_staShowStaticFields || _sta_static_ip);
     bool showDns = (_staShowDns || _sta_static_dns);
@@ -2411,7 +2489,7 @@ void WiFiManager::getStaticOut(String& page)
 
 // Build WiFi page
 
-void WiFiManager::buildWifiPage(String& page, bool scan)
+void WiFiManager::buildWifiPage(WMPage& page, bool scan)
 {
     unsigned int bufSize = 0, repSize = 0;
     unsigned int maxScanItemSize = 0;
@@ -2579,12 +2657,16 @@ void WiFiManager::buildWifiPage(String& page, bool scan)
  */
 void WiFiManager::handleWifi(bool scan)
 {
-    String page;
+    WMPage page(server.get(), true);
 
     #ifdef _A10001986_V_DBG
     Serial.println("<- HTTP Wifi");
     #endif
 
+    if(_gpcallback) {
+        _gpcallback(WM_LP_PREHTTPSEND);
+    }
+
     #ifdef WM_CCM
     if(_cCarMode) {
         unsigned long bufSize = getHTTPHeadLength(S_titlewifi, incSET);
@@ -2602,11 +2684,7 @@ void WiFiManager::handleWifi(bool scan)
     }
     #endif
 
-    if(_gpcallback) {
-        _gpcallback(WM_LP_PREHTTPSEND);
-    }
-
-    HTTPSend(page, true);
+    HTTPSend(page);
 
     if(_gpcallback) {
         _gpcallback(WM_LP_POSTHTTPSEND);
@@ -2621,12 +2699,16 @@ void WiFiManager::handleWifiSave()
     unsigned long s = getHTTPHeadLength(S_titlewifi, incGFXMSG);
     bool haveNewSSID = false;
     bool networkDeleted = false;
-    String page;
+    WMPage page(server.get(), false);
 
     #ifdef _A10001986_V_DBG
     Serial.println("<- HTTP WiFi save ");
     #endif
 
+    if(_gpcallback) {
+        _gpcallback(WM_LP_PREHTTPSEND);
+    }
+
     #ifdef WM_CCM
     if(_cCarMode) {
         if(server->hasArg(F("cmo")) && _setCCarMode) {
@@ -2755,11 +2837,7 @@ void WiFiManager::handleWifiSave()
     }
     #endif
 
-    if(_gpcallback) {
-        _gpcallback(WM_LP_PREHTTPSEND);
-    }
-
-    HTTPSend(page, false);
+    HTTPSend(page);
 
     if(_gpcallback) {
         _gpcallback(WM_LP_POSTHTTPSEND);
@@ -2805,7 +2883,11 @@ void WiFiManager::_handleParam(int aidx, const char *title, const char *action)
     Serial.println("<- HTTP Param");
     #endif
 
-    String page;
+    if(_gpcallback) {
+        _gpcallback(WM_LP_PREHTTPSEND);
+    }
+
+    WMPage page(server.get(), true);
     page.reserve(calcParmPageSize(aidx, maxItemSize, title, action) + 16);
 
     getHTTPHeadNew(page, title, incSET);
@@ -2823,11 +2905,7 @@ void WiFiManager::_handleParam(int aidx, const char *title, const char *action)
     page += FPSTR(HTTP_FORM_END);
     page += FPSTR(HTTP_END);
 
-    if(_gpcallback) {
-        _gpcallback(WM_LP_PREHTTPSEND);
-    }
-
-    HTTPSend(page, true);
+    HTTPSend(page);
 
     if(_gpcallback) {
         _gpcallback(WM_LP_POSTHTTPSEND);
@@ -2881,7 +2959,11 @@ void WiFiManager::_handleParamSave(int aidx, const char *title)
     mySize += STRLEN(HTTP_PARAMSAVED) + STRLEN(HTTP_PARAMSAVED_END);
     mySize += STRLEN(HTTP_END);
 
-    String page;
+    if(_gpcallback) {
+        _gpcallback(WM_LP_PREHTTPSEND);
+    }
+
+    WMPage page(server.get(), false);
     page.reserve(mySize + 16);
 
     #ifdef _A10001986_DBG
@@ -2894,11 +2976,7 @@ void WiFiManager::_handleParamSave(int aidx, const char *title)
     page += FPSTR(HTTP_PARAMSAVED_END);
     page += FPSTR(HTTP_END);
 
-    if(_gpcallback) {
-        _gpcallback(WM_LP_PREHTTPSEND);
-    }
-
-    HTTPSend(page, false);
+    HTTPSend(page);
 
     if(_gpcallback) {
         _gpcallback(WM_LP_POSTHTTPSEND);
@@ -2985,7 +3063,11 @@ void WiFiManager::handleUpdate()
     Serial.printf("handleUpdate: calced content size %d\n", mySize);
     #endif
 
-    String page;
+    if(_gpcallback) {
+        _gpcallback(WM_LP_PREHTTPSEND);
+    }
+
+    WMPage page(server.get(), false);
     page.reserve(mySize + 16);
 
     getHTTPHeadNew(page, S_titleupd, incSET|incUPL);
@@ -3047,11 +3129,7 @@ void WiFiManager::handleUpdate()
 
     page += FPSTR(HTTP_END);
 
-    if(_gpcallback) {
-        _gpcallback(WM_LP_PREHTTPSEND);
-    }
-
-    HTTPSend(page, false);
+    HTTPSend(page);
 
     if(_gpcallback) {
         _gpcallback(WM_LP_POSTHTTPSEND);
@@ -3162,7 +3240,7 @@ void WiFiManager::handleUpdateDone()
     Serial.printf("handleUpdateDone: calced content size %d\n", mySize);
     #endif
 
-    String page;
+    WMPage page(server.get(), false);
     page.reserve(mySize + 16);
 
     getHTTPHeadNew(page, S_titleupd, incFlags);
@@ -3183,7 +3261,7 @@ void WiFiManager::handleUpdateDone()
 
     page += FPSTR(HTTP_END);
 
-    HTTPSend(page, false);
+    HTTPSend(page);
 
     if(_postotaupdatecallback) {
         _postotaupdatecallback(res);
@@ -3204,6 +3282,40 @@ void WiFiManager::handleNotFound()
     server->send(404, FPSTR(HTTP_HEAD_CT2), S_notfound);
 }
 
+#ifdef WM_ASSETS
+/*
+ * Static assets: Served from flash, gzipped if so generated.
+ * The pages link them with a versioned URL (?v=<etag>), so they
+ * can be cached "forever"; a changed asset gets a new URL.
+ */
+void WiFiManager::addStaticAssets(const WMAsset *assets, int count)
+{
+    if(!server) return;
+
+    for(int i = 0; i < count; i++) {
+        const WMAsset *asset = &assets[i];
+        server->on(asset->uri, HTTP_GET, [this, asset]() { handleAsset(asset); });
+    }
+}
+
+void WiFiManager::handleAsset(const WMAsset *asset)
+{
+    server->sendHeader(F("Cache-Control"), FPSTR(HTTP_HEAD_CC_ASSET));
+    server->sendHeader(F("ETag"), asset->etag);
+
+    if(server->header(F("If-None-Match")) == asset->etag) {
+        server->send(304);
+        return;
+    }
+
+    if(asset->gzip) {
+        server->sendHeader(F("Content-Encoding"), F("gzip"));
+    }
+
+    server->send_P(200, asset->mime, (const char *)asset->data, asset->len);
+}
+#endif
+
 /****************************************************************************
  *
  * Misc
@@ -3346,17 +3458,29 @@ const char * WiFiManager::getHTTPSTART(int& titleStart)
 
 const char * WiFiManager::getHTTPSCRIPT()
 {
+    #ifdef WM_ASSETS
+    return HTTP_ASSET_HEAD;
+    #else
     return HTTP_SCRIPT;
+    #endif
 }
 
 const char * WiFiManager::getHTTPSTYLE()
 {
+    #ifdef WM_ASSETS
+    return HTTP_ASSET_STYLE;
+    #else
     return HTTP_STYLE;
+    #endif
 }
 
 const char * WiFiManager::getHTTPSTYLEOK()
 {
+    #ifdef WM_ASSETS
+    return HTTP_ASSET_OK;
+    #else
     return HTTP_STYLE_MSG;
+    #endif
 }
 
 /*
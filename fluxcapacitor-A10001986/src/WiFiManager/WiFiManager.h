@@ -24,6 +24,8 @@
 #include <WebServer.h>
 #endif
 
+#include "wm_page.h"
+
 #ifdef WM_MDNS
 #include <ESPmDNS.h>
 #endif
@@ -86,7 +88,7 @@
 
 // Parm handed to GPCallback()
 #define WM_LP_NONE          0   // No special reason (just do over-due stuff)
-#define WM_LP_PREHTTPSEND   1   // pre-HTTPSend()
+#define WM_LP_PREHTTPSEND   1   // pre-HTTPSend() (before the page is built)
 #define WM_LP_POSTHTTPSEND  2   // post-HTTPSend() (just do over-due stuff, ...)
 
 #ifdef WM_PARAM2
@@ -103,6 +105,16 @@
 #define TWL_DHCP_TIMEOUT 0x1000
 #define TWL_STATUS_NONE  0x2000
 
+// Static asset, as generated by tools/wm_mkassets.py
+typedef struct {
+    const char    *uri;
+    const char    *mime;
+    const uint8_t *data;
+    uint32_t      len;
+    const char    *etag;    // quoted
+    bool          gzip;
+} WMAsset;
+
 class WiFiManagerParameter {
   public:
     WiFiManagerParameter(const char *id, const char *label, const char *defaultValue, int length, const char *custom, uint8_t flags = WFM_LABEL_DEFAULT);
@@ -230,7 +242,7 @@ class WiFiManager
 		                              { _postotaupdatecallback = func; };
 
     // add stuff to the main menu; second one to give WM the length for buf sizing
-  	void          setMenuOutCallback(void(*func)(String &page, unsigned int appExtraSize))
+  	void          setMenuOutCallback(void(*func)(WMPage &page, unsigned int appExtraSize))
   	                              { _menuoutcallback = func; };
   	void          setMenuOutLenCallback(int(*func)())
   	                              { _menuoutlencallback = func; };
@@ -358,6 +370,12 @@ class WiFiManager
     uint8_t       getConnectRetries()
                                   { return _connectRetries; };
 
+    // serve static assets (see tools/wm_mkassets.py); call from
+    // the web server callback
+    #ifdef WM_ASSETS
+    void          addStaticAssets(const WMAsset *assets, int count);
+    #endif
+
     // make some HTML templates available for app
     const char *  getHTTPSTART(int& titleStart);
     const char *  getHTTPSCRIPT();
@@ -499,25 +517,26 @@ class WiFiManager
     // Webserver handlers
     unsigned int  calcTitleLen(const char *title);
 	  unsigned int  getHTTPHeadLength(const char *title, uint32_t incFlags = 0);
-	  void          getHTTPHeadNew(String& page, const char *title, uint32_t incFlags = 0);
+	  void          getHTTPHeadNew(WMPage& page, const char *title, uint32_t incFlags = 0);
 
 	  unsigned int  getParamOutSize(WiFiManagerParameter** params,
                         int paramsCount, unsigned int& maxItemSize);
-  	void          getParamOut(String &page, WiFiManagerParameter** params,
+  	void          getParamOut(WMPage &page, WiFiManagerParameter** params,
                         int paramsCount, unsigned int maxItemSize);
     void          doParamSave(WiFiManagerParameter** params, int paramsCount);
 
 	  int           reportStatusLen(bool withMac = false);
-    void          reportStatus(String &page, unsigned int estSize = 0, bool withMac = false);
+    void          reportStatus(WMPage &page, unsigned int estSize = 0, bool withMac = false);
 
     void          send_cc();
     void          HTTPSend(const String &content, bool sendCC);
+    void          HTTPSend(WMPage &page);
 
 	  // Root menu
 	  int           getMenuOutLength(unsigned int& appExtraSize);
-    void          getMenuOut(String& page, unsigned int appExtraSize);
+    void          getMenuOut(WMPage& page, unsigned int appExtraSize);
     unsigned int  calcRootLen(unsigned int& repSize, unsigned int& appExtraSize);
-    void          buildRootPage(String& page, unsigned int repSize, unsigned int appExtraSize);
+    void          buildRootPage(WMPage& page, unsigned int repSize, unsigned int appExtraSize);
     void          handleRoot();
 
   	// WiFi page
@@ -525,11 +544,11 @@ class WiFiManager
   	int16_t       WiFi_scanNetworks(bool force, bool async);
   	void          sortNetworks(int n, int *indices, int& haveDupes, bool removeDupes);
   	unsigned int  getScanItemsLen(int n, bool scanErr, int *indices, unsigned int& maxItemSize, int& stopAt, bool showall);
-    void          getScanItemsOut(String& page, int n, bool scanErr, int *indices, unsigned int maxItemSize, bool showall);
-	  void          getIpForm(String& page, const char *id, const char *title, IPAddress& value, const char *ph = NULL);
-    void          getStaticOut(String& page);
+    void          getScanItemsOut(WMPage& page, int n, bool scanErr, int *indices, unsigned int maxItemSize, bool showall);
+	  void          getIpForm(WMPage& page, const char *id, const char *title, IPAddress& value, const char *ph = NULL);
+    void          getStaticOut(WMPage& page);
 	  unsigned int  getStaticLen();
-    void          buildWifiPage(String& page, bool scan);
+    void          buildWifiPage(WMPage& page, bool scan);
 	  void          handleWifi(bool scan);
     void          handleWifiSave();
 
@@ -555,6 +574,9 @@ class WiFiManager
 
   	// Other
   	void          handleNotFound();
+  	#ifdef WM_ASSETS
+  	void          handleAsset(const WMAsset *asset);
+  	#endif
 
     // get default ap esp uses, esp_chipid
     void          getDefaultAPName(char *apname);
@@ -599,7 +621,7 @@ class WiFiManager
     void (*_saveparamscallback)(int)                                    = NULL;
     void (*_preotaupdatecallback)(void)                                 = NULL;
     void (*_postotaupdatecallback)(bool)                                = NULL;
-	  void (*_menuoutcallback)(String&, unsigned int)                     = NULL;
+	  void (*_menuoutcallback)(WMPage&, unsigned int)                     = NULL;
 	  int  (*_menuoutlencallback)(void)                                   = NULL;
 	  void (*_delayreplacement)(unsigned int)                             = NULL;
 	  void (*_gpcallback)(int)                                            = NULL;
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+#
+# wm_mkassets.py
+#
+# Generate gzip-compressed static assets for the config portal
+#
+# Adapted by Thomas Winischhofer (A10001986)
+#
+# The portal's CSS and JavaScript are served as separate, cacheable
+# files instead of being inlined into every page. This script turns
+# them into flash arrays (gzip-compressed where that pays off), along
+# with a strong ETag and a versioned URL for each asset.
+#
+# Usage:
+#
+#   wm_mkassets.py wm <wm_assets.h>
+#       Extract the portal CSS/JS fragments from wm_strings_en.h
+#       (as configured in wm_local.h) and write wm_assets.h.
+#       Requires a host C preprocessor (c++ -E).
+#
+#   wm_mkassets.py files <out.h> <prefix> <file> [<file>...]
+#       Convert arbitrary files (.css, .js, .png, ...) into <out.h>.
+#       Table and macro names are derived from <prefix>. In text
+#       files, "{{name}}" is replaced by the versioned URL of asset
+#       <name> from the same run (files are processed in order).
+#
+# Re-run after changing any of the sources; the generated headers
+# are committed so that the firmware builds without Python.
+
+import gzip
+import hashlib
+import os
+import re
+import subprocess
+import sys
+
+MIMES = {
+    '.css':  'text/css',
+    '.js':   'application/javascript',
+    '.png':  'image/png',
+    '.ico':  'image/x-icon',
+    '.svg':  'image/svg+xml',
+    '.html': 'text/html',
+}
+
+# Portal fragments: asset name -> (strings, prefix to strip from first).
+# Small page-specific fragments (STA, SET, UPL*) stay inline.
+WM_ASSETS = [
+    ('wm.js',     ['HTTP_SCRIPT', 'HTTP_SCRIPT_UPL', 'HTTP_SCRIPT_QI'], '<script>'),
+    ('wm.css',    ['HTTP_STYLE'],      '</script><style>'),
+    ('wmmsg.css', ['HTTP_STYLE_MSG'],  ''),
+    ('wmc80.css', ['HTTP_STYLE_C80'],  ''),
+    ('wmqi.css',  ['HTTP_STYLE_QI'],   ''),
+]
+
+def c_unescape(s):
+    out = []
+    i = 0
+    esc = { 'n': '\n', 't': '\t', 'r': '\r', '\\': '\\', '"': '"', "'": "'", '?': '?' }
+    while i < len(s):
+        c = s[i]
+        if c == '\\' and i + 1 < len(s):
+            n = s[i + 1]
+            if n in esc:
+                out.append(esc[n])
+                i += 2
+                continue
+            raise ValueError('unsupported escape \\' + n)
+        out.append(c)
+        i += 1
+    return ''.join(out)
+
+def wm_strings(srcdir):
+    # Let the preprocessor resolve wm_local.h settings and color macros
+    cmd = ['c++', '-E', '-P', '-x', 'c++', '-DPROGMEM=', '-DWM_MKASSETS',
+           '-include', os.path.join(srcdir, 'wm_local.h'),
+           os.path.join(srcdir, 'wm_strings_en.h')]
+    text = subprocess.check_output(cmd).decode('utf-8')
+    strs = {}
+    for m in re.finditer(r'static\s+const\s+char\s+(\w+)\s*\[\s*\]\s*=\s*((?:\s*"(?:[^"\\]|\\.)*")+)\s*;', text):
+        lits = re.findall(r'"((?:[^"\\]|\\.)*)"', m.group(2))
+        strs[m.group(1)] = ''.join(c_unescape(l) for l in lits)
+    return strs
+
+def ident(name):
+    return re.sub(r'[^A-Za-z0-9]', '_', name)
+
+class Asset:
+    def __init__(self, name, mime, data):
+        self.name = name
+        self.uri = '/' + name
+        self.mime = mime
+        gz = gzip.compress(data, 9, mtime=0)
+        # PNGs and the like are compressed already
+        self.gzip = len(gz) < len(data) * 9 // 10
+        self.data = gz if self.gzip else data
+        self.rawlen = len(data)
+        self.etag = hashlib.sha1(self.data).hexdigest()[:8]
+        self.ref = self.uri + '?v=' + self.etag
+
+def write_header(fn, prefix, assets, source):
+    guard = '_' + ident(os.path.basename(fn)).upper() + '_'
+    mp = prefix.upper() + 'A_'
+    lines = []
+    lines.append('/*')
+    lines.append(' * ' + os.path.basename(fn))
+    lines.append(' *')
+    lines.append(' * Generated by tools/wm_mkassets.py from ' + source + ' - do not edit')
+    lines.append(' */')
+    lines.append('')
+    lines.append('#ifndef ' + guard)
+    lines.append('#define ' + guard)
+    lines.append('')
+    for a in assets:
+        lines.append('#define %-24s "%s"' % (mp + ident(a.name).upper(), a.ref))
+    lines.append('')
+    for a in assets:
+        lines.append('// %s: %d bytes%s' % (a.uri, a.rawlen,
+                     (', %d gzipped' % len(a.data)) if a.gzip else ''))
+        lines.append('static const uint8_t %s_%s[] PROGMEM = {' % (prefix, ident(a.name)))
+        for i in range(0, len(a.data), 16):
+            lines.append('    ' + ','.join('0x%02x' % b for b in a.data[i:i+16]) + ',')
+        lines.append('};')
+        lines.append('')
+    lines.append('static const WMAsset %sAssets[] = {' % prefix)
+    for a in assets:
+        lines.append('    { "%s", "%s", %s_%s, sizeof(%s_%s), "\\"%s\\"", %s },' %
+                     (a.uri, a.mime, prefix, ident(a.name), prefix, ident(a.name),
+                      a.etag, 'true' if a.gzip else 'false'))
+    lines.append('};')
+    lines.append('')
+    lines.append('#define %-24s (sizeof(%sAssets) / sizeof(%sAssets[0]))' %
+                 (mp + 'COUNT', prefix, prefix))
+    lines.append('')
+    lines.append('#endif')
+    with open(fn, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+def main(argv):
+    if len(argv) >= 3 and argv[1] == 'wm':
+        srcdir = os.path.dirname(os.path.abspath(__file__))
+        srcdir = os.path.dirname(srcdir)
+        strs = wm_strings(srcdir)
+        assets = []
+        for name, parts, strip in WM_ASSETS:
+            text = ''.join(strs[p] for p in parts)
+            if strip:
+                assert text.startswith(strip), name
+                text = text[len(strip):]
+            assets.append(Asset(name, MIMES[os.path.splitext(name)[1]], text.encode('utf-8')))
+        write_header(argv[2], 'wm', assets, 'wm_strings_en.h')
+    elif len(argv) >= 5 and argv[1] == 'files':
+        assets = []
+        refs = {}
+        for fn in argv[4:]:
+            name = os.path.basename(fn)
+            with open(fn, 'rb') as f:
+                data = f.read()
+            mime = MIMES.get(os.path.splitext(name)[1], 'application/octet-stream')
+            if mime.startswith('text/') or mime == 'application/javascript':
+                text = data.decode('utf-8')
+                text = re.sub(r'\{\{([^}]+)\}\}', lambda m: refs[m.group(1)], text)
+                data = text.encode('utf-8')
+            a = Asset(name, mime, data)
+            refs[name] = a.ref
+            assets.append(a)
+        write_header(argv[2], argv[3], assets, ', '.join(os.path.basename(f) for f in argv[4:]))
+    else:
+        sys.stderr.write('usage: wm_mkassets.py wm <out.h>\n'
+                         '       wm_mkassets.py files <out.h> <prefix> <file>...\n')
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,415 @@
+/*
+ * wm_assets.h
+ *
+ * Generated by tools/wm_mkassets.py from wm_strings_en.h - do not edit
+ */
+
+#ifndef _WM_ASSETS_H_
+#define _WM_ASSETS_H_
+
+#define WMA_WM_JS                "/wm.js?v=1b1d0942"
+#define WMA_WM_CSS               "/wm.css?v=a473196a"
+#define WMA_WMMSG_CSS            "/wmmsg.css?v=3082e281"
+#define WMA_WMC80_CSS            "/wmc80.css?v=4538c2ea"
+#define WMA_WMQI_CSS             "/wmqi.css?v=d0d33587"
+
+// /wm.js: 1169 bytes, 587 gzipped
+static const uint8_t wm_wm_js[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x85,0x54,0xc1,0x6e,0x9c,0x30,
+    0x10,0xfd,0x95,0x4d,0x2e,0xb6,0xa5,0x14,0x75,0x7b,0x0c,0x72,0xa2,0x6e,0xb5,0x52,
+    0x2b,0xa5,0x52,0xa5,0x26,0xa7,0xaa,0x07,0x83,0x07,0xb0,0xe4,0x18,0xcb,0x36,0x0b,
+    0x2b,0xc2,0xbf,0x77,0x0c,0x2c,0xb0,0x51,0xab,0x5e,0x00,0x7b,0xe6,0xbd,0x99,0x79,
+    0x7e,0xa6,0x52,0x9e,0x17,0x42,0x7b,0x48,0x9d,0xe0,0xbf,0x7e,0xa7,0x45,0x63,0xf2,
+    0xa0,0x6a,0xb3,0x2b,0x81,0x76,0xac,0x77,0x10,0x1a,0x67,0x76,0xb2,0xce,0x9b,0x57,
+    0x30,0x21,0x29,0x21,0x1c,0x35,0xc4,0xcf,0xc3,0xf9,0x9b,0xc4,0x8c,0x61,0x01,0x48,
+    0x0d,0x3a,0x42,0x8a,0x92,0x8f,0xd8,0x54,0x15,0xb4,0x28,0x59,0x51,0x26,0x0e,0x5e,
+    0xeb,0x13,0xd0,0x4d,0x6e,0x41,0x59,0xdf,0xc5,0x34,0x62,0x09,0x4b,0xbb,0x24,0x9c,
+    0x2d,0x70,0xce,0x89,0x15,0xde,0xb7,0xb5,0x93,0xe4,0x71,0xde,0x23,0x01,0xba,0x40,
+    0xee,0x2f,0xab,0x25,0xbe,0x52,0xa9,0x0a,0xb9,0xb0,0xd4,0x4d,0xa5,0x3c,0xeb,0xf1,
+    0xc1,0x83,0x6b,0x20,0x6d,0x95,0x91,0x75,0x9b,0x08,0x29,0x8f,0x27,0xec,0xf6,0x49,
+    0xf9,0x00,0x06,0x1c,0x16,0x14,0x25,0xf8,0xaa,0x6e,0xc9,0x1d,0x05,0xc6,0x1f,0x22,
+    0x14,0x12,0x0b,0xce,0xc7,0x0c,0xc9,0x7a,0x5f,0x79,0x4b,0x3f,0x32,0x94,0x23,0x29,
+    0x6a,0x77,0x14,0x79,0x45,0x1d,0x58,0x36,0xc9,0x33,0x0c,0x6c,0x58,0x4b,0xe3,0x3e,
+    0x55,0x58,0x3c,0x91,0xca,0x8b,0x4c,0x83,0x9c,0x95,0x44,0x4a,0x95,0x1c,0x5e,0x62,
+    0x44,0x19,0x2c,0xfa,0xf5,0xf9,0xfb,0x13,0x8f,0x3b,0x1b,0xec,0x58,0x06,0xd5,0x12,
+    0x62,0x94,0xc1,0x5b,0x45,0x46,0xc5,0x84,0x18,0xa7,0xc1,0x48,0x1c,0x2c,0x15,0x22,
+    0xc9,0x35,0x0e,0x1d,0xfb,0x8f,0xc3,0xc4,0x4c,0xc2,0x06,0xc0,0x32,0xfd,0x55,0x6c,
+    0xd6,0x78,0x0a,0x0f,0xf3,0xb1,0x45,0x25,0xd6,0x92,0x95,0x1a,0x4f,0x54,0x24,0xb6,
+    0xf1,0x55,0x3c,0xa0,0x6e,0x6d,0xfc,0x3a,0x53,0x66,0xb6,0xa5,0x66,0x69,0x21,0x76,
+    0x68,0x96,0xee,0x90,0x06,0x5f,0xb1,0xb3,0xc3,0x0b,0xc7,0xe7,0x32,0x62,0xba,0x5d,
+    0xf0,0xdb,0x1f,0x1a,0x84,0x87,0x5d,0x2b,0x54,0xb8,0x1d,0xc6,0x71,0xf7,0xa8,0xe2,
+    0xdf,0x1a,0xf3,0xde,0xba,0xff,0x94,0xbb,0x4c,0x34,0xf3,0xac,0xd8,0xc6,0x6a,0xdf,
+    0x64,0x14,0xf6,0x77,0xf0,0x89,0xf5,0x63,0xe3,0xb0,0xbf,0xb0,0xe0,0xd6,0x3b,0x9a,
+    0x2b,0x60,0x5e,0x95,0x17,0xe0,0x94,0x9c,0xf8,0x70,0xd6,0x10,0x55,0xb1,0x5a,0x9c,
+    0x39,0xec,0x93,0x93,0xd0,0x0d,0x3a,0x93,0x90,0x47,0x62,0x6a,0x03,0xe4,0x9e,0x28,
+    0xa3,0x82,0x12,0x7a,0xe3,0xc0,0x9c,0xea,0x91,0x80,0x78,0xc2,0x66,0x80,0x8e,0x17,
+    0xe5,0x73,0x08,0x4e,0x65,0x4d,0xc0,0x88,0x14,0x41,0x7c,0xf0,0x5e,0x49,0xc2,0xde,
+    0xde,0xf4,0xa4,0xd2,0x33,0x3a,0x3b,0x2e,0xa2,0xc3,0xbf,0xd4,0x06,0xed,0x19,0xd2,
+    0xc8,0x92,0xfd,0x93,0x25,0xa8,0xa0,0x21,0x32,0x10,0x92,0x9e,0x84,0xdb,0x59,0xcc,
+    0x30,0x88,0x9e,0x6f,0xe4,0x4f,0x95,0x69,0x65,0xca,0x8d,0x29,0x72,0xa4,0x15,0xca,
+    0x78,0x4a,0x34,0xba,0x6b,0x84,0xd8,0xe5,0xd6,0x59,0xbb,0x1e,0xff,0x8d,0x8d,0x4b,
+    0x1c,0x3a,0x87,0xaa,0xd6,0x12,0x1c,0x9f,0x4b,0x4c,0x97,0xb4,0x28,0x27,0x73,0xa2,
+    0x7d,0xba,0x77,0x1a,0x4d,0xb2,0x0c,0x18,0xb4,0xac,0x47,0x8e,0x02,0xff,0x14,0x9e,
+    0xce,0x0e,0xc5,0xf5,0x34,0x09,0x21,0x97,0x03,0x1c,0x6f,0xc8,0xc6,0x69,0x51,0xbb,
+    0xab,0xd0,0x1f,0x7c,0xa1,0xa5,0xee,0x91,0x04,0x00,0x00,
+};
+
+// /wm.css: 1512 bytes, 745 gzipped
+static const uint8_t wm_wm_css[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x8d,0x53,0x51,0x6b,0xdb,0x30,
+    0x10,0xfe,0x2b,0x1e,0xa5,0xa4,0x05,0xd9,0x28,0x69,0xdd,0x6d,0x32,0x83,0x3d,0xec,
+    0x61,0x7b,0x19,0x63,0x63,0x83,0x31,0xfa,0x20,0x4b,0x67,0xe7,0xa8,0x2d,0x19,0x49,
+    0x4e,0x9b,0x19,0xfd,0xf7,0xc9,0x92,0x93,0xa6,0x6b,0x07,0x23,0x38,0xb2,0x4f,0xba,
+    0xef,0xbe,0xef,0xee,0x53,0x21,0x48,0xad,0xe5,0x9e,0xd4,0xa3,0x73,0x5a,0x4d,0x0e,
+    0x1e,0x5c,0xce,0x3b,0x6c,0x15,0x13,0xa0,0x1c,0x98,0xaa,0xd1,0xca,0xe5,0x0d,0xef,
+    0xb1,0xdb,0xb3,0x9c,0x0f,0x43,0x07,0xb9,0xdd,0x5b,0x07,0x3d,0x49,0x4b,0x3e,0x22,
+    0x59,0x7d,0x83,0x56,0x43,0xf6,0xfd,0xd3,0x8a,0x7c,0xd5,0xb5,0x76,0x9a,0xac,0x3e,
+    0x42,0xb7,0x03,0x87,0x82,0x67,0x9f,0x61,0x84,0x15,0xf9,0x01,0x46,0x72,0xc5,0xc9,
+    0x31,0xee,0xe7,0xb2,0x53,0xcd,0xc5,0x5d,0x6b,0xf4,0xa8,0x24,0x3b,0x6b,0xae,0xe7,
+    0x9f,0x97,0xb8,0x23,0xa8,0x86,0xd1,0x11,0x0b,0x1d,0x08,0x37,0x0d,0x5c,0x4a,0x54,
+    0x2d,0x2b,0x87,0x87,0xc4,0xc6,0xe2,0x6f,0x60,0x6b,0xe8,0xab,0x9e,0x9b,0x16,0xd5,
+    0xbc,0x91,0xd1,0xaa,0xd6,0x0f,0xf3,0xce,0x7c,0xb2,0xd6,0x46,0x82,0xc9,0x43,0xc4,
+    0x27,0xa4,0xa4,0x6e,0x01,0x24,0x45,0x6f,0xdb,0x69,0x39,0x63,0xb8,0xc4,0xd1,0xb2,
+    0xe2,0xca,0x04,0xbc,0x7b,0x94,0x6e,0xcb,0xd6,0x94,0x9e,0xa7,0xbc,0x5f,0x6e,0x3f,
+    0xc0,0x3b,0xb1,0x05,0x71,0x17,0xb0,0x6e,0xc9,0x49,0x70,0xce,0xd3,0xb7,0x93,0x44,
+    0x3b,0x74,0x7c,0xcf,0x50,0x75,0xa8,0x20,0xaf,0x3b,0x2d,0xee,0x16,0x5a,0xb9,0xd3,
+    0x43,0xc0,0x0a,0xa4,0x97,0x6f,0x83,0xed,0xd6,0x45,0x15,0xa9,0x0e,0x1f,0x9d,0xae,
+    0xfc,0x42,0xed,0x04,0x7a,0x95,0x42,0xab,0x27,0xf5,0x56,0x76,0xac,0x7b,0x74,0xab,
+    0xdb,0x49,0x8c,0xc6,0x6a,0xc3,0x06,0x8d,0x71,0x3e,0x49,0x07,0x0b,0xfa,0x4f,0x5a,
+    0x79,0xdd,0x94,0x9b,0xb7,0xb2,0x12,0xba,0x0b,0x27,0xcf,0x9a,0xa6,0xa9,0x22,0xbd,
+    0x2d,0x44,0x0a,0x9b,0xe2,0x7a,0x56,0x7b,0xd2,0xcb,0x62,0xf3,0x97,0xfc,0xb3,0x7b,
+    0xc3,0x87,0x53,0x37,0x74,0xd0,0xb8,0xea,0x65,0xb5,0x41,0x5a,0xca,0xdc,0xdc,0x24,
+    0xb5,0x0f,0xcb,0x77,0x49,0xc3,0xb7,0x2f,0xb6,0xc7,0x2e,0x29,0xad,0xc0,0xf3,0x69,
+    0xa1,0x45,0x29,0x4d,0x1c,0xee,0x13,0xad,0x5a,0x77,0xb2,0x8a,0x25,0x25,0x08,0x6d,
+    0xb8,0x43,0xad,0x58,0x90,0x03,0x66,0xae,0xe6,0x39,0xdb,0xea,0x1d,0x98,0x43,0x76,
+    0x92,0xe8,0xe3,0x2c,0x0f,0x0e,0xd9,0x3c,0x76,0x3b,0xbe,0x47,0x57,0xc4,0x31,0xc7,
+    0x59,0x84,0x80,0xd5,0x1d,0xca,0x2c,0x96,0x3e,0x9a,0x24,0x34,0xbb,0xff,0xc7,0xe6,
+    0xe2,0x0e,0x5a,0x3d,0xbf,0x17,0xb1,0x72,0xf1,0x65,0x4a,0xeb,0x87,0x83,0x9f,0x16,
+    0x76,0x35,0x94,0xe2,0xad,0x38,0xc0,0xa4,0x76,0x5c,0xcd,0xcd,0x98,0x0f,0x7f,0x9b,
+    0xfc,0xe1,0xba,0x19,0xae,0x2c,0x46,0xa1,0x7a,0xe0,0x02,0xdd,0x3e,0xa3,0x36,0xdb,
+    0x94,0xb4,0xb7,0xff,0x72,0xd1,0x81,0x2f,0x3d,0xdc,0x86,0x1d,0x37,0xc8,0xc3,0x2a,
+    0xf8,0x60,0x99,0xed,0x79,0xd7,0xc5,0xd7,0xbf,0xf4,0xd1,0x62,0x03,0xfd,0x41,0xe1,
+    0xd2,0xbb,0x44,0x62,0xe6,0x7e,0xb4,0xce,0xcb,0xfc,0x9f,0x04,0x97,0x34,0xc6,0x85,
+    0xc3,0x1d,0x4c,0x0b,0xef,0x30,0xec,0xf3,0xec,0x15,0xf6,0x83,0x36,0x2e,0xb0,0xa9,
+    0x1e,0x95,0x85,0x69,0xce,0xb3,0xa7,0xb6,0x5a,0x9c,0x7b,0xcf,0xd1,0x79,0x16,0x3c,
+    0xc1,0xeb,0x0e,0xe4,0x11,0x80,0x16,0xa5,0x7f,0xdf,0x83,0x44,0x9e,0x59,0x61,0x00,
+    0x54,0xc6,0x95,0xcc,0x2e,0xb8,0xda,0xe7,0x8b,0xd7,0x99,0xd0,0xdc,0x58,0xb8,0x9c,
+    0x78,0x5d,0x9b,0xa7,0xa6,0xf2,0xef,0xef,0x60,0xdf,0x18,0xde,0x83,0xcd,0xec,0xa0,
+    0xcc,0x44,0xcf,0xc9,0x6c,0xe4,0x89,0x2b,0xec,0xa3,0x93,0x72,0x87,0xc1,0xa9,0x6d,
+    0xde,0x8c,0x4a,0xc4,0x86,0x8b,0xb1,0x46,0x91,0xd7,0xf0,0x1b,0xc1,0x5c,0x84,0xf6,
+    0x94,0x84,0x92,0x35,0xa1,0xc5,0xeb,0xf2,0xd2,0x87,0xc4,0x28,0xa0,0xd1,0xa6,0x67,
+    0x46,0x3b,0xee,0xe0,0xe7,0x05,0x95,0xd0,0x5e,0xfa,0xf2,0xc5,0xbd,0xf5,0x1b,0x1a,
+    0xb7,0xab,0xff,0xad,0x47,0x52,0xc5,0x50,0x8d,0xac,0x2f,0x7d,0xa4,0xfa,0x1c,0xf5,
+    0xea,0x26,0xa1,0x7a,0x8f,0x7d,0x5b,0xd8,0xe1,0x51,0x0d,0x9b,0x45,0x66,0xeb,0xd2,
+    0x66,0xeb,0x22,0xfc,0x3d,0xc7,0x0e,0xcf,0x9b,0x80,0x8c,0xaa,0x41,0x85,0x0e,0xfc,
+    0x1f,0x0e,0xe4,0x51,0xfa,0xe8,0x05,0x00,0x00,
+};
+
+// /wmmsg.css: 3828 bytes, 2813 gzipped
+static const uint8_t wm_wmmsg_css[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x55,0x57,0xc7,0x12,0xab,0x46,
+    0x16,0xfd,0x15,0x57,0x79,0x31,0x9e,0x92,0x6d,0x91,0xc3,0xf3,0x8a,0x1c,0x04,0x48,
+    0x24,0x01,0xda,0x21,0x40,0xe4,0x0c,0x22,0x4c,0xcd,0xbf,0x4f,0xf7,0x9b,0x50,0x35,
+    0xa2,0x5a,0x34,0xf4,0x0d,0xe7,0x9e,0x7b,0x1a,0x89,0x3f,0xdb,0x39,0xff,0xd3,0xfd,
+    0xc7,0x10,0xa7,0x69,0xd9,0xe5,0x3f,0x28,0x64,0xd8,0x7f,0xc1,0xfe,0xef,0xeb,0xaf,
+    0x36,0x9e,0xf2,0xb2,0xfb,0xf1,0xf3,0x06,0xf2,0xd7,0xbb,0x9f,0xd2,0x6c,0xfa,0x81,
+    0x82,0x8b,0xb2,0x9b,0xb3,0xe5,0x97,0x5f,0x11,0xe4,0xbf,0x77,0xff,0x78,0xf7,0xcb,
+    0xd2,0xb7,0x3f,0x17,0xe7,0xbe,0x29,0xd3,0xff,0x5b,0x9c,0xe2,0xb4,0x5c,0xe7,0x1f,
+    0xc8,0x5f,0x4b,0xb6,0x2f,0x7f,0xc4,0x4d,0x99,0x77,0x3f,0x92,0xac,0x5b,0xb2,0x09,
+    0x58,0xec,0x7f,0xcc,0x45,0x9c,0xf6,0xdb,0x0f,0x0c,0xa6,0x05,0x83,0x04,0x83,0xf8,
+    0x5f,0x92,0x29,0x7f,0xc7,0xbf,0x21,0xbf,0xff,0x3c,0xfe,0x44,0xff,0xfe,0xd7,0x3b,
+    0x4e,0xea,0x7c,0xea,0xd7,0x2e,0xfd,0xf1,0x4b,0xd7,0xff,0x31,0x65,0x43,0x16,0x2f,
+    0xbf,0xac,0x53,0xf3,0xdb,0xdf,0xd2,0x78,0x89,0x7f,0x94,0x6d,0x9c,0x67,0xd7,0xa1,
+    0xcb,0x81,0xe5,0x9c,0x51,0xc4,0xef,0xe5,0x93,0xbf,0x3b,0x1b,0x72,0x53,0xf2,0x9e,
+    0x03,0x1f,0xcb,0xf5,0x0b,0xc9,0xcf,0xc1,0x4c,0xd9,0xe0,0x75,0x25,0x70,0x26,0x38,
+    0xf1,0xca,0x52,0xb0,0x0a,0x98,0x08,0x2c,0xca,0x9b,0x4f,0xc9,0x87,0x53,0xa5,0xe8,
+    0xe3,0x47,0x45,0x5c,0xe0,0x19,0x0e,0x2e,0xd7,0x04,0x21,0xef,0x6f,0xcb,0x14,0x63,
+    0xe0,0xac,0x63,0x69,0xf7,0x5a,0xdf,0x2d,0x79,0xfd,0xe0,0xec,0x96,0xa8,0x42,0xdc,
+    0x0e,0xa3,0x5c,0x44,0x4f,0xce,0x96,0x78,0xcf,0x47,0xad,0xe6,0x15,0x3c,0x81,0x4d,
+    0x6c,0x56,0xda,0x7e,0x24,0xdd,0x6d,0x9e,0x6e,0x5b,0xa5,0x1d,0x96,0xe3,0x3f,0x25,
+    0xf2,0xee,0x35,0x45,0x14,0xc8,0xcb,0x3b,0x40,0xcb,0xa8,0xbd,0x01,0x9b,0xe3,0x09,
+    0x1c,0xea,0xe1,0xe6,0x4e,0x23,0x35,0xe3,0xd6,0x99,0xde,0xbd,0x9a,0x00,0x76,0xf5,
+    0x61,0x56,0x3a,0xf0,0x91,0x35,0x57,0x2a,0x04,0xbb,0xd6,0x6f,0x6e,0x3d,0x58,0x20,
+    0x01,0xc8,0xc9,0x03,0x5f,0x3d,0x0e,0x9a,0x9e,0x79,0x88,0x7b,0x12,0xca,0x1b,0x7d,
+    0x3f,0x17,0x60,0xea,0x80,0x50,0x01,0xc4,0x28,0x39,0x92,0x03,0x7d,0x41,0x7e,0x1d,
+    0xe2,0x19,0x80,0x31,0xc4,0xea,0x37,0xba,0xeb,0xd4,0x2f,0x19,0x94,0xb2,0x30,0x1f,
+    0xf5,0xd8,0xe7,0xb7,0x02,0x42,0xe5,0x88,0x25,0xda,0x30,0x16,0x30,0x1b,0x40,0x1d,
+    0x1c,0xcc,0xbf,0x9b,0x9e,0xdc,0xbe,0xda,0x17,0xcc,0x0f,0x63,0x85,0x4f,0x34,0x85,
+    0x18,0x60,0x3c,0xc3,0x45,0x16,0x30,0x56,0x1d,0x00,0x91,0x0a,0xcd,0x01,0xe6,0x64,
+    0x1e,0x29,0x82,0x55,0x45,0x28,0x9e,0xe2,0x29,0xe0,0x87,0xe2,0xc1,0x8d,0xb0,0x21,
+    0x53,0xc0,0xd3,0xe5,0xd3,0x91,0xec,0xf7,0x8d,0x5d,0xca,0x7e,0xd4,0x41,0x2d,0xda,
+    0x69,0x9e,0x26,0xc8,0xe9,0xc0,0xf9,0xd7,0x38,0x58,0xdd,0xf5,0x6b,0x98,0x73,0xbc,
+    0x95,0x7d,0x01,0x12,0x52,0xf7,0x6a,0x80,0x79,0x61,0x4e,0x40,0xd5,0x02,0x3b,0x01,
+    0x79,0x23,0xb3,0xb0,0x81,0xd7,0x23,0x20,0x1d,0xd6,0x06,0x79,0x80,0xd7,0x54,0xd6,
+    0x0d,0x90,0x08,0x38,0x0f,0x9e,0x4d,0xac,0x95,0x5a,0x41,0x67,0xf8,0x02,0xfc,0x33,
+    0x60,0x04,0x39,0x57,0x00,0x85,0x02,0xc4,0x01,0x6c,0x47,0xc0,0xf9,0x13,0xf6,0xc6,
+    0x28,0x89,0x05,0xe4,0x6e,0x00,0x36,0xa6,0xd5,0xcb,0x97,0xea,0x20,0x09,0xc0,0x66,
+    0x81,0xda,0xe6,0xd5,0x28,0x49,0x60,0xa3,0x41,0x5e,0x78,0xdb,0xff,0x89,0x09,0xe2,
+    0x81,0xfc,0x03,0xbb,0x14,0x40,0x21,0x45,0x1b,0x31,0x21,0xfe,0x27,0xf8,0x40,0x4e,
+    0x1f,0x1e,0xc2,0x02,0x5b,0x19,0x4d,0xc3,0x9f,0x9c,0x43,0x9d,0xc0,0xf8,0x44,0xa6,
+    0x16,0xf5,0x4b,0x71,0xe0,0x3a,0x28,0xa3,0x44,0x97,0xf7,0x13,0x72,0x0b,0xf0,0xae,
+    0x40,0x3e,0x2f,0x60,0xa2,0xc3,0x1c,0xd3,0xed,0x98,0x3b,0xfd,0x48,0x80,0x39,0x71,
+    0x01,0x22,0x64,0x81,0x43,0x7f,0x13,0x0a,0x10,0x0e,0x85,0xeb,0xa0,0xc5,0x4f,0x10,
+    0x9e,0x07,0x3a,0x40,0x30,0xab,0x82,0x78,0x53,0xd3,0x93,0x76,0xc5,0xa9,0x23,0xc0,
+    0xdd,0x00,0x30,0x11,0xa8,0xe5,0x3d,0x21,0x57,0x90,0x23,0x48,0x3c,0xcc,0x0d,0xf1,
+    0xfd,0x47,0x6f,0x3b,0xd4,0x12,0xd4,0x2e,0x88,0x81,0x81,0x76,0xea,0xb0,0x57,0x90,
+    0x2f,0xd8,0x63,0x80,0x29,0x06,0xb0,0xea,0xeb,0xe3,0xbc,0x40,0xad,0x00,0xed,0xff,
+    0xd4,0x34,0x58,0xb2,0xc1,0x3d,0x16,0x94,0x34,0x7e,0x27,0x8a,0x01,0x21,0x49,0xb8,
+    0x0f,0x60,0xad,0x90,0x07,0xc0,0x79,0x04,0xb5,0x0b,0x35,0x0e,0xb5,0x0e,0xf4,0x8d,
+    0x80,0x5a,0x16,0xb0,0xcc,0xc1,0x33,0xe8,0x5f,0xfe,0x51,0x77,0x16,0xea,0x13,0x60,
+    0xd8,0x00,0xb7,0x14,0xdc,0x37,0x50,0x2f,0xff,0xdd,0x43,0xdd,0x40,0x25,0xd0,0x17,
+    0x6a,0x0c,0xd4,0x0b,0xeb,0x86,0xba,0x74,0x60,0x7c,0xe0,0x07,0xe5,0xfd,0x04,0x1c,
+    0xda,0xa0,0xbe,0x00,0xf8,0x21,0x70,0x73,0x82,0x3d,0x72,0xfb,0x4f,0x4f,0x7b,0xc0,
+    0x17,0x05,0xf0,0x72,0x80,0xe6,0x1a,0xc8,0x19,0x01,0xf9,0x18,0x18,0x83,0xb8,0x8b,
+    0x39,0xa0,0xc8,0xe4,0x81,0xb0,0x61,0x4f,0xa1,0x56,0x81,0xb6,0x7e,0x6a,0x1e,0xfa,
+    0x87,0xdd,0xfa,0xe0,0xe1,0x43,0x81,0x09,0x1d,0xd7,0x6b,0x4c,0x4e,0xe0,0xb6,0x8a,
+    0x97,0x66,0x5b,0xd4,0x64,0xfa,0xe9,0x45,0x9b,0xea,0xe0,0xea,0x17,0x1b,0x4c,0xc5,
+    0x49,0x94,0xeb,0x80,0xf9,0x6f,0x94,0x34,0x5c,0x91,0x5b,0x85,0xfb,0xb7,0xc5,0xad,
+    0x18,0x5f,0x68,0x77,0xee,0x86,0x3b,0x90,0x72,0xc9,0xe7,0xea,0x82,0x25,0x2d,0x39,
+    0x86,0xf2,0xa2,0x3a,0x9e,0x0f,0x7a,0xe9,0xbf,0x25,0xf6,0x6a,0x6d,0xc6,0xe5,0xfa,
+    0xa5,0x95,0x7d,0xbe,0xc5,0x65,0x4b,0x90,0xd8,0x3b,0x28,0xca,0xc8,0x9b,0x89,0xbb,
+    0xc0,0x00,0x7e,0xb4,0x42,0xe2,0x45,0x9c,0xbe,0xbc,0x1b,0x94,0xfd,0x00,0x89,0x79,
+    0xe6,0x3c,0x5e,0xac,0x32,0x2a,0xb5,0xbc,0x97,0xaf,0x99,0x82,0x8e,0xaf,0x80,0xcf,
+    0x02,0xb4,0x08,0x7d,0xc4,0x12,0xec,0x8a,0xb9,0x1a,0x82,0x99,0x90,0xab,0x67,0x1f,
+    0x49,0x25,0x4d,0x71,0x59,0x74,0x24,0xf5,0x6e,0xf5,0x2c,0x2c,0xfb,0x52,0x4d,0x41,
+    0xd6,0x37,0x56,0x78,0x0f,0x6f,0x3b,0x4c,0x77,0x9b,0xf5,0xed,0xcb,0x02,0x11,0x2f,
+    0x34,0x20,0x02,0x5f,0xce,0x08,0x5d,0x1e,0xda,0x36,0x2b,0xcc,0x4a,0x97,0xfb,0x30,
+    0xba,0x55,0x4b,0x66,0x41,0xad,0x61,0x7a,0xae,0xa2,0x54,0x8a,0xcb,0x75,0x88,0x92,
+    0x80,0xfe,0x5d,0xb4,0x1d,0xc4,0xbf,0xb0,0x53,0x80,0xcc,0xd7,0xc7,0xce,0xb8,0xcc,
+    0x3c,0x1e,0x9f,0xa6,0xbf,0xe8,0x19,0xfe,0x9a,0x5e,0xb2,0x6c,0xbb,0x9e,0xb9,0x69,
+    0x87,0x14,0xb0,0xf7,0x2a,0xff,0x8e,0x47,0xd1,0xf5,0x2b,0x1f,0x35,0x3a,0xa7,0x1d,
+    0x95,0x11,0xc1,0xa7,0x6b,0xed,0xe8,0x8e,0x24,0xfb,0xae,0x99,0xb1,0x68,0xfb,0xb4,
+    0x31,0x8c,0x8b,0xf8,0x2b,0x7f,0xfd,0xbe,0xdd,0x06,0x3c,0x3d,0x88,0xf5,0x9c,0xcd,
+    0x17,0x5d,0xd1,0xb9,0xa9,0x26,0xd1,0xbd,0xe4,0x34,0xfb,0xa1,0xe0,0x16,0x7c,0x7c,
+    0xfc,0xfb,0xf8,0x04,0x98,0x83,0x45,0x09,0x8a,0x3f,0x2b,0x91,0xed,0xc3,0x74,0xfa,
+    0x2c,0x29,0xfd,0xa5,0x75,0xf2,0xa5,0xe1,0x59,0x4a,0x74,0xf4,0xf6,0xbc,0xbd,0x53,
+    0xe2,0x6e,0x75,0x99,0x8a,0x3f,0x54,0x69,0x7d,0x72,0x4b,0xdb,0x85,0xf4,0x21,0xbf,
+    0x33,0xcc,0x95,0x9a,0x32,0x50,0x45,0xa7,0x61,0x22,0x0e,0x0d,0xc7,0xc9,0xc1,0x47,
+    0xf7,0xe2,0xf1,0xf1,0x7d,0x25,0x96,0x2f,0xf7,0xb9,0xf3,0xf7,0xd1,0x5e,0xe5,0x5e,
+    0x14,0x0a,0x47,0xad,0x34,0xa4,0x57,0x13,0x73,0x9c,0x15,0xeb,0xc5,0x7c,0xd6,0xbe,
+    0xd6,0xf5,0x29,0x95,0xaf,0x54,0x27,0xf4,0xf6,0xfa,0x8a,0xbb,0xcf,0x77,0x8c,0x85,
+    0xa8,0x37,0x04,0x81,0x48,0x3c,0xd2,0x27,0x54,0x8d,0x26,0xdf,0xf4,0xe5,0x2e,0x23,
+    0xf1,0x65,0xa4,0xcc,0xf3,0xcd,0xcf,0xa1,0xb4,0xaa,0xc2,0xea,0x62,0xe7,0xd1,0xb0,
+    0xc2,0xac,0x17,0x07,0x53,0xcd,0x84,0x56,0xd4,0xc1,0x46,0x76,0xf9,0xc3,0x41,0x34,
+    0x7d,0x42,0x0e,0xa4,0x7f,0xe6,0x4f,0x61,0x34,0xb1,0xf7,0xac,0x21,0xa2,0xe5,0xbc,
+    0x98,0xdb,0xd3,0x24,0x78,0xd4,0xf9,0xb2,0xe5,0xf9,0xa0,0x7a,0x20,0x73,0x9d,0x2e,
+    0x6f,0x83,0x50,0x53,0xa7,0x9c,0x5d,0x6a,0x86,0x54,0xe5,0xdc,0xef,0xae,0x0e,0x50,
+    0x25,0x9d,0x3b,0xb3,0x1b,0xcf,0xfc,0x17,0x9b,0x2d,0xa9,0xe7,0x1d,0x69,0x42,0x84,
+    0xe9,0xaa,0x87,0x1d,0xaf,0x9b,0x6c,0xe5,0x74,0xdc,0x85,0x5b,0x13,0xc5,0xac,0xe3,
+    0xad,0x4d,0x08,0xbe,0xfd,0x06,0xf6,0xdd,0xe7,0x05,0x91,0x49,0x16,0x49,0xf5,0xda,
+    0xf9,0x90,0x5f,0x76,0xd2,0x2c,0x45,0xcb,0xdc,0x2f,0xac,0x9d,0xdb,0xad,0x7b,0x51,
+    0x42,0x95,0x0a,0x67,0x49,0x2f,0xd2,0x65,0x88,0xaa,0x54,0xd0,0x13,0xe7,0x64,0x4c,
+    0xe9,0x13,0xad,0x59,0xee,0x2a,0x84,0x83,0x91,0xc5,0xdc,0x74,0xcc,0x29,0xf9,0xb7,
+    0x71,0x45,0x37,0x9e,0xa3,0x5c,0x7b,0xe7,0x26,0xe1,0x3c,0x73,0x66,0x07,0xa8,0x38,
+    0x57,0x2b,0xd6,0x4b,0x36,0xb8,0x6a,0xe5,0xe8,0xf9,0x05,0x67,0x1f,0x1c,0xc9,0x9d,
+    0xb9,0xc4,0x05,0xb4,0x3d,0x71,0x32,0xdf,0x70,0xb4,0x9d,0x5d,0xa8,0x59,0xc5,0x3a,
+    0xaa,0x5c,0x84,0x27,0xfb,0x1a,0xb4,0x0f,0x7a,0x2d,0x34,0x9c,0x23,0x50,0x43,0x21,
+    0xc4,0xba,0x89,0x8c,0xd2,0x94,0x01,0x3e,0x72,0xe0,0x3e,0x3c,0xf5,0xec,0x27,0xab,
+    0xee,0x48,0x4e,0xdd,0xae,0xc9,0x76,0xd9,0x4f,0x01,0xc9,0xec,0x77,0x6b,0x20,0xb8,
+    0x76,0xd3,0x56,0xa7,0xe6,0x12,0x2a,0x7d,0x3d,0x99,0xb2,0x9a,0xba,0xfb,0x93,0x8b,
+    0x39,0x34,0x1e,0x1e,0xba,0xf4,0x39,0x0f,0x24,0x7b,0xa9,0x74,0x3b,0x12,0xd2,0x71,
+    0x58,0xbc,0xdc,0x4e,0xe7,0x21,0x81,0x1f,0x78,0x7c,0x2a,0x4d,0xc5,0x2d,0x8a,0x57,
+    0x31,0x68,0x5b,0xf4,0xe6,0x8d,0xda,0xb3,0x46,0xa9,0xc5,0xd7,0x4a,0x78,0x7f,0x33,
+    0xb6,0xf9,0x2c,0x05,0x4a,0x7d,0xcd,0x4d,0xb4,0xa7,0x10,0x91,0x55,0x8c,0x4f,0x55,
+    0x54,0xf7,0x72,0xd0,0xf6,0xf6,0x4b,0x45,0x94,0x88,0x1d,0xfc,0x9e,0xbc,0xf5,0xfe,
+    0x31,0x5f,0xee,0x29,0xca,0xc9,0xc5,0xe7,0xdb,0x48,0xfc,0x25,0x72,0x1b,0xc2,0xd8,
+    0x31,0x4d,0x11,0x6b,0x51,0x71,0x36,0x2e,0x3a,0xc7,0xbe,0xdb,0xce,0xf9,0xe0,0xca,
+    0xf5,0xde,0x46,0x24,0x2e,0xd0,0x99,0xd8,0xed,0x71,0x31,0xa4,0x91,0xad,0xe5,0x53,
+    0x3e,0xa3,0x0d,0x51,0xb7,0x41,0x81,0x27,0x72,0xd6,0x11,0x54,0xa2,0x72,0x45,0xe7,
+    0xda,0x72,0x9a,0xe2,0x2f,0x62,0x62,0x67,0x83,0x29,0xb4,0x9c,0xbb,0xc4,0xf4,0xe2,
+    0x6d,0x0f,0xb2,0x74,0x2e,0x21,0xee,0xe5,0x56,0xa4,0xaa,0xd7,0x9c,0x74,0xc5,0xc6,
+    0xfe,0xba,0x14,0x5e,0x04,0x5c,0xbe,0x7d,0x30,0x86,0x10,0x69,0xa9,0xb6,0x72,0x46,
+    0xd0,0xec,0x21,0x47,0x38,0xbf,0x6a,0x7a,0xa9,0xda,0x75,0x29,0x21,0x3f,0x29,0xd2,
+    0x2b,0x65,0x2d,0xb6,0xaf,0xd1,0xf7,0xc2,0x0b,0x27,0x99,0xda,0x1b,0x41,0xfb,0x61,
+    0x2f,0x9a,0x53,0x68,0x0a,0xf4,0x8e,0x1c,0x6a,0x48,0xd1,0xe8,0xfe,0xe4,0x9d,0x21,
+    0x6f,0x1a,0xfc,0xd4,0xe2,0xe7,0xd3,0x3c,0x8d,0x4e,0x99,0x0a,0x81,0x71,0x18,0x2b,
+    0x63,0xbd,0xa5,0x76,0x02,0xee,0x95,0xd7,0xac,0x52,0x59,0xd1,0xe0,0x0f,0x0d,0x41,
+    0xae,0xa4,0x5d,0x98,0x95,0xbf,0x44,0x8f,0x8a,0xe4,0xa9,0x5e,0xfc,0xf8,0x6e,0x81,
+    0x58,0xd6,0x1d,0xa3,0xd2,0x8a,0x58,0x4e,0x1f,0x21,0x14,0x5e,0xb7,0x32,0x71,0x78,
+    0xd9,0x5e,0xc0,0xf2,0xbd,0xa2,0x51,0x9d,0xbb,0x71,0x4b,0xfe,0xfc,0xac,0xe9,0x60,
+    0x58,0x0c,0xa3,0x7d,0xc5,0x51,0xde,0x31,0x91,0xf8,0x12,0x99,0xc4,0xbc,0x4b,0x77,
+    0xf1,0x8d,0xf0,0xce,0x7f,0x4b,0x6d,0x19,0x5e,0x46,0x7b,0xcd,0xa4,0x87,0xfe,0xb0,
+    0x48,0x8f,0xbf,0x70,0x24,0xb5,0xf4,0x43,0x50,0x6d,0x45,0x7d,0xf7,0x14,0x5a,0x76,
+    0x05,0x81,0xdf,0xf5,0x87,0x03,0xe4,0x2c,0xa8,0x57,0x73,0x74,0xe9,0x37,0x4f,0x96,
+    0x43,0x1c,0x49,0x01,0x09,0x7e,0x55,0x5b,0xd3,0x31,0x02,0x76,0x40,0x30,0x31,0x10,
+    0x84,0xdd,0xc3,0x9e,0x98,0x47,0x7b,0x8e,0xc8,0x85,0x81,0x48,0xdc,0x13,0x6f,0xc1,
+    0x99,0x20,0xd5,0xf4,0x6f,0x34,0xd3,0xb8,0xa0,0x65,0x34,0xcd,0x61,0x56,0xb6,0xb5,
+    0x8b,0xf8,0x15,0x8e,0x8a,0xcc,0xfc,0xe5,0xa1,0xcb,0x07,0xea,0xa8,0xd3,0xbe,0xc4,
+    0x78,0xfc,0x1d,0x97,0xd7,0x9d,0x7b,0xcf,0xb2,0x54,0x90,0x5a,0x34,0x0d,0xeb,0xbc,
+    0xf6,0x74,0xfd,0x95,0x6e,0x33,0xdf,0x2e,0x81,0xd4,0x04,0x82,0x92,0x59,0x5f,0x63,
+    0x42,0x56,0x2e,0xc0,0x96,0x3c,0x1a,0x0d,0x6c,0x99,0x79,0xec,0x91,0xdf,0xd6,0x31,
+    0x62,0xbc,0xa7,0x8e,0x7b,0xfd,0x86,0xb8,0xba,0xbc,0xda,0xea,0xb3,0x67,0xa8,0x2d,
+    0xf4,0xf1,0x64,0xb0,0x10,0xd1,0x7e,0xeb,0x2f,0x1c,0x13,0xb7,0x6f,0x50,0x59,0x37,
+    0x44,0xa8,0x8d,0x45,0xe1,0x68,0xf7,0x36,0x67,0xe7,0x78,0xc3,0xf6,0x7a,0xa6,0xa6,
+    0xc0,0xe7,0x90,0x6d,0x68,0x2e,0x9d,0x25,0xb7,0xdb,0xa7,0x51,0x38,0xdc,0x58,0xdb,
+    0xba,0x3f,0x6c,0xcf,0xc8,0xb4,0x86,0xd8,0xfb,0x07,0x1e,0xc4,0x89,0x49,0x5c,0xd3,
+    0x91,0xcb,0x8e,0xae,0x3a,0xa4,0x8c,0x09,0xda,0x94,0x3b,0x51,0xf4,0xfe,0x2d,0xc5,
+    0xe8,0x78,0x95,0xc6,0x99,0xd2,0x63,0x7e,0xc8,0xf9,0x46,0x89,0xa6,0xa0,0xee,0xab,
+    0x1c,0xb2,0xdc,0x6d,0xf1,0x2c,0x93,0x0e,0x6d,0xb7,0xf3,0xb1,0xdc,0x19,0xa7,0x43,
+    0xa0,0x96,0xc7,0x57,0xad,0xc2,0xcc,0xf0,0x71,0x92,0xd8,0x0f,0x99,0x5b,0x08,0xe4,
+    0xc1,0x6c,0x0e,0xb1,0xb3,0x85,0x32,0x7f,0xf0,0x40,0x45,0xda,0x94,0x7e,0x0d,0xd6,
+    0xf5,0xb0,0x0a,0x0c,0xe1,0x4f,0xed,0x23,0x08,0x6e,0xd1,0xbc,0x92,0xee,0xc1,0x85,
+    0xb9,0x70,0xf7,0xc6,0xbd,0x8e,0x3a,0x71,0x0e,0xc3,0xef,0xea,0x1f,0xf8,0x9e,0x6b,
+    0x88,0x41,0x99,0xd5,0x57,0x19,0x52,0x2b,0x4e,0xda,0x68,0xed,0x19,0x8e,0xfb,0x1c,
+    0xe6,0x7b,0x72,0xd3,0x8d,0x5d,0xbd,0xde,0xf0,0x78,0x4b,0x50,0x2b,0x04,0x3b,0xdf,
+    0xd4,0x12,0x0a,0xe6,0x8d,0xd0,0x5e,0x44,0xf4,0xc8,0xf5,0x39,0x65,0xbd,0x78,0xec,
+    0x53,0xa5,0x44,0xe2,0xf9,0x48,0xee,0x5a,0x2d,0x94,0x97,0xa9,0x96,0xdc,0x33,0xf5,
+    0x53,0x9b,0x20,0x85,0x38,0x3b,0x2f,0x36,0xfe,0x0c,0xe2,0x74,0x8a,0x1f,0x6d,0xa5,
+    0x9c,0xfd,0xcd,0x09,0x9d,0x25,0x55,0x55,0x53,0x64,0xe7,0x9a,0xf3,0x87,0x58,0xe7,
+    0x3d,0x5b,0x4d,0xd0,0x22,0xdd,0x98,0x57,0xee,0x6b,0x1a,0xc3,0xf5,0x24,0x22,0x26,
+    0x18,0x17,0x5a,0x64,0x1e,0x0f,0xdf,0x4b,0x53,0x7c,0x87,0xfb,0x34,0x68,0x01,0x5b,
+    0x76,0x08,0xa9,0x3a,0x5a,0x9c,0x50,0xa7,0x75,0xd4,0xcb,0x3c,0xbd,0x8e,0x99,0x6a,
+    0x1e,0x46,0xec,0x3f,0x4f,0x86,0x77,0xcb,0x08,0xe0,0xcf,0x74,0xda,0x89,0xe3,0x7e,
+    0x6a,0xa5,0xc1,0xf7,0x8b,0x3c,0x6c,0xf4,0xd9,0xa1,0xa3,0x01,0x21,0xfd,0x5d,0x9c,
+    0x1e,0xf2,0xf8,0x7d,0x8e,0xe2,0x20,0x53,0x86,0xf4,0x52,0x14,0xcf,0x70,0x2e,0x59,
+    0xa6,0x29,0x85,0xc4,0x65,0xb4,0xc1,0x67,0x86,0xe0,0xc6,0x7c,0xda,0x1a,0x52,0xb1,
+    0x9d,0xda,0x0d,0x4f,0x91,0x07,0x2f,0xd7,0x67,0xc2,0x12,0x8b,0xb7,0x7c,0xaa,0xd5,
+    0xdd,0x07,0xd1,0x31,0x78,0xab,0xf9,0x74,0xf6,0x45,0xb1,0xb4,0xca,0x3e,0x59,0x5e,
+    0x9f,0xfd,0x25,0x7d,0x64,0xbb,0x95,0xe9,0xa1,0x38,0xd9,0x5b,0xd6,0xba,0x22,0x62,
+    0xa1,0xe0,0xff,0x9c,0xe2,0x5e,0x22,0xdc,0xbd,0xf7,0x47,0x7b,0x6d,0x48,0xa3,0xdd,
+    0x18,0x9f,0x4f,0xe4,0x55,0x38,0xf7,0xd9,0xdf,0xd0,0x85,0xa0,0x3a,0x16,0x8f,0x5b,
+    0x6c,0x1d,0x69,0xd0,0x38,0xda,0xcd,0x70,0x96,0x5e,0x30,0x4b,0x1d,0x57,0x6f,0x68,
+    0x66,0xb2,0xc5,0xd0,0x12,0xb9,0x19,0x42,0xe6,0x5d,0x79,0xda,0x4f,0x79,0x8a,0x59,
+    0xa5,0xb5,0xba,0xf3,0x64,0x57,0x98,0xfe,0xd9,0x51,0xd7,0xec,0x43,0xa4,0xe5,0x99,
+    0xdc,0x6e,0x86,0xbc,0x72,0xf4,0x29,0x38,0xaf,0x54,0x1b,0x1d,0x7a,0x2d,0x9e,0x2b,
+    0x96,0x84,0x0b,0x3e,0x96,0x92,0x16,0xa3,0xc1,0x80,0x69,0x8f,0x95,0xa3,0x86,0xae,
+    0x14,0xb7,0x55,0xa0,0xe9,0xd1,0xda,0xaf,0x8f,0x59,0x50,0xa7,0x71,0xf1,0x4d,0x02,
+    0x71,0x25,0x64,0x37,0x5f,0xa7,0x73,0xb2,0x9c,0x37,0xa3,0xe7,0x86,0x5c,0x4c,0xcb,
+    0x0f,0x82,0xb4,0x21,0x42,0xb0,0xc1,0x99,0x29,0x7e,0xe5,0x42,0xe3,0x8d,0x45,0x86,
+    0xc7,0xc6,0x18,0x8e,0xad,0xcf,0xed,0xb4,0xfa,0x1c,0x34,0xf9,0x1c,0xfc,0xc3,0x10,
+    0xcf,0x8b,0xeb,0xf7,0xf1,0x3d,0xad,0xe3,0xf7,0x74,0xb7,0xf3,0x75,0x1c,0x5c,0x06,
+    0xed,0xf3,0x72,0x89,0x83,0x84,0xa5,0x55,0xfb,0x6a,0x9b,0xbe,0x40,0xd1,0xde,0xd2,
+    0xc5,0x97,0x39,0x98,0x90,0xfb,0x75,0x93,0xd8,0x91,0x40,0x5f,0x9d,0x83,0x44,0xf1,
+    0x53,0x40,0x69,0x32,0x5b,0x30,0x43,0xce,0x22,0x36,0x84,0x2f,0x72,0x1c,0x27,0x35,
+    0xb2,0x57,0xbb,0xab,0xdd,0x0a,0xc2,0xdf,0xfe,0xfe,0xf3,0x6d,0x12,0x8e,0x5f,0x3f,
+    0x9f,0xcf,0x3f,0xff,0x05,0x73,0x4b,0xac,0x04,0xf4,0x0e,0x00,0x00,
+};
+
+// /wmc80.css: 590 bytes, 310 gzipped
+static const uint8_t wm_wmc80_css[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x85,0x50,0xed,0x8a,0xc2,0x30,
+    0x10,0x7c,0x15,0x41,0x0a,0x0a,0xb6,0x24,0xb6,0x54,0x4d,0x7e,0xde,0x93,0x24,0xcd,
+    0x9a,0x2e,0x97,0x26,0x65,0x8d,0xe7,0x17,0xbe,0xfb,0xa5,0xf6,0x3c,0x44,0x4f,0x8e,
+    0x64,0x03,0x99,0x65,0x67,0x67,0x46,0xef,0x63,0x0c,0xbe,0xd0,0x42,0x6c,0x91,0x76,
+    0x31,0x77,0x10,0x23,0xd0,0x65,0x1b,0x7c,0xcc,0x77,0x78,0x06,0xc1,0xd7,0x2c,0x93,
+    0x5f,0x40,0x11,0x1b,0xe5,0x72,0xe5,0xd0,0x7a,0x91,0x17,0x7c,0x09,0x9d,0x6c,0x82,
+    0x0b,0x24,0xa6,0x75,0xa3,0x2b,0x58,0xc9,0x08,0xc7,0x34,0xd2,0x2a,0x13,0x0e,0x62,
+    0xd9,0x1f,0x27,0x43,0x4d,0x19,0x63,0x72,0xe4,0x8a,0x27,0x07,0x02,0x63,0x22,0x68,
+    0x46,0xe4,0x00,0x68,0xdb,0x28,0x74,0x70,0x46,0x76,0x8a,0x2c,0xfa,0x9c,0x6e,0x08,
+    0x2b,0xd8,0x06,0xba,0xab,0x1e,0x95,0xd9,0x27,0x65,0xf7,0xa5,0xb5,0x82,0x1a,0xa4,
+    0x56,0xcd,0xa7,0xa5,0xb0,0xf7,0x26,0xff,0x69,0xfc,0x6e,0x7c,0xe4,0xef,0x95,0x31,
+    0xe8,0xad,0x98,0xb0,0x24,0xaa,0x4a,0xc5,0x86,0xf7,0xbe,0xa2,0x7f,0x6b,0x7e,0xc9,
+    0xfe,0x33,0x0f,0x1a,0x56,0x55,0xf3,0xb7,0x79,0xce,0xf9,0x28,0x65,0xab,0x3a,0x74,
+    0x27,0xf1,0x11,0xf6,0x84,0x40,0xd7,0x96,0x8a,0xf3,0xe5,0x41,0x39,0x76,0xca,0x82,
+    0x70,0xe8,0x41,0x51,0x6e,0x49,0x19,0x04,0x1f,0x67,0x15,0x33,0x60,0x17,0x64,0xb5,
+    0x9a,0xf1,0x72,0x31,0x5e,0x36,0x7f,0x01,0xca,0xb2,0x28,0xcb,0x6c,0x31,0x65,0x66,
+    0x38,0x93,0xa7,0x6f,0x5d,0x17,0xf5,0x2a,0x7b,0x19,0x7a,0x03,0xf3,0x64,0x77,0xfe,
+    0x98,0xe9,0x2d,0x84,0x75,0xf2,0x32,0x74,0x64,0x3b,0x26,0xca,0x53,0x88,0x52,0x07,
+    0x32,0x40,0xc2,0x07,0x0f,0xf2,0x80,0x26,0xb6,0x62,0xc3,0xb2,0xeb,0x37,0x88,0x21,
+    0x68,0x41,0x4e,0x02,0x00,0x00,
+};
+
+// /wmqi.css: 2349 bytes, 1424 gzipped
+static const uint8_t wm_wmqi_css[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x96,0xc9,0x92,0xa3,0x48,
+    0x12,0x86,0x5f,0xa5,0x6e,0x35,0x63,0x74,0x16,0xbb,0x84,0x94,0x36,0x07,0x40,0xec,
+    0x02,0xb1,0x6f,0x37,0x76,0x21,0x20,0x40,0x2c,0x42,0x50,0xd6,0xef,0xde,0x52,0x66,
+    0xd5,0x58,0xce,0xd8,0x54,0x76,0x4d,0x5c,0xc2,0xc3,0xfd,0xe3,0x77,0xc7,0xc3,0x88,
+    0x20,0x9e,0xc6,0xb1,0x05,0xdf,0x86,0xef,0x73,0x99,0x8e,0xe7,0x7d,0x09,0xca,0xb1,
+    0x8c,0xea,0xd7,0xba,0x04,0xd9,0xcb,0x39,0x2b,0x8b,0xf3,0xb8,0x47,0xbf,0xe1,0x59,
+    0xf3,0xda,0x44,0x7d,0x51,0x82,0x3d,0xf2,0xe7,0xb7,0xeb,0xf7,0x9f,0x81,0x4d,0x77,
+    0xff,0xb7,0xff,0xb5,0x8b,0xd2,0xb4,0x04,0xc5,0x1e,0xf9,0x42,0x3e,0xdc,0x63,0x76,
+    0x1f,0x5f,0xa2,0xba,0x2c,0xc0,0xbe,0x7f,0xc2,0xaf,0x4d,0x09,0x5e,0xde,0x73,0xe0,
+    0xd4,0x23,0x9e,0xd7,0x6d,0x34,0xbe,0x87,0x1e,0x8a,0xdf,0xae,0x2f,0xc8,0x7e,0x1f,
+    0xe5,0x63,0xd6,0x7f,0x8f,0xa3,0xa4,0x2a,0xfa,0x76,0x02,0xe9,0x4b,0xd7,0x0e,0x8f,
+    0x72,0x5a,0xf0,0x72,0x7f,0xcb,0xfb,0xa0,0xd0,0xdf,0xa2,0xb0,0xcf,0xa9,0x17,0x0c,
+    0xed,0xee,0xef,0x24,0xfe,0x37,0x24,0x81,0xfd,0x24,0x89,0xbf,0x21,0x37,0xf8,0x3b,
+    0x59,0xef,0xf7,0x71,0x96,0xb7,0x7d,0xf6,0x2b,0x90,0x22,0xde,0xc0,0xfa,0xcb,0xa3,
+    0x91,0xef,0x5d,0xa8,0xb3,0xfc,0xd9,0x84,0x1f,0x09,0xfe,0x78,0x5a,0x3f,0x24,0x92,
+    0x16,0x8c,0x19,0x18,0xf7,0x5f,0xbf,0xbe,0xbe,0xf7,0xee,0x59,0xf9,0xeb,0xc7,0xf6,
+    0xa7,0xe5,0xd0,0xd5,0xd1,0xf2,0xd8,0xb8,0xb7,0x2d,0x8b,0xeb,0x36,0xa9,0x5e,0x3f,
+    0x64,0xee,0xb3,0x2e,0x7b,0xa4,0x00,0xed,0x0f,0xeb,0xf5,0x7f,0x54,0xf5,0xa6,0xfa,
+    0x05,0xf9,0x18,0x2a,0x9b,0xa8,0xc8,0xf6,0x53,0x5f,0xff,0xe3,0x6b,0x1a,0x8d,0xd1,
+    0xfe,0x6d,0x0d,0x77,0xa0,0x78,0x40,0x43,0xb6,0x21,0xfe,0x28,0x5d,0xe6,0x64,0xce,
+    0x88,0x22,0x14,0x2d,0xfd,0x18,0x9a,0xe5,0x9c,0x39,0xa7,0x78,0x58,0xaa,0xf1,0x5c,
+    0x17,0x2c,0xad,0x3e,0x26,0x66,0xd3,0x5b,0xb9,0xf6,0x34,0xe4,0x9a,0x51,0x5d,0xce,
+    0xa1,0xff,0x73,0x1c,0xc4,0x25,0xa9,0xfe,0x6b,0x06,0x9f,0xf8,0x3e,0x7b,0xf6,0xa3,
+    0xff,0x57,0x1a,0x1f,0x75,0x0e,0x9f,0x68,0xd2,0xbf,0xa1,0xf7,0xd9,0x4c,0xff,0x22,
+    0x37,0xf8,0x3f,0x7c,0xbf,0xc3,0x57,0xbf,0xd9,0x8f,0xc6,0x6f,0xc2,0xc6,0xa8,0x3a,
+    0xe9,0xe7,0x7a,0xd8,0x29,0xec,0xe6,0x19,0x0d,0x44,0xd3,0xb2,0x6b,0x95,0xc6,0x27,
+    0x4a,0x86,0x8f,0x77,0x45,0x82,0xfa,0x9c,0x11,0x79,0x5e,0x2e,0x70,0x72,0x77,0x8a,
+    0xd0,0x41,0xe4,0xfd,0x93,0x2d,0x01,0x31,0xbd,0xd9,0x0b,0x99,0x79,0x29,0xca,0x48,
+    0x1c,0x21,0xe3,0xce,0x32,0xa7,0x68,0x2f,0x9c,0x6d,0x1b,0xc6,0xab,0x16,0x92,0xbd,
+    0x43,0x70,0xe3,0xa1,0xde,0x5a,0xae,0xd8,0x50,0x7a,0x28,0x08,0x1c,0x5a,0x21,0x76,
+    0x0d,0x3e,0x2a,0x5a,0xeb,0x23,0xc1,0xf6,0xb8,0xf4,0xcb,0x76,0x58,0x86,0xae,0x9b,
+    0xcf,0x87,0x39,0xaa,0xab,0x56,0x4e,0xef,0xe0,0xbe,0x8d,0x33,0x05,0xba,0x78,0x6d,
+    0xba,0x61,0x20,0xef,0x59,0x9c,0x55,0xd5,0x9c,0xe1,0x9a,0xc1,0xbc,0xf3,0x5c,0x0c,
+    0xed,0x23,0x83,0x61,0x69,0x6d,0xa1,0x39,0x96,0xb7,0x4f,0x86,0xc5,0x2c,0x1c,0x67,
+    0x72,0x8e,0x6b,0x72,0x1c,0xe7,0x72,0x27,0xab,0xbe,0xf2,0xb1,0x90,0x61,0x23,0xc0,
+    0x73,0x02,0x08,0x83,0x6c,0x0c,0x96,0x71,0xd6,0x74,0xf8,0xd2,0xe6,0x5b,0x5d,0x5e,
+    0x01,0xb5,0x4e,0x5b,0x75,0x2d,0x4f,0x4a,0x97,0x87,0x3d,0x6e,0x66,0x08,0xd6,0xac,
+    0xf8,0xd5,0x83,0xf2,0xc7,0x9b,0x99,0xf3,0xf6,0x1a,0x90,0x90,0xbe,0x49,0x8e,0xb6,
+    0xc8,0x4b,0xb5,0xae,0xb0,0x37,0x22,0x55,0x57,0x99,0x3e,0xfa,0x0c,0x5c,0x2c,0x35,
+    0xb6,0x45,0x37,0xd0,0x31,0x69,0x11,0x1e,0xee,0xa6,0x56,0x64,0xfd,0x86,0x80,0xdb,
+    0x2d,0x5c,0x42,0xb7,0x76,0x74,0x3d,0xb1,0x9e,0x8f,0x89,0x5c,0x9d,0x5d,0xd7,0x08,
+    0x5c,0x47,0x6a,0xd3,0x8a,0x9c,0x86,0x2c,0x02,0xca,0xaa,0x61,0xd4,0x8a,0x18,0xa1,
+    0xb6,0x30,0x03,0x2e,0xdd,0x6f,0xa5,0x33,0x82,0xb5,0x17,0xb6,0x62,0x70,0xef,0xfb,
+    0x5b,0x46,0x7b,0x3a,0x26,0x43,0xb7,0x93,0x59,0xe6,0x39,0x6b,0xf4,0x07,0x5e,0xe9,
+    0x8a,0x90,0xd5,0x2e,0x02,0xd4,0xa8,0xf5,0x50,0x9f,0x73,0xc1,0xc0,0x36,0x13,0xd1,
+    0xf3,0x1b,0xd8,0x33,0x77,0x83,0x2c,0x1e,0xce,0x4d,0x07,0xcb,0x68,0x23,0x48,0x91,
+    0x3d,0x80,0x6c,0xd6,0x9b,0xbb,0x18,0x99,0xcc,0x81,0x6c,0xae,0x4a,0x45,0x8b,0x40,
+    0x4a,0x5c,0x2a,0x1a,0x1c,0x53,0xa2,0x1a,0x32,0x0d,0x0b,0x56,0x30,0x47,0x4d,0x56,
+    0x77,0x5c,0x39,0x97,0xbe,0x49,0xdc,0xcd,0x23,0x96,0xc0,0xfe,0x3c,0x9b,0x11,0x09,
+    0xdf,0x9a,0x20,0x5e,0x0e,0xcc,0x56,0x29,0xe3,0x39,0xee,0x04,0x2b,0xe6,0xdc,0x12,
+    0xf1,0x0b,0xce,0x12,0x74,0xd9,0x21,0x6b,0x17,0xda,0x5e,0x45,0xd1,0xac,0x65,0x9f,
+    0xc6,0x34,0x65,0x0b,0xdd,0xfd,0x59,0xa5,0xfc,0xb9,0xbd,0xda,0x0c,0xac,0xb7,0x3a,
+    0x37,0x6d,0xe3,0x50,0x64,0xba,0x9d,0xc9,0xf3,0x75,0x47,0x2b,0x43,0x35,0xee,0xfa,
+    0x23,0x23,0x65,0x5a,0x30,0xa0,0xfd,0x59,0xcc,0x6a,0x73,0x73,0x81,0x6d,0x09,0xc3,
+    0x2e,0x8b,0x75,0x28,0x09,0x6c,0xa0,0x80,0x19,0x0e,0xf1,0x2d,0x74,0xa3,0x3a,0xa4,
+    0x46,0xc2,0xb9,0x03,0x05,0xe6,0x3d,0xb7,0x2f,0xb9,0x75,0x75,0xee,0x82,0xc1,0x9a,
+    0x3c,0x39,0xd3,0x25,0xd5,0x20,0xfd,0xbd,0xcb,0x6c,0xd4,0xee,0x42,0xc4,0x4a,0x02,
+    0x66,0x5e,0xa2,0xc9,0x24,0x0d,0x53,0x53,0x9c,0xc6,0x38,0xcc,0x9b,0xae,0xae,0x0b,
+    0x5a,0x4e,0x2d,0x4c,0x76,0x08,0xad,0x51,0x26,0x9d,0xbd,0x4c,0x58,0xa1,0xa2,0x78,
+    0x10,0x28,0xdb,0xa2,0x70,0x7d,0xc4,0x57,0xb1,0x40,0x10,0xdc,0xc3,0x4c,0x84,0x56,
+    0xec,0x46,0x10,0xe4,0x39,0xc4,0xb9,0x2c,0x3a,0xba,0x89,0x66,0x56,0x8c,0x81,0x25,
+    0x70,0xa3,0x1e,0x0c,0x4b,0x8b,0xa5,0x49,0x10,0xd0,0x9b,0x83,0x5c,0x09,0x94,0x5a,
+    0x47,0x57,0x8d,0x66,0x84,0x5b,0xbf,0x6b,0x64,0x42,0xef,0xaa,0x5e,0xc3,0x7c,0x85,
+    0x3c,0x95,0xf0,0xe3,0x68,0xf3,0x0c,0x1b,0xda,0x56,0x77,0x75,0x55,0x37,0xbe,0x40,
+    0x5d,0x93,0xa4,0x5c,0x9a,0xb9,0x86,0xeb,0x76,0x9e,0x6d,0xaa,0x0c,0x2c,0xf3,0x30,
+    0xca,0x7a,0x35,0x2f,0xfe,0x80,0x37,0xce,0x9a,0x54,0xd1,0x8a,0x03,0x59,0x21,0x79,
+    0x8e,0x15,0x56,0xda,0x0a,0x83,0xa8,0xa9,0x7a,0x3d,0xa3,0x32,0x84,0x2e,0xe3,0x84,
+    0x75,0x64,0x8f,0xb7,0xac,0x45,0x3e,0x41,0xb7,0x80,0x13,0x30,0xa3,0x15,0x6c,0x79,
+    0xdd,0x9c,0x51,0xc8,0x50,0x23,0x9f,0x76,0x75,0x20,0x8f,0x07,0x86,0xed,0x09,0xd2,
+    0x39,0x75,0x29,0x15,0x9c,0x63,0xa2,0xe9,0xa5,0xc3,0xe3,0x13,0x2a,0x90,0x6e,0x1d,
+    0xe6,0x4b,0xa1,0x09,0x92,0x95,0xa9,0xa3,0xef,0x91,0x81,0xa1,0xe3,0xdd,0x32,0x7b,
+    0xfd,0xcd,0x9a,0x46,0x3b,0x3f,0x52,0xe6,0xc5,0x8e,0x17,0x2a,0xed,0x67,0x26,0x30,
+    0xf3,0x52,0xa1,0x67,0x31,0xae,0x76,0xf1,0x06,0x54,0xb8,0x33,0xc5,0x63,0x32,0x27,
+    0x1c,0x2a,0xad,0x2a,0xec,0x35,0x52,0xa8,0x15,0xb4,0x71,0xb5,0x91,0x89,0x99,0xd4,
+    0x4c,0x6c,0x78,0x07,0xe7,0xe3,0x59,0x61,0x21,0x0a,0xbb,0x9f,0x78,0x15,0x66,0xc3,
+    0x2c,0x8d,0x6e,0x48,0xda,0xd1,0xf5,0x71,0xf4,0x7d,0x9d,0x88,0x64,0x15,0xb6,0x0c,
+    0x36,0x93,0xe4,0xbe,0xe3,0x38,0x46,0xbe,0x16,0xd3,0xa2,0x99,0x7a,0xdb,0x7a,0x30,
+    0x7b,0x4a,0xc8,0x63,0x0f,0xd5,0xb1,0x0c,0x94,0xae,0x3e,0xc3,0xbb,0xdb,0x0d,0x97,
+    0x46,0x19,0x04,0xae,0xd0,0xe4,0x97,0x1a,0x4d,0xb7,0x82,0x36,0xca,0x17,0x8c,0x49,
+    0xc2,0xb1,0x53,0x9b,0x46,0x20,0xba,0x13,0x52,0xb7,0x14,0xad,0x8a,0x7c,0x93,0xb7,
+    0xfa,0x04,0xfb,0x64,0x48,0xc4,0xae,0x5e,0x68,0x2d,0x5b,0x91,0x47,0xee,0x2c,0xaa,
+    0xf5,0xcd,0x60,0x6d,0xcf,0xb1,0xe0,0xe5,0xb4,0xca,0x99,0x18,0x24,0x61,0x0b,0x76,
+    0x64,0x2c,0x1d,0x69,0x8d,0xb7,0x51,0xb7,0xd4,0x3d,0x79,0x53,0xc1,0xe8,0x58,0x3a,
+    0x4b,0xd6,0x5a,0x1b,0xd6,0x25,0x5d,0xa8,0xe0,0x0a,0x0e,0xb1,0x96,0xf3,0x29,0x40,
+    0xb5,0x4a,0x3b,0x87,0x29,0x50,0xaf,0x52,0x78,0x28,0xea,0x1d,0x96,0xac,0x97,0x48,
+    0x0a,0xe5,0x3c,0x07,0x52,0x77,0x48,0x94,0xdd,0xd4,0x90,0x79,0x2e,0xea,0x6a,0x9c,
+    0xe6,0x42,0x54,0x4e,0x1e,0xf0,0xa7,0xb7,0xbb,0x8b,0xb6,0x1c,0xf7,0x64,0x2a,0x24,
+    0x1b,0x48,0xd2,0xbf,0xbe,0xfe,0xf3,0xe3,0x35,0x38,0x94,0x6b,0xb6,0xdf,0x3d,0xfe,
+    0x57,0xbe,0x3c,0x2f,0xdb,0x3f,0xff,0x02,0xb2,0x50,0x7d,0x06,0x2d,0x09,0x00,0x00,
+};
+
+static const WMAsset wmAssets[] = {
+    { "/wm.js", "application/javascript", wm_wm_js, sizeof(wm_wm_js), "\"1b1d0942\"", true },
+    { "/wm.css", "text/css", wm_wm_css, sizeof(wm_wm_css), "\"a473196a\"", true },
+    { "/wmmsg.css", "text/css", wm_wmmsg_css, sizeof(wm_wmmsg_css), "\"3082e281\"", true },
+    { "/wmc80.css", "text/css", wm_wmc80_css, sizeof(wm_wmc80_css), "\"4538c2ea\"", true },
+    { "/wmqi.css", "text/css", wm_wmqi_css, sizeof(wm_wmqi_css), "\"d0d33587\"", true },
+};
+
+#define WMA_COUNT                (sizeof(wmAssets) / sizeof(wmAssets[0]))
+
+#endif
@@ -29,6 +29,20 @@
 
 #define WM_CCM
 
+// Stream pages in chunks (chunked transfer encoding)
+// instead of building them in one String.
+// Not yet verified on hardware; off by default.
+// #define WM_STREAM
+#if defined(WM_STREAM) && !defined(WM_STREAM_CHUNK)
+#define WM_STREAM_CHUNK 1024
+#endif
+
+// Serve portal CSS/JS as separate, gzipped and cacheable
+// files (wm_assets.h, see tools/wm_mkassets.py).
+// Not yet verified with real browsers and captive-portal
+// clients; off by default.
+// #define WM_ASSETS
+
 // #define WM_AP_STATIC_IP
 // #define WM_APCALLBACK
 // #define WM_PRECONNECTCB
@@ -0,0 +1,133 @@
+/**
+ * wm_page.cpp
+ *
+ * Based on:
+ * WiFiManager, a library for the ESP32/Arduino platform
+ * Creator tzapu (tablatronix)
+ * Version 2.0.15
+ * License MIT
+ *
+ * Adapted by Thomas Winischhofer (A10001986)
+ */
+
+#include "wm_page.h"
+
+#ifdef WM_STREAM
+/*
+ * WMPage: Chunked page output
+ *
+ * Page builders append to a buffer of WM_STREAM_CHUNK bytes, which
+ * is sent as one HTTP chunk whenever it is full. Strings larger than
+ * the buffer are sent directly from where they live (flash or heap).
+ * Headers are only sent once the first chunk goes out, so a handler
+ * may still redirect or bail out before it has output anything.
+ */
+WMPage::WMPage(WebServer *server, bool sendCC)
+{
+    _server = server;
+    _sendCC = sendCC;
+}
+
+WMPage::~WMPage()
+{
+    if(!_ended && (_started || _used)) {
+        end();
+    }
+    if(_buf) free(_buf);
+}
+
+void WMPage::start()
+{
+    if(_started) return;
+
+    _started = true;
+
+    if(_sendCC) {
+        _server->sendHeader("Cache-Control", "no-store, must-revalidate, no-cache");
+        _server->sendHeader("Pragma", "no-cache");
+        _server->sendHeader("Expires", "0");
+    }
+
+    _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server->send(200, HTTP_HEAD_CT, "");
+}
+
+void WMPage::flush()
+{
+    if(!_used) return;
+
+    start();
+    _server->sendContent(_buf, _used);
+    _used = 0;
+}
+
+void WMPage::append(const char *str, unsigned int len)
+{
+    if(!len || _ended) return;
+
+    _total += len;
+
+    if(!_buf) {
+        if(!(_buf = (char *)malloc(WM_STREAM_CHUNK))) {
+            // No buffer: Send unbuffered
+            start();
+            _server->sendContent(str, len);
+            return;
+        }
+    }
+
+    if(_used + len > WM_STREAM_CHUNK) {
+        flush();
+        if(len >= WM_STREAM_CHUNK) {
+            start();
+            _server->sendContent(str, len);
+            return;
+        }
+    }
+
+    memcpy(_buf + _used, str, len);
+    _used += len;
+}
+
+WMPage& WMPage::operator+=(const char *str)
+{
+    if(str) append(str, strlen(str));
+    return *this;
+}
+
+WMPage& WMPage::operator+=(const String& str)
+{
+    append(str.c_str(), str.length());
+    return *this;
+}
+
+WMPage& WMPage::operator+=(const __FlashStringHelper *str)
+{
+    // Flash is memory-mapped on the ESP32
+    return operator+=((const char *)str);
+}
+
+WMPage& WMPage::operator+=(char c)
+{
+    append(&c, 1);
+    return *this;
+}
+
+void WMPage::end()
+{
+    if(_ended) return;
+
+    flush();
+    start();
+
+    // Empty chunk terminates the transfer
+    _server->sendContent("");
+
+    _ended = true;
+
+    if(_buf) {
+        free(_buf);
+        _buf = NULL;
+    }
+}
+#endif
@@ -0,0 +1,71 @@
+/**
+ * wm_page.h
+ *
+ * Based on:
+ * WiFiManager, a library for the ESP32/Arduino platform
+ * Creator tzapu (tablatronix)
+ * Version 2.0.15
+ * License MIT
+ *
+ * Adapted by Thomas Winischhofer (A10001986)
+ */
+
+#ifndef wm_page_h
+#define wm_page_h
+
+#include "wm_local.h"
+
+#include <Arduino.h>
+
+#ifndef WEBSERVER_H
+#include <WebServer.h>
+#endif
+
+static const char HTTP_HEAD_CT[]   PROGMEM = "text/html";
+
+// Page output sink. With WM_STREAM, page builders feed a
+// fixed-size buffer which is sent in chunks as it fills up,
+// otherwise the page is assembled in a String as before.
+#ifdef WM_STREAM
+class WMPage {
+    public:
+        WMPage(WebServer *server, bool sendCC);
+        ~WMPage();
+
+        WMPage(const WMPage&) = delete;
+        WMPage& operator=(const WMPage&) = delete;
+
+        bool          reserve(unsigned int size) { return true; }
+        unsigned int  length() const { return _total; }
+
+        WMPage&       operator+=(const char *str);
+        WMPage&       operator+=(const String& str);
+        WMPage&       operator+=(const __FlashStringHelper *str);
+        WMPage&       operator+=(char c);
+
+        void          end();
+
+    private:
+        void          append(const char *str, unsigned int len);
+        void          flush();
+        void          start();
+
+        WebServer     *_server;
+        char          *_buf = NULL;
+        unsigned int  _used = 0;
+        unsigned int  _total = 0;
+        bool          _sendCC;
+        bool          _started = false;
+        bool          _ended = false;
+};
+#else
+class WMPage : public String {
+    public:
+        WMPage(WebServer *server, bool sendCC) : String(), _sendCC(sendCC) {}
+        bool          sendCC() const { return _sendCC; }
+    private:
+        bool          _sendCC;
+};
+#endif
+
+#endif
@@ -353,7 +353,7 @@ static const char T_h[]            PROGMEM = "{h}"; // @token h
 static const char T_f[]            PROGMEM = "{f}"; // @token f
 
 // http
-static const char HTTP_HEAD_CT[]   PROGMEM = "text/html";
+// HTTP_HEAD_CT: see wm_page.h
 static const char HTTP_HEAD_CT2[]  PROGMEM = "text/plain";
 
 // Debug
@@ -372,4 +372,22 @@ static const char * const WIFI_STA_STATUS[] PROGMEM =
 const char * const WIFI_MODES[] PROGMEM = { "NULL", "STA", "AP", "STA+AP" };
 #endif
 
+#if defined(WM_ASSETS) && !defined(WM_MKASSETS)
+// With WM_ASSETS, the larger CSS/JS fragments above are served
+// as separate files from wm_assets.h; pages only link to them.
+// Re-run tools/wm_mkassets.py after changing any of these.
+#include "wm_assets.h"
+
+static const char HTTP_ASSET_HEAD[] PROGMEM =
+    "<script src='" WMA_WM_JS "'></script>"
+    "<link rel='stylesheet' href='" WMA_WM_CSS "'>";
+static const char HTTP_ASSET_MSG[]  PROGMEM = "<link rel='stylesheet' href='" WMA_WMMSG_CSS "'>";
+static const char HTTP_ASSET_C80[]  PROGMEM = "<link rel='stylesheet' href='" WMA_WMC80_CSS "'>";
+static const char HTTP_ASSET_QI[]   PROGMEM = "<link rel='stylesheet' href='" WMA_WMQI_CSS "'>";
+static const char HTTP_ASSET_STYLE[] PROGMEM = "<style>";
+static const char HTTP_ASSET_OK[]   PROGMEM = "</style><link rel='stylesheet' href='" WMA_WMMSG_CSS "'><style>";
+
+static const char HTTP_HEAD_CC_ASSET[] PROGMEM = "public, max-age=31536000, immutable";
+#endif
+
 #endif  // _WM_STRINGS_EN_H_
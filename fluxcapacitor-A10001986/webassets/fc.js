@@ -0,0 +1 @@
+window.onload=function(){xxx=document.querySelector('script[data-t]');xxx=xxx?xxx.dataset.t:'';yyy='?';wr=ge('wrap');if(wr){aa=ge('h3');if(aa){yyy=aa.innerHTML;aa.remove();dlel('h1')}zz=(Math.random()>0.8);dd=document.createElement('div');dd.classList.add('tpm0');dd.innerHTML='<div class="tpm" onClick="shsp(1);window.location=\'/\'"><div class="tpm2"><img id="spi" src="'+(zz?'{{fcspi1.png}}':'{{fcspi0.png}}')+'" class="tpm3"></div><H1 class="tpmh1"'+(zz?' style="margin-left:1.4em"':'')+'>'+xxx+'</H1>'+'<H3 class="tpmh3"'+(zz?' style="padding-left:5em"':'')+'>'+yyy+'</div></div>';wr.insertBefore(dd,wr.firstChild);wr.style.position='relative'}var lc=ge('lc');if(lc){lc.style.transform='rotate('+(358+[0,1,3,4,5][Math.floor(Math.random()*4)])+'deg)'}}
@@ -0,0 +1,87 @@
+/*
+ * Host test: AudioOutput gain ramp (TWESP32)
+ *
+ * - A gain change reaches its target in AO_GAINRAMP samples in equal
+ *   steps (give or take the rounding remainder).
+ * - AmplifyR() (packed high half) matches AmplifyL() for all inputs.
+ * - Setting an unchanged gain does not restart the ramp.
+ * - A 100Hz sine across a 0.1 -> 1.0 change shows no sample step
+ *   beyond the sine's own slope (no click).
+ */
+
+#include <math.h>
+#include "AudioOutput.h"
+
+class TestOutput : public AudioOutput {
+    public:
+        int16_t outL, outR;
+        void put(int16_t l, int16_t r)
+        {
+            AmplifyL(l);
+            outL = l;
+            outR = (int16_t)(AmplifyR(r) >> 16);
+            StepGain();
+        }
+        int32_t gain() { return gainL; }
+        int ramp()     { return gainRamp; }
+};
+
+static int fails = 0;
+
+static void check(bool ok, const char *what)
+{
+    printf("%s: %s\n", ok ? "ok  " : "FAIL", what);
+    if(!ok) fails++;
+}
+
+int main()
+{
+    TestOutput t;
+    int32_t prev, maxStep = 0;
+    int n = 0;
+
+    t.SetGain(0.02f);
+    for(int i = 0; i < AO_GAINRAMP; i++) t.put(0, 0);
+
+    t.SetGain(1.0f);
+    prev = t.gain();
+    while(t.ramp()) {
+        t.put(0, 0);
+        if(abs(t.gain() - prev) > maxStep) maxStep = abs(t.gain() - prev);
+        prev = t.gain();
+        n++;
+    }
+    printf("      0.02 -> 1.0: %d samples, max step %d/16384\n", n, maxStep);
+    check(n == AO_GAINRAMP, "ramp length is AO_GAINRAMP");
+    check(t.gain() == 16384, "ramp ends on target");
+    // the last step also takes the remainder of the division
+    check(maxStep < (16384 - 327) / AO_GAINRAMP + AO_GAINRAMP, "ramp steps are even");
+
+    int bad = 0;
+    t.SetGain(0.37f);
+    for(int i = 0; i < AO_GAINRAMP; i++) t.put(0, 0);
+    for(int s = -32768; s < 32768; s++) {
+        t.put(s, s);
+        if(t.outL != t.outR) bad++;
+    }
+    check(!bad, "AmplifyR matches AmplifyL");
+
+    t.SetGain(0.37f);
+    check(!t.ramp(), "unchanged gain does not restart ramp");
+
+    double maxJump = 0, slope = 30000 * 2 * M_PI * 100 / 44100.0;
+    int16_t last = 0;
+    t.SetGain(0.1f);
+    for(int i = 0; i < AO_GAINRAMP; i++) t.put(0, 0);
+    for(int i = 0; i < 2000; i++) {
+        int16_t s = (int16_t)(30000 * sin(2 * M_PI * 100 * i / 44100.0));
+        if(i == 1000) t.SetGain(1.0f);
+        t.put(s, s);
+        if(i && fabs(t.outL - last) > maxJump) maxJump = fabs(t.outL - last);
+        last = t.outL;
+    }
+    printf("      max step across 0.1 -> 1.0: %.0f (sine slope %.0f)\n", maxJump, slope);
+    check(maxJump <= slope + 1, "no click on gain change");
+
+    return fails != 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Host test: AudioOutputMixer into a capturing sink
+ *
+ * - Two voices (1kHz mono at 22.05kHz, resampled; 440Hz stereo at
+ *   44.1kHz, gain 0.5) sum to the ideal signal within the error of
+ *   linear interpolation.
+ * - The output has the length of the longer voice.
+ * - The sum saturates at +/-32767 (-32768).
+ * - The sink is started once and stopped when all voices have ended.
+ */
+
+#include <math.h>
+#include <vector>
+#include "AudioOutputMixer.h"
+
+class CaptureSink : public AudioOutput {
+    public:
+        std::vector<int16_t> d;
+        int started = 0, stopped = 0;
+        virtual bool begin() override { started++; return true; }
+        virtual bool stop() override { stopped++; return true; }
+        virtual size_t ConsumeSample(int16_t sL, int16_t sR) override
+        {
+            d.push_back(sL);
+            d.push_back(sR);
+            return 1;
+        }
+};
+
+static int fails = 0;
+
+static void check(bool ok, const char *what)
+{
+    printf("%s: %s\n", ok ? "ok  " : "FAIL", what);
+    if(!ok) fails++;
+}
+
+int main()
+{
+    CaptureSink sink;
+    AudioOutputMixer mix(256, &sink, 44100);
+    AudioOutputMixerStub *a = mix.NewInput(), *b = mix.NewInput();
+    const int NA = 22050, NB = 22050;
+    int ia = 0, ib = 0;
+
+    a->SetChannels(1);
+    a->SetRate(22050);
+    a->begin();
+    b->SetRate(44100);
+    b->SetGain(0.5f);
+    b->begin();
+
+    while(ia < NA || ib < NB) {
+        while(ia < NA && a->ConsumeSample((int16_t)(20000 * sin(2 * M_PI * 1000 * ia / 22050.0)), 0)) ia++;
+        if(ia >= NA) a->stop();
+        while(ib < NB) {
+            int16_t s = (int16_t)(30000 * sin(2 * M_PI * 440 * ib / 44100.0));
+            if(!b->ConsumeSample(s, s)) break;
+            ib++;
+        }
+        if(ib >= NB) b->stop();
+        mix.loop();
+    }
+    mix.loop();
+
+    size_t frames = sink.d.size() / 2;
+    printf("      %zu frames, sink started %d stopped %d\n", frames, sink.started, sink.stopped);
+    check(frames >= 44100 - 2 && frames <= 44100 + 2, "output length follows the longer voice");
+    check(sink.started == 1 && sink.stopped == 1, "sink started and stopped once");
+
+    // voice a is delayed by one input sample through interpolation
+    double maxErr = 0;
+    for(size_t i = 100; i < frames - 100; i++) {
+        double t = i / 44100.0;
+        double e = 20000 * sin(2 * M_PI * 1000 * (t - 1 / 22050.0));
+        if(i < (size_t)NB) e += 15000 * sin(2 * M_PI * 440 * t);
+        if(e > 32767) e = 32767;
+        if(e < -32768) e = -32768;
+        for(int ch = 0; ch < 2; ch++) {
+            double err = fabs(sink.d[2 * i + ch] - e);
+            if(err > maxErr) maxErr = err;
+        }
+    }
+    // linear interpolation of 1kHz at 22.05kHz: A * (pi * f / fs)^2 / 2
+    double interpErr = 20000 * pow(M_PI * 1000 / 22050.0, 2) / 2;
+    printf("      max error vs ideal %.0f (interpolation bound %.0f)\n", maxErr, interpErr);
+    check(maxErr <= interpErr + 4, "mix matches the ideal sum");
+
+    CaptureSink s2;
+    AudioOutputMixer m2(64, &s2);
+    AudioOutputMixerStub *x = m2.NewInput(), *y = m2.NewInput();
+    x->begin();
+    y->begin();
+    x->ConsumeSample(30000, -30000);
+    y->ConsumeSample(30000, -30000);
+    m2.loop();
+    m2.loop();
+    check(s2.d.size() >= 2 && s2.d[0] == 32767 && s2.d[1] == -32768, "sum saturates");
+
+    return fails != 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * Host test: fc_evqueue.h (MPSC event queue), built with
+ * -fsanitize=thread
+ *
+ * Several producer threads post to one queue while the consumer
+ * drains it. Every accepted event must be popped exactly once, in
+ * per-producer order, and every rejected post must be counted in
+ * overflows.
+ * - First run: producers retry rejected posts, so every event must
+ *   arrive, without gaps.
+ * - Second run: producers drop rejected posts (as fcPostEvent()
+ *   does) and the consumer is slow, so the queue overflows.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <atomic>
+#include "fc_evqueue.h"
+
+#define PRODUCERS 4
+#define EVENTS    100000
+
+static fcEvQueue q;
+static std::atomic<int> running;
+static bool retry;
+static uint32_t pushed[PRODUCERS], rejected[PRODUCERS];
+
+static void producer(int id)
+{
+    for(uint32_t i = 0; i < EVENTS; i++) {
+        for(;;) {
+            if(evPush(&q, id, i)) {
+                pushed[id]++;
+                break;
+            }
+            rejected[id]++;
+            if(!retry) break;
+            std::this_thread::yield();
+        }
+    }
+    running--;
+}
+
+static int run(bool doRetry)
+{
+    uint32_t next[PRODUCERS] = { 0 }, popped[PRODUCERS] = { 0 };
+    uint32_t sent = 0, lost = 0;
+    std::thread t[PRODUCERS];
+    uint8_t type;
+    uint32_t arg;
+    int err = 0;
+
+    evInit(&q);
+    memset(pushed, 0, sizeof(pushed));
+    memset(rejected, 0, sizeof(rejected));
+    retry = doRetry;
+    running = PRODUCERS;
+    for(int i = 0; i < PRODUCERS; i++) t[i] = std::thread(producer, i);
+
+    for(;;) {
+        bool done = !running;
+        while(evPop(&q, type, arg)) {
+            if(type >= PRODUCERS) {
+                printf("      bad type %u\n", type);
+                return 1;
+            }
+            if(arg < next[type] || (retry && arg != next[type])) {
+                printf("      producer %u: %u after %u\n", type, arg, next[type] - 1);
+                err++;
+            }
+            next[type] = arg + 1;
+            popped[type]++;
+            if(!retry) std::this_thread::yield();
+        }
+        if(done) break;
+    }
+    for(int i = 0; i < PRODUCERS; i++) t[i].join();
+
+    for(int i = 0; i < PRODUCERS; i++) {
+        if(popped[i] != pushed[i] || (retry && pushed[i] != EVENTS)) {
+            printf("      producer %d: pushed %u popped %u\n", i, pushed[i], popped[i]);
+            err++;
+        }
+        sent += pushed[i];
+        lost += rejected[i];
+    }
+    if(q.overflows != lost) {
+        printf("      overflows %u, rejected %u\n", q.overflows, lost);
+        err++;
+    }
+    printf("%s: %s, %u events, %u overflows\n", err ? "FAIL" : "ok  ",
+        retry ? "retrying producers" : "dropping producers, slow consumer", sent, q.overflows);
+
+    return err;
+}
+
+int main()
+{
+    int err = run(true);
+
+    err += run(false);
+    if(!q.overflows) {
+        printf("FAIL: slow consumer saw no overflows\n");
+        err++;
+    }
+
+    return err ? 1 : 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * Host test: write synthetic MPEG-1 Layer III frames
+ *
+ * Headers and side info are valid but otherwise random (stereo, joint
+ * stereo and mono, long and switched blocks, all table selects); main
+ * data is random. This exercises the Huffman decoder, requantization,
+ * stereo processing and synthesis on every path, including the error
+ * paths. The output depends on the seed only.
+ *
+ * usage: mkframes [-s] <frames> <seed> <out.mp3>
+ *   -s  stereo and joint stereo frames only
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <stdint.h>
+
+# define FRAMESIZE	417	/* 128kbps, 44.1kHz, no padding */
+
+static uint32_t rng;
+
+static
+uint32_t rnd(uint32_t n)
+{
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+
+  return rng % n;
+}
+
+static unsigned char *frame;
+static unsigned int bitpos;
+
+static
+void put(uint32_t value, unsigned int len)
+{
+  while (len--) {
+    unsigned char mask = 0x80 >> (bitpos & 7);
+
+    if ((value >> len) & 1)
+      frame[bitpos >> 3] |= mask;
+    else
+      frame[bitpos >> 3] &= ~mask;
+
+    ++bitpos;
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  /* valid table_select values (4 and 14 are unused) */
+  static unsigned char const modes[3] = { 0, 1, 3 };
+  static unsigned char const tsel[30] = {
+     0,  1,  2,  3,  5,  6,  7,  8,  9, 10, 11, 12, 13, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31
+  };
+  unsigned char buf[FRAMESIZE];
+  unsigned int nframes, f, i, gr, ch, nch, mode, avail, nmodes = 3;
+  FILE *out;
+
+  if (argc > 1 && argv[1][0] == '-' && argv[1][1] == 's') {
+    nmodes = 2;
+    ++argv;
+    --argc;
+  }
+
+  if (argc != 4) {
+    fprintf(stderr, "usage: mkframes [-s] <frames> <seed> <out.mp3>\n");
+    return 2;
+  }
+
+  nframes = atoi(argv[1]);
+  rng     = 2463534242UL ^ (uint32_t) atoi(argv[2]);
+
+  if (!(out = fopen(argv[3], "wb"))) {
+    perror(argv[3]);
+    return 2;
+  }
+
+  frame = buf;
+
+  for (f = 0; f < nframes; ++f) {
+    for (i = 0; i < FRAMESIZE; ++i)
+      buf[i] = rnd(256);
+
+    /* stereo, joint stereo (random mode extension) or mono */
+    mode = modes[rnd(nmodes)];
+    nch  = (mode == 3) ? 1 : 2;
+
+    bitpos = 0;
+    put(0xfffb, 16);		/* MPEG-1 Layer III, no CRC */
+    put(0x9, 4);		/* 128kbps */
+    put(0x0, 2);		/* 44.1kHz */
+    put(0x0, 2);		/* no padding, private */
+    put(mode, 2);
+    put(rnd(4), 2);		/* mode extension */
+    put(0x4, 4);		/* original */
+
+    /* side info */
+    put(0, 9);			/* main_data_begin: no reservoir */
+    put(0, nch == 1 ? 5 : 3);
+    put(0, 4 * nch);		/* scfsi */
+
+    avail = (FRAMESIZE - 4 - (nch == 1 ? 17 : 32)) * 8 / (2 * nch);
+
+    for (gr = 0; gr < 2; ++gr) {
+      for (ch = 0; ch < nch; ++ch) {
+	/* mostly small big_values, so that many granules decode fully */
+	put(avail / 2 + rnd(avail / 2), 12);	/* part2_3_length */
+	put(rnd(4) ? rnd(64) : rnd(289), 9);	/* big_values */
+	put(110 + rnd(30), 8);	/* global_gain */
+	put(rnd(16), 4);	/* scalefac_compress */
+
+	if (rnd(4) == 0) {
+	  put(1, 1);		/* window switching */
+	  put(1 + rnd(3), 2);	/* block_type */
+	  put(rnd(2), 1);	/* mixed_block_flag */
+	  for (i = 0; i < 2; ++i)
+	    put(tsel[rnd(30)], 5);
+	  for (i = 0; i < 3; ++i)
+	    put(rnd(8), 3);	/* subblock_gain */
+	}
+	else {
+	  put(0, 1);
+	  for (i = 0; i < 3; ++i)
+	    put(tsel[rnd(30)], 5);
+	  put(rnd(16), 4);	/* region0_count */
+	  put(rnd(8), 3);	/* region1_count */
+	}
+
+	put(rnd(2), 1);		/* preflag */
+	put(rnd(2), 1);		/* scalefac_scale */
+	put(rnd(2), 1);		/* count1table_select */
+      }
+    }
+
+    if (fwrite(buf, FRAMESIZE, 1, out) != 1) {
+      perror(argv[3]);
+      return 1;
+    }
+  }
+
+  return fclose(out) ? 1 : 0;
+}
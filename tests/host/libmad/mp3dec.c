@@ -0,0 +1,146 @@
+/*
+ * Host test: decode an MPEG audio stream to raw 16-bit PCM
+ *
+ * Writes interleaved native-endian samples (1 or 2 channels, as
+ * decoded) and prints the number of frames, decode errors and a
+ * checksum over the error sequence, so two builds can be compared
+ * by output and by error behaviour.
+ *
+ * usage: mp3dec [-m] [-h] [-p] <in.mp3> <out.pcm>
+ *   -m  MAD_OPTION_SINGLECHANNEL (mono downmix)
+ *   -h  MAD_OPTION_HALFSAMPLERATE
+ *   -p  print the MAD_PROFILE counters (profiling builds only)
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+
+# include "config.h"
+# include "global.h"
+# include "stream.h"
+# include "frame.h"
+# include "synth.h"
+# include "decoder.h"
+
+/* provided by AudioGeneratorMP3.cpp on the device */
+int stackfree(void)
+{
+  return 1 << 20;
+}
+
+static FILE *out;
+
+static
+enum mad_flow output(void *data, struct mad_header const *header,
+                     struct mad_pcm *pcm)
+{
+  unsigned int i, ch;
+  int16_t s[2];
+
+  (void) data;
+  (void) header;
+
+  for (i = 0; i < pcm->length; ++i) {
+    for (ch = 0; ch < pcm->channels; ++ch)
+      s[ch] = pcm->samples[ch][i];
+    fwrite(s, sizeof(s[0]), pcm->channels, out);
+  }
+
+  return MAD_FLOW_CONTINUE;
+}
+
+int main(int argc, char *argv[])
+{
+  struct mad_stream stream;
+  struct mad_frame frame;
+  struct mad_synth synth;
+  unsigned char *buf;
+  unsigned long frames = 0, errors = 0, errsum = 0;
+  int options = 0, prof = 0, argi;
+  long len;
+  FILE *in;
+
+  for (argi = 1; argi < argc && argv[argi][0] == '-'; ++argi) {
+    if (!strcmp(argv[argi], "-m"))
+      options |= MAD_OPTION_SINGLECHANNEL;
+    else if (!strcmp(argv[argi], "-h"))
+      options |= MAD_OPTION_HALFSAMPLERATE;
+    else if (!strcmp(argv[argi], "-p"))
+      prof = 1;
+    else
+      break;
+  }
+
+  if (argc - argi != 2) {
+    fprintf(stderr, "usage: %s [-m] [-h] [-p] <in.mp3> <out.pcm>\n", argv[0]);
+    return 2;
+  }
+
+  if (!(in = fopen(argv[argi], "rb")) ||
+      fseek(in, 0, SEEK_END) || (len = ftell(in)) < 0) {
+    perror(argv[argi]);
+    return 2;
+  }
+  rewind(in);
+
+  buf = malloc(len + MAD_BUFFER_GUARD);
+  if (!buf || fread(buf, 1, len, in) != (size_t) len) {
+    perror(argv[argi]);
+    return 2;
+  }
+  memset(buf + len, 0, MAD_BUFFER_GUARD);
+  fclose(in);
+
+  if (!(out = fopen(argv[argi + 1], "wb"))) {
+    perror(argv[argi + 1]);
+    return 2;
+  }
+
+  mad_stream_init(&stream);
+  mad_frame_init(&frame);
+  mad_synth_init(&synth);
+
+  mad_stream_buffer(&stream, buf, len + MAD_BUFFER_GUARD);
+  mad_stream_options(&stream, options);
+
+  for (;;) {
+    if (mad_frame_decode(&frame, &stream) == -1) {
+      if (stream.error == MAD_ERROR_BUFLEN || !MAD_RECOVERABLE(stream.error))
+	break;
+
+      ++errors;
+      errsum = errsum * 31 + stream.error + frames;
+      continue;
+    }
+
+    ++frames;
+    mad_synth_frame(&synth, &frame, output, 0);
+  }
+
+  printf("frames %lu errors %lu errsum %08lx\n", frames, errors,
+         errsum & 0xffffffffUL);
+
+# if defined(MAD_PROFILE)
+  if (prof) {
+    int i;
+
+    for (i = 0; i < MAD_PROF_NUM; ++i) {
+      printf("  %-8s %10.1f us/call %8lu calls\n", mad_prof_names[i],
+             mad_prof[i].calls ?
+               mad_prof[i].cycles / 1000.0 / mad_prof[i].calls : 0.0,
+             (unsigned long) mad_prof[i].calls);
+    }
+  }
+# else
+  (void) prof;
+# endif
+
+  mad_synth_finish(&synth);
+  mad_frame_finish(&frame);
+  mad_stream_finish(&stream);
+  free(buf);
+
+  return fclose(out) ? 1 : 0;
+}
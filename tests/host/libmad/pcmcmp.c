@@ -0,0 +1,116 @@
+/*
+ * Host test: compare two raw 16-bit PCM files
+ *
+ * usage: pcmcmp <a.pcm> <b.pcm> <maxdiff> [<minsnr>]
+ *        pcmcmp -m <stereo.pcm> <mono.pcm> <maxdiff> [<minsnr>]
+ *
+ * The first form compares sample by sample; files must be of equal
+ * length. With -m, each mono sample is compared against the mean of
+ * the stereo pair; pairs where either channel clips are skipped, as
+ * the downmix of clipped PCM is not the clipped downmix.
+ *
+ * Fails if any sample differs by more than maxdiff, or if the
+ * signal-to-error ratio is below minsnr (dB).
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+# include <math.h>
+
+static
+int16_t *load(char const *name, long *count)
+{
+  int16_t *buf;
+  long len;
+  FILE *f;
+
+  if (!(f = fopen(name, "rb")) || fseek(f, 0, SEEK_END) ||
+      (len = ftell(f)) < 0) {
+    perror(name);
+    exit(2);
+  }
+  rewind(f);
+
+  if (!(buf = malloc(len + 2)) || fread(buf, 1, len, f) != (size_t) len) {
+    perror(name);
+    exit(2);
+  }
+  fclose(f);
+
+  *count = len / 2;
+
+  return buf;
+}
+
+int main(int argc, char *argv[])
+{
+  int16_t *a, *b;
+  long na, nb, i, n = 0, skipped = 0, maxat = -1;
+  int mono = 0, maxdiff, diff, worst = 0;
+  double err = 0, sig = 0, snr = INFINITY, minsnr = 0;
+
+  if (argc > 1 && !strcmp(argv[1], "-m")) {
+    mono = 1;
+    ++argv;
+    --argc;
+  }
+
+  if (argc != 4 && argc != 5) {
+    fprintf(stderr, "usage: pcmcmp [-m] <a.pcm> <b.pcm> <maxdiff> [<minsnr>]\n");
+    return 2;
+  }
+
+  a = load(argv[1], &na);
+  b = load(argv[2], &nb);
+  maxdiff = atoi(argv[3]);
+  if (argc == 5)
+    minsnr = atof(argv[4]);
+
+  if ((mono ? na / 2 : na) != nb) {
+    printf("%s: length differs (%ld vs %ld samples)\n", argv[2],
+           mono ? na / 2 : na, nb);
+    return 1;
+  }
+
+  for (i = 0; i < nb; ++i) {
+    int ref;
+
+    if (mono) {
+      if (abs(a[2 * i]) >= 32767 || abs(a[2 * i + 1]) >= 32767) {
+	++skipped;
+	continue;
+      }
+      ref = (a[2 * i] + a[2 * i + 1]) / 2;
+    }
+    else
+      ref = a[i];
+
+    diff = abs(ref - b[i]);
+    if (diff > worst) {
+      worst = diff;
+      maxat = i;
+    }
+
+    sig += (double) ref * ref;
+    err += (double) diff * diff;
+    ++n;
+  }
+
+  printf("%s: %ld samples, max diff %d", argv[2], n, worst);
+  if (maxat >= 0)
+    printf(" at %ld", maxat);
+  if (err > 0) {
+    snr = 10 * log10(sig / err);
+    printf(", SNR %.1f dB", snr);
+  }
+  if (skipped)
+    printf(", %ld clipped skipped", skipped);
+  printf("\n");
+
+  free(a);
+  free(b);
+
+  return worst > maxdiff || snr < minsnr;
+}
@@ -0,0 +1,80 @@
+/*
+ * Host test: OPT_RQ_COMPACT against the full rq_table
+ *
+ * III_rqpower() must give the same exponent as rq_table[x] and a
+ * mantissa within RQ_MAXULP for all 8207 inputs. Also prints the host
+ * time per value for both (informational only).
+ */
+
+# include "layer3.c"
+
+# include <stdio.h>
+# include <time.h>
+
+# if !defined(OPT_RQ_COMPACT)
+#  error "build with -DOPT_RQ_COMPACT=1"
+# endif
+
+# define RQ_MAXULP	2
+
+/* the reference; layer3.c does not build it with OPT_RQ_COMPACT */
+static
+struct fixedfloat const ref_table[8207] = {
+#  include "rq_table.dat.h"
+};
+
+int stackfree(void)
+{
+  return 1 << 20;
+}
+
+static
+double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(void)
+{
+  unsigned int x, r, worst = 0, worstat = 0, expbad = 0;
+  volatile unsigned long sink = 0;
+  double t0, t1, t2;
+
+  for (x = 0; x < 8207; ++x) {
+    struct fixedfloat a = III_rqpower(x), b = ref_table[x];
+    long diff;
+
+    if (a.exponent != b.exponent && b.mantissa) {
+      printf("x=%u: exponent %u, expected %u\n", x, a.exponent, b.exponent);
+      ++expbad;
+      continue;
+    }
+
+    diff = labs((long) a.mantissa - (long) b.mantissa);
+    if (diff > (long) worst) {
+      worst   = diff;
+      worstat = x;
+    }
+  }
+
+  t0 = now();
+  for (r = 0; r < 200; ++r)
+    for (x = 1; x < 8207; ++x)
+      sink += III_rqpower(x).mantissa;
+  t1 = now();
+  for (r = 0; r < 200; ++r)
+    for (x = 1; x < 8207; ++x)
+      sink += ref_table[x].mantissa;
+  t2 = now();
+
+  printf("rqpower: max mantissa diff %u ULP (x=%u), %u exponent mismatches\n",
+         worst, worstat, expbad);
+  printf("rqpower: host %.1f ns/value compact, %.1f ns/value table\n",
+         (t1 - t0) * 1e9 / (200 * 8206.0), (t2 - t1) * 1e9 / (200 * 8206.0));
+
+  return expbad || worst > RQ_MAXULP;
+}
@@ -0,0 +1,244 @@
+/*
+ * Host test: cooperative scheduler (fc_sched.h) on a simulated clock
+ *
+ * - Modal gate: schedModal() is set from schedStart(.., true) until
+ *   schedDone(); non-modal jobs do not set it; main_loop() input
+ *   handling is skipped meanwhile.
+ * - Latency: a job whose wait is satisfied, and a due timer, run in
+ *   the next sched_loop(); a job runs at most one step per pass.
+ * - Timers: never early, fire in order of expiry; schedDefer() runs
+ *   in a later pass, never from within the caller.
+ * - Generations: timers and jobs set up during a pass (from a
+ *   callback or a step) wait for the next pass.
+ * - Wait timeouts; duplicate schedStart() and full tables fail.
+ */
+
+#include <stdio.h>
+#include <vector>
+#include <Arduino.h>
+
+static unsigned long simNow = 1000;
+#define millis() simNow
+
+static bool condMet[8];
+static bool schedCond(uint8_t what) { return condMet[what]; }
+
+#include "fc_sched.h"
+
+static int fails = 0;
+
+static void check(bool ok, const char *what)
+{
+    printf("%s: %s\n", ok ? "ok  " : "FAIL", what);
+    if(!ok) fails++;
+}
+
+// main_loop(): scheduler, then input unless a modal job runs
+static int inputPasses = 0;
+static void mainLoop()
+{
+    sched_loop();
+    if(schedModal())
+        return;
+    inputPasses++;
+}
+
+static void idle()
+{
+    for(int i = 0; i < SCHED_TIMERS; i++) schedTimers[i].cb = NULL;
+    for(int i = 0; i < SCHED_JOBS; i++) {
+        if(schedJobs[i].func) schedDone(&schedJobs[i]);
+    }
+}
+
+// Timers
+static std::vector<int> fired;
+static std::vector<unsigned long> firedAt;
+#define TIMER(n) static void t##n() { fired.push_back(n); firedAt.push_back(simNow); }
+TIMER(1) TIMER(2) TIMER(3) TIMER(4) TIMER(5)
+
+static bool deferRanInline = false, deferRan = false;
+static void deferred() { deferRan = true; }
+static void deferrer()
+{
+    schedDefer(deferred);
+    deferRanInline = deferRan;
+}
+
+// Jobs
+static std::vector<int> steps;
+static unsigned long stepAt[8];
+
+static void modalJob(schedJob *job)
+{
+    stepAt[job->step] = simNow;
+    steps.push_back(job->step);
+    switch(job->step) {
+    case 0:
+        schedWait(job, SCHED_W_TIME, 50);
+        job->step = 1;
+        break;
+    case 1:
+        schedWait(job, SCHED_W_AUDIO, 0);
+        job->step = 2;
+        break;
+    case 2:
+        schedWait(job, SCHED_W_LEDSEQ, 30);
+        job->step = 3;
+        break;
+    default:
+        schedDone(job);
+    }
+}
+
+static int plainSteps = 0;
+static void plainJob(schedJob *job)
+{
+    // No wait: runs once per pass
+    if(++plainSteps == 3) schedDone(job);
+}
+
+static schedJob *spawned = NULL;
+static int spawnedRuns = 0;
+static void spawnedJob(schedJob *job)
+{
+    spawnedRuns++;
+    schedDone(job);
+}
+static void spawnerJob(schedJob *job)
+{
+    spawned = schedStart(spawnedJob);
+    schedDone(job);
+}
+
+int main()
+{
+    // Timers: expiry order, never early
+    {
+        schedAfter(30, t3);
+        schedAfter(10, t1);
+        schedAfter(50, t5);
+        schedAfter(20, t2);
+        schedAfter(40, t4);
+        unsigned long start = simNow;
+        for(int i = 0; i < 60; i++) {
+            simNow++;
+            mainLoop();
+        }
+        bool order = (fired.size() == 5), early = false, late = false;
+        for(size_t i = 0; i < fired.size(); i++) {
+            if(fired[i] != (int)i + 1) order = false;
+            unsigned long due = start + (i + 1) * 10;
+            if(firedAt[i] < due) early = true;
+            if(firedAt[i] > due) late = true;
+        }
+        check(order, "timers fire in order of expiry");
+        check(!early, "timers never fire early");
+        check(!late, "due timers fire in the next pass");
+    }
+
+    // Same-pass generation: timer due now does not fire in the pass
+    // it was set up in; one set up from a callback waits a pass
+    {
+        idle();
+        deferRan = deferRanInline = false;
+        deferrer();
+        check(!deferRan, "schedDefer() does not run from within the caller");
+        mainLoop();
+        check(deferRan && !deferRanInline, "schedDefer() runs in the next pass");
+
+        fired.clear();
+        schedAfter(0, deferrer);
+        deferRan = false;
+        mainLoop();                 // runs deferrer, which defers
+        check(!deferRan, "timer set up from a callback waits for the next pass");
+        mainLoop();
+        check(deferRan, "... and runs then");
+    }
+
+    // Modal job: gate, waits, latency, one step per pass
+    {
+        idle();
+        steps.clear();
+        check(!schedModal(), "no modal job: not gated");
+        schedJob *job = schedStart(modalJob, true);
+        check(job && schedModal(), "modal job gates main_loop()");
+        check(!schedStart(modalJob, true), "duplicate schedStart() fails");
+        inputPasses = 0;
+        unsigned long t0 = simNow;
+        mainLoop();
+        check(steps.size() == 1 && stepAt[0] == t0, "step 0 runs in the first pass");
+        check(inputPasses == 0, "input is held while modal");
+
+        // SCHED_W_TIME 50
+        for(int i = 0; i < 100 && steps.size() < 2; i++) {
+            simNow++;
+            mainLoop();
+        }
+        check(stepAt[1] == t0 + 50, "time wait: runs in the pass it expires");
+
+        // SCHED_W_AUDIO, no timeout: never times out
+        simNow += 100000;
+        mainLoop();
+        check(steps.size() == 2, "condition wait without timeout holds");
+        condMet[SCHED_W_AUDIO] = true;
+        mainLoop();
+        check(steps.size() == 3, "condition met: runs in the next pass");
+
+        // SCHED_W_LEDSEQ with 30ms timeout, condition never met
+        unsigned long t2 = simNow;
+        for(int i = 0; i < 100 && steps.size() < 4; i++) {
+            simNow++;
+            mainLoop();
+        }
+        check(stepAt[3] == t2 + 30, "condition wait times out");
+        check(!schedModal(), "schedDone() lifts the gate");
+        inputPasses = 0;
+        mainLoop();
+        check(inputPasses == 1, "input runs again");
+        check(!job->func, "slot freed");
+    }
+
+    // Non-modal job; no wait: one step per pass
+    {
+        idle();
+        plainSteps = 0;
+        schedStart(plainJob);
+        check(!schedModal(), "non-modal job does not gate");
+        mainLoop();
+        check(plainSteps == 1, "one step per pass (1)");
+        mainLoop();
+        check(plainSteps == 2, "one step per pass (2)");
+        mainLoop();
+        mainLoop();
+        check(plainSteps == 3, "job done after 3 steps");
+    }
+
+    // Job started from a step waits for the next pass
+    {
+        idle();
+        spawnedRuns = 0;
+        schedStart(spawnerJob);
+        mainLoop();
+        check(spawned && spawnedRuns == 0, "job started from a step waits for the next pass");
+        mainLoop();
+        check(spawnedRuns == 1, "... and runs then");
+    }
+
+    // Table limits
+    {
+        idle();
+        int n = 0;
+        while(schedAfter(5, t1)) n++;
+        check(n == SCHED_TIMERS, "schedAfter() fails when the table is full");
+        idle();
+        schedFunc f[SCHED_JOBS + 1] = { modalJob, plainJob, spawnedJob, spawnerJob, (schedFunc)deferrer };
+        n = 0;
+        for(int i = 0; i <= SCHED_JOBS; i++) if(schedStart(f[i])) n++;
+        check(n == SCHED_JOBS, "schedStart() fails when the table is full");
+        idle();
+        check(!schedModal(), "modal count balanced");
+    }
+
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * Host test: SD sector cache (sd_cache.cpp) against a RAM disk
+ *
+ * - Random single/multi-sector reads, writes (with invalidation, as
+ *   sd_diskio does) and injected read errors always return the
+ *   current disk contents, for several cache geometries.
+ * - A sequential single-sector scan issues one device read per line.
+ * - Read-ahead stops at the end of the disk.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sd_cache.h"
+
+#define DISKSECS 512
+
+static uint8_t disk[DISKSECS][512];
+static uint32_t devReads;
+static int failNext;
+
+static bool ramRead(void *ctx, uint8_t *buf, uint32_t sector, uint32_t count)
+{
+    (void)ctx;
+    if(sector + count > DISKSECS) {
+        printf("      read beyond end: %u+%u\n", sector, count);
+        exit(1);
+    }
+    devReads++;
+    if(failNext) {
+        failNext = 0;
+        memset(buf, 0xee, count * 512);
+        return false;
+    }
+    memcpy(buf, disk[sector], count * 512);
+    return true;
+}
+
+static uint32_t rng = 2463534242UL;
+
+static uint32_t rnd(uint32_t n)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng % n;
+}
+
+static void fillSector(uint32_t sector)
+{
+    for(int i = 0; i < 512; i++) disk[sector][i] = rnd(256);
+}
+
+static int fails = 0;
+
+static void check(bool ok, const char *what)
+{
+    printf("%s: %s\n", ok ? "ok  " : "FAIL", what);
+    if(!ok) fails++;
+}
+
+static bool randomOps(int sets, int ways, int line)
+{
+    static uint8_t buf[8][512];
+    sd_cache_t *c = sd_cache_new(sets, ways, line);
+    uint32_t cur = rnd(DISKSECS);
+    bool ok = true;
+
+    sd_cache_set_size(c, DISKSECS);
+
+    for(int n = 0; n < 200000 && ok; n++) {
+        int op = rnd(100);
+        if(op < 70) {
+            // mostly streaming, sometimes a jump
+            cur = (op < 55) ? (cur + 1) % DISKSECS : rnd(DISKSECS);
+            // an injected device error must fail the read (hits don't read)
+            bool inject = !rnd(50);
+            failNext = inject;
+            bool res = sd_cache_read(c, buf[0], cur, 1, ramRead, NULL);
+            bool fail = inject && !failNext;
+            failNext = 0;
+            if(res == fail || (res && memcmp(buf[0], disk[cur], 512))) ok = false;
+        } else if(op < 85) {
+            uint32_t s = rnd(DISKSECS - 8), cnt = 2 + rnd(7);
+            if(!sd_cache_read(c, buf[0], s, cnt, ramRead, NULL) ||
+               memcmp(buf[0], disk[s], cnt * 512)) ok = false;
+        } else {
+            uint32_t s = rnd(DISKSECS - 8), cnt = 1 + rnd(8);
+            for(uint32_t i = 0; i < cnt; i++) fillSector(s + i);
+            sd_cache_invalidate(c, s, cnt);
+        }
+    }
+    failNext = 0;
+    sd_cache_free(c);
+
+    return ok;
+}
+
+int main()
+{
+    char what[80];
+
+    for(uint32_t s = 0; s < DISKSECS; s++) fillSector(s);
+
+    static const int geo[][3] = { { 1, 1, 1 }, { 2, 2, 4 }, { 4, 2, 8 }, { 1, 4, 32 }, { 3, 3, 5 } };
+    for(unsigned g = 0; g < sizeof(geo) / sizeof(geo[0]); g++) {
+        snprintf(what, sizeof(what), "random ops, %d sets x %d ways x %d sectors",
+                 geo[g][0], geo[g][1], geo[g][2]);
+        check(randomOps(geo[g][0], geo[g][1], geo[g][2]), what);
+    }
+
+    uint8_t buf[512];
+    sd_cache_t *c = sd_cache_new(2, 2, 4);
+    sd_cache_set_size(c, DISKSECS);
+    sd_cache_read(c, buf, 63, 1, ramRead, NULL);
+    devReads = 0;
+    for(uint32_t s = 64; s < 128; s++) sd_cache_read(c, buf, s, 1, ramRead, NULL);
+    check(devReads == 16, "sequential scan reads one line per command");
+
+    sd_cache_stats_t st;
+    sd_cache_get_stats(c, &st);
+    check(st.hits == 48 && st.misses == 17 && st.readAhead == 48, "stats count hits, misses and read-ahead");
+
+    sd_cache_flush(c);
+    sd_cache_read(c, buf, DISKSECS - 3, 1, ramRead, NULL);
+    sd_cache_read(c, buf, DISKSECS - 2, 1, ramRead, NULL);
+    check(!memcmp(buf, disk[DISKSECS - 2], 512), "read-ahead stops at end of disk");
+    sd_cache_free(c);
+
+    return fails != 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Host test: SD data block CRC16 (sd_diskio_crc.c)
+ *
+ * CRC16() is compared against a bitwise CRC-16/CCITT (poly 0x1021,
+ * init 0) for all 2-byte inputs and random buffers of 0..600 bytes at
+ * all alignments. Build with -DTW_SD_CRC_SLICE=1, 4 or 8. Also prints
+ * the host time per 512-byte block (informational only).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+unsigned short CRC16(const char* data, int length);
+
+static unsigned short crcBitwise(const unsigned char *data, int length)
+{
+    unsigned short crc = 0;
+
+    while (length--) {
+        crc ^= *data++ << 8;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+int main(void)
+{
+    static unsigned char buf[608];
+    unsigned long bad = 0;
+    uint32_t rng = 2463534242UL;
+    struct timespec t0, t1;
+    volatile unsigned short sink = 0;
+
+    for (int i = 0; i < 65536; i++) {
+        buf[0] = i >> 8;
+        buf[1] = i;
+        if (CRC16((const char *)buf, 2) != crcBitwise(buf, 2)) bad++;
+    }
+
+    for (int n = 0; n < 20000; n++) {
+        int len = n % 601, off = n % 8;
+        for (int i = 0; i < len; i++) {
+            rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+            buf[off + i] = rng;
+        }
+        if (CRC16((const char *)buf + off, len) != crcBitwise(buf + off, len)) bad++;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int n = 0; n < 100000; n++) {
+        sink += CRC16((const char *)buf, 512);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    printf("crc16 (slice %d): %lu mismatches, host %.0f ns/block\n",
+           TW_SD_CRC_SLICE, bad,
+           ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / 100000);
+
+    return bad != 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * Host stub for <Arduino.h>: just what the tested sources use.
+ */
+
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <ctype.h>
+#include "pgmspace.h"
+
+// ESP.getCycleCount() counts nanoseconds on the host
+class EspClass {
+    public:
+        uint32_t getFreeHeap() { return 200000; }
+        uint64_t getEfuseMac() { return 0x0100c40a24ULL; }
+        void     restart() { exit(0); }
+        uint32_t getCycleCount()
+        {
+            struct timespec t;
+            clock_gettime(CLOCK_MONOTONIC, &t);
+            return (uint32_t)(t.tv_sec * 1000000000ULL + t.tv_nsec);
+        }
+};
+static EspClass ESP __attribute__((unused));
+
+// delay() does not sleep, it advances millis()
+static unsigned long hostDelayed = 0;
+
+static inline unsigned long millis()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long)(t.tv_sec * 1000ULL + t.tv_nsec / 1000000) + hostDelayed;
+}
+
+static inline void delay(unsigned long ms) { hostDelayed += ms; }
+static inline void yield() {}
+
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+// Arduino String: what WMPage, WiFiManager and their tests use
+class __FlashStringHelper;
+#define F(s)        ((const __FlashStringHelper *)(s))
+#define FPSTR(s)    ((const __FlashStringHelper *)(s))
+
+class String {
+    public:
+        String() { _s = (char *)calloc(1, 1); }
+        String(const char *s) { _s = strdup(s ? s : ""); _len = strlen(_s); }
+        String(const __FlashStringHelper *s) : String((const char *)s) {}
+        String(const String& s) { _s = strdup(s._s); _len = s._len; }
+        explicit String(char c) { char b[2] = { c, 0 }; _s = strdup(b); _len = 1; }
+        explicit String(int v) { num("%d", v); }
+        explicit String(unsigned int v) { num("%u", v); }
+        explicit String(long v) { num("%ld", v); }
+        explicit String(unsigned long v) { num("%lu", v); }
+        ~String() { free(_s); }
+        String& operator=(const String& s)
+        {
+            if(this != &s) { free(_s); _s = strdup(s._s); _len = s._len; }
+            return *this;
+        }
+        String& operator=(const char *s) { return operator=(String(s)); }
+        String& operator=(const __FlashStringHelper *s) { return operator=(String(s)); }
+
+        bool          reserve(unsigned int size) { return true; }
+        unsigned int  length() const { return _len; }
+        bool          isEmpty() const { return !_len; }
+        const char    *c_str() const { return _s; }
+        char          charAt(unsigned int i) const { return i < _len ? _s[i] : 0; }
+        char          operator[](unsigned int i) const { return charAt(i); }
+        void          toCharArray(char *buf, unsigned int size, unsigned int idx = 0) const
+        {
+            if(!size) return;
+            unsigned int n = idx < _len ? _len - idx : 0;
+            if(n > size - 1) n = size - 1;
+            memcpy(buf, _s + (idx < _len ? idx : _len), n);
+            buf[n] = 0;
+        }
+        long          toInt() const { return atol(_s); }
+
+        String&       operator+=(const char *s) { if(s) cat(s, strlen(s)); return *this; }
+        String&       operator+=(const String& s) { cat(s._s, s._len); return *this; }
+        String&       operator+=(const __FlashStringHelper *s) { return operator+=((const char *)s); }
+        String&       operator+=(char c) { cat(&c, 1); return *this; }
+        String&       operator+=(int v) { return operator+=(String(v)); }
+        String&       operator+=(unsigned int v) { return operator+=(String(v)); }
+        String&       operator+=(long v) { return operator+=(String(v)); }
+        String&       operator+=(unsigned long v) { return operator+=(String(v)); }
+        template<typename T>
+        bool          concat(T v) { operator+=(v); return true; }
+
+        bool          equals(const char *s) const { return !strcmp(_s, s ? s : ""); }
+        bool          operator==(const String& s) const { return _len == s._len && equals(s._s); }
+        bool          operator==(const char *s) const { return equals(s); }
+        bool          operator!=(const String& s) const { return !operator==(s); }
+        bool          operator!=(const char *s) const { return !equals(s); }
+        bool          startsWith(const String& s) const { return s._len <= _len && !strncmp(_s, s._s, s._len); }
+        bool          endsWith(const String& s) const { return s._len <= _len && !strcmp(_s + _len - s._len, s._s); }
+
+        int           indexOf(char c, unsigned int from = 0) const
+        {
+            const char *p = from < _len ? strchr(_s + from, c) : NULL;
+            return p ? (int)(p - _s) : -1;
+        }
+        int           indexOf(const String& s, unsigned int from = 0) const
+        {
+            const char *p = from <= _len ? strstr(_s + from, s._s) : NULL;
+            return p ? (int)(p - _s) : -1;
+        }
+        int           lastIndexOf(char c) const
+        {
+            const char *p = strrchr(_s, c);
+            return p ? (int)(p - _s) : -1;
+        }
+        String        substring(unsigned int from, unsigned int to = 0xffffffff) const
+        {
+            if(to > _len) to = _len;
+            if(from > to) { unsigned int t = from; from = to; to = t; }
+            String r;
+            r.cat(_s + from, to - from);
+            return r;
+        }
+
+        void          replace(char find, char repl)
+        {
+            for(char *p = _s; *p; p++) if(*p == find) *p = repl;
+        }
+        void          replace(const String& find, const String& repl)
+        {
+            if(!find._len) return;
+            String r;
+            const char *p = _s, *q;
+            while((q = strstr(p, find._s))) {
+                r.cat(p, q - p);
+                r.cat(repl._s, repl._len);
+                p = q + find._len;
+            }
+            r.cat(p, _s + _len - p);
+            *this = r;
+        }
+        void          toLowerCase() { for(char *p = _s; *p; p++) *p = tolower((unsigned char)*p); }
+        void          toUpperCase() { for(char *p = _s; *p; p++) *p = toupper((unsigned char)*p); }
+        void          trim()
+        {
+            unsigned int a = 0, b = _len;
+            while(a < b && isspace((unsigned char)_s[a])) a++;
+            while(b > a && isspace((unsigned char)_s[b - 1])) b--;
+            *this = substring(a, b);
+        }
+
+    private:
+        void cat(const char *s, unsigned int len)
+        {
+            _s = (char *)realloc(_s, _len + len + 1);
+            memcpy(_s + _len, s, len);
+            _len += len;
+            _s[_len] = 0;
+        }
+        void num(const char *fmt, long v)
+        {
+            char buf[24];
+            snprintf(buf, sizeof(buf), fmt, v);
+            _s = strdup(buf);
+            _len = strlen(_s);
+        }
+        char          *_s;
+        unsigned int  _len = 0;
+};
+
+template<typename T>
+static inline String operator+(const String& a, const T& b) { String r(a); r += b; return r; }
+static inline String operator+(const char *a, const String& b) { String r(a); r += b; return r; }
+
+static inline bool isAlphaNumeric(int c) { return isalnum(c); }
+static inline bool isDigit(int c) { return isdigit(c); }
+
+static inline unsigned long micros()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long)(t.tv_sec * 1000000ULL + t.tv_nsec / 1000);
+}
+
+#endif
@@ -0,0 +1,20 @@
+/*
+ * Host stub for <DNSServer.h>
+ */
+
+#ifndef _HOST_DNSSERVER_H
+#define _HOST_DNSSERVER_H
+
+#include <WiFi.h>
+
+enum class DNSReplyCode { NoError = 0, NonExistentDomain = 3 };
+
+class DNSServer {
+    public:
+        void processNextRequest() {}
+        void setErrorReplyCode(const DNSReplyCode& code) {}
+        bool start(uint16_t port, const String& domain, const IPAddress& ip) { return true; }
+        void stop() {}
+};
+
+#endif
@@ -0,0 +1,17 @@
+/*
+ * Host stub for <ESPmDNS.h>
+ */
+
+#ifndef _HOST_ESPMDNS_H
+#define _HOST_ESPMDNS_H
+
+class MDNSResponder {
+    public:
+        bool begin(const char *hostName) { return true; }
+        void end() {}
+        void addService(const char *service, const char *proto, uint16_t port) {}
+};
+
+extern MDNSResponder MDNS;
+
+#endif
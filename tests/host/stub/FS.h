@@ -0,0 +1,41 @@
+/*
+ * Host stub for <FS.h>: a File backed by memory. Writes go to
+ * the current position (overwriting pre-allocated contents, as
+ * with mode "r+"); a write limit simulates a full or failing card.
+ */
+
+#ifndef _HOST_FS_H
+#define _HOST_FS_H
+
+#include <Arduino.h>
+#include <string>
+#include <unistd.h>
+
+class File {
+    public:
+        std::string data;
+        size_t      pos = 0;
+        size_t      limit = (size_t)-1;     // bytes accepted in total
+        size_t      written = 0;
+        int         writes = 0;             // calls to write()
+        unsigned    delayUs = 0;            // per write, simulates the card
+        bool        isOpen = true;
+
+        size_t write(const uint8_t *buf, size_t len)
+        {
+            writes++;
+            if(delayUs) usleep(delayUs);
+            if(written + len > limit) len = limit - written;
+            if(pos + len > data.size()) data.resize(pos + len);
+            data.replace(pos, len, (const char *)buf, len);
+            pos += len;
+            written += len;
+            return len;
+        }
+
+        void close() { isOpen = false; }
+        void truncate(size_t len) { if(len < data.size()) data.resize(len); }
+        operator bool() const { return isOpen; }
+};
+
+#endif
@@ -0,0 +1,25 @@
+/*
+ * Host stub for <Update.h>
+ */
+
+#ifndef _HOST_UPDATE_H
+#define _HOST_UPDATE_H
+
+#include <Arduino.h>
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+class UpdateClass {
+    public:
+        bool        begin(size_t size) { return false; }
+        size_t      write(uint8_t *data, size_t len) { return 0; }
+        bool        end(bool evenIfRemaining = false) { return false; }
+        void        abort() {}
+        bool        hasError() { return true; }
+        uint8_t     getError() { return 1; }
+        const char  *errorString() { return "No update on host"; }
+};
+
+extern UpdateClass Update;
+
+#endif
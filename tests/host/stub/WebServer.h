@@ -0,0 +1,152 @@
+/*
+ * Host stub for <WebServer.h>: records the raw response the
+ * ESP32 WebServer would write to the client (status line,
+ * headers, body; chunked transfer encoding if the content
+ * length is unknown). request() runs the handler registered
+ * for a URI, with the given query arguments.
+ */
+
+#ifndef WEBSERVER_H
+#define WEBSERVER_H
+
+#include <Arduino.h>
+#include <string>
+#include <map>
+#include <functional>
+
+typedef enum { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST } HTTPMethod;
+
+typedef enum {
+    UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED
+} HTTPUploadStatus;
+
+#define HTTP_UPLOAD_BUFLEN 1436
+
+typedef struct {
+    HTTPUploadStatus status;
+    String           filename;
+    String           name;
+    String           type;
+    size_t           totalSize;
+    size_t           currentSize;
+    uint8_t          buf[HTTP_UPLOAD_BUFLEN];
+} HTTPUpload;
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+
+class WebServer {
+    public:
+        typedef std::function<void(void)> THandlerFunction;
+
+        std::string out;        // everything sent to the client
+        int         sends = 0;  // calls to send()
+
+        WebServer(int port = 80) {}
+
+        void on(const char *uri, THandlerFunction fn) { _handlers[uri] = fn; }
+        void on(const char *uri, HTTPMethod method, THandlerFunction fn) { _handlers[uri] = fn; }
+        void on(const char *uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn) { _handlers[uri] = fn; }
+        void onNotFound(THandlerFunction fn) { _notFound = fn; }
+        void collectHeaders(const char *headers[], size_t count) {}
+        void begin() {}
+        void stop() {}
+        void handleClient() {}
+
+        // Run the handler for uri; args: "name=value&..." (not decoded)
+        void request(const char *uri, const char *args = "")
+        {
+            std::string a = args;
+            _args.clear();
+            while(!a.empty()) {
+                size_t e = a.find('&');
+                std::string kv = a.substr(0, e);
+                size_t q = kv.find('=');
+                _args[kv.substr(0, q)] = q == std::string::npos ? "" : kv.substr(q + 1);
+                a = e == std::string::npos ? "" : a.substr(e + 1);
+            }
+            out.clear();
+            sends = 0;
+            auto h = _handlers.find(uri);
+            if(h != _handlers.end()) h->second();
+            else if(_notFound) _notFound();
+        }
+
+        bool   hasArg(const String& name) { return _args.count(name.c_str()) > 0; }
+        String arg(const String& name)
+        {
+            auto a = _args.find(name.c_str());
+            return a == _args.end() ? String() : String(a->second.c_str());
+        }
+        String header(const String& name) { return String(); }
+        HTTPUpload& upload() { return _upload; }
+
+        void sendHeader(const String& name, const String& value, bool first = false)
+        {
+            std::string h = std::string(name.c_str()) + ": " + value.c_str() + "\r\n";
+            _headers = first ? h + _headers : _headers + h;
+        }
+
+        void setContentLength(size_t len) { _contentLength = len; }
+
+        void send(int code, const char *contentType, const String& content)
+        {
+            char buf[64];
+            sends++;
+            snprintf(buf, sizeof(buf), "HTTP/1.1 %d OK\r\n", code);
+            out += buf;
+            out += std::string("Content-Type: ") + contentType + "\r\n";
+            if(_contentLength == CONTENT_LENGTH_UNKNOWN) {
+                _chunked = true;
+                out += "Accept-Ranges: none\r\nTransfer-Encoding: chunked\r\n";
+            } else {
+                snprintf(buf, sizeof(buf), "Content-Length: %u\r\n",
+                    (unsigned)(_contentLength == CONTENT_LENGTH_NOT_SET ? content.length() : _contentLength));
+                out += buf;
+            }
+            out += _headers;
+            out += "Connection: close\r\n\r\n";
+            _headers.clear();
+            _contentLength = CONTENT_LENGTH_NOT_SET;
+            if(content.length()) sendContent(content);
+        }
+
+        void send(int code, const String& contentType, const String& content)
+        {
+            send(code, contentType.c_str(), content);
+        }
+
+        void send_P(int code, const char *contentType, const char *content, size_t len)
+        {
+            setContentLength(len);
+            send(code, contentType, String());
+            sendContent(content, len);
+        }
+
+        void sendContent(const char *content, size_t len)
+        {
+            if(_chunked) {
+                char buf[16];
+                snprintf(buf, sizeof(buf), "%x\r\n", (unsigned)len);
+                out += buf;
+                out.append(content, len);
+                out += "\r\n";
+                if(!len) _chunked = false;
+            } else {
+                out.append(content, len);
+            }
+        }
+
+        void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+
+    private:
+        std::map<std::string, THandlerFunction> _handlers;
+        THandlerFunction                        _notFound;
+        std::map<std::string, std::string>      _args;
+        HTTPUpload                              _upload;
+        std::string _headers;
+        size_t      _contentLength = CONTENT_LENGTH_NOT_SET;
+        bool        _chunked = false;
+};
+
+#endif
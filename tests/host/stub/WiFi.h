@@ -0,0 +1,142 @@
+/*
+ * Host stub for <WiFi.h>: a station with a fixed scan result,
+ * set up by the test. Scans complete at once; SCAN_DONE is
+ * delivered to registered event handlers.
+ */
+
+#ifndef _HOST_WIFI_H
+#define _HOST_WIFI_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+#include <string>
+
+typedef enum {
+    WIFI_MODE_NULL = 0, WIFI_MODE_STA, WIFI_MODE_AP, WIFI_MODE_APSTA
+} wifi_mode_t;
+#define WIFI_OFF    WIFI_MODE_NULL
+#define WIFI_STA    WIFI_MODE_STA
+#define WIFI_AP     WIFI_MODE_AP
+#define WIFI_AP_STA WIFI_MODE_APSTA
+
+typedef enum {
+    WL_NO_SHIELD = 255, WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL, WL_SCAN_COMPLETED,
+    WL_CONNECTED, WL_CONNECT_FAILED, WL_CONNECTION_LOST, WL_DISCONNECTED
+} wl_status_t;
+
+typedef enum {
+    WIFI_AUTH_OPEN = 0, WIFI_AUTH_WEP, WIFI_AUTH_WPA_PSK, WIFI_AUTH_WPA2_PSK
+} wifi_auth_mode_t;
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_STA_START = 2, ARDUINO_EVENT_WIFI_STA_STOP,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED, ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP = 7, ARDUINO_EVENT_WIFI_AP_START = 10,
+    ARDUINO_EVENT_WIFI_AP_STOP, ARDUINO_EVENT_WIFI_SCAN_DONE = 1
+} arduino_event_id_t;
+typedef arduino_event_id_t WiFiEvent_t;
+typedef union { int dummy; } arduino_event_info_t;
+typedef size_t wifi_event_id_t;
+typedef std::function<void(WiFiEvent_t, arduino_event_info_t)> WiFiEventFuncCb;
+
+#define WIFI_SCAN_RUNNING   (-1)
+#define WIFI_SCAN_FAILED    (-2)
+
+class IPAddress {
+    public:
+        IPAddress() {}
+        IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _a{ a, b, c, d } {}
+        IPAddress(uint32_t a) { memcpy(_a, &a, 4); }
+        operator uint32_t() const { uint32_t a; memcpy(&a, _a, 4); return a; }
+        uint8_t operator[](int i) const { return _a[i]; }
+        bool fromString(const char *s)
+        {
+            unsigned v[4];
+            if(sscanf(s, "%u.%u.%u.%u", &v[0], &v[1], &v[2], &v[3]) != 4) return false;
+            for(int i = 0; i < 4; i++) _a[i] = v[i];
+            return true;
+        }
+        bool fromString(const String& s) { return fromString(s.c_str()); }
+        String toString() const
+        {
+            char buf[16];
+            snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _a[0], _a[1], _a[2], _a[3]);
+            return String(buf);
+        }
+    private:
+        uint8_t _a[4] = { 0 };
+};
+
+class WiFiClass {
+    public:
+        struct Net {
+            std::string      ssid;
+            int32_t          rssi;
+            wifi_auth_mode_t enc;
+            uint8_t          bssid[6];
+            int32_t          channel;
+        };
+
+        // Set up by the test
+        std::vector<Net> nets;
+        wl_status_t      st = WL_DISCONNECTED;
+        std::string      ssid, hostname = "fluxcapacitor";
+        IPAddress        ip, apIP = IPAddress(192, 168, 4, 1);
+
+        wifi_mode_t  getMode() { return _mode; }
+        bool         mode(wifi_mode_t m) { _mode = m; return true; }
+        bool         enableSTA(bool on) { _mode = (wifi_mode_t)(on ? (_mode | WIFI_STA) : (_mode & ~WIFI_STA)); return true; }
+        bool         enableAP(bool on) { _mode = (wifi_mode_t)(on ? (_mode | WIFI_AP) : (_mode & ~WIFI_AP)); return true; }
+        void         persistent(bool p) {}
+        wl_status_t  status() { return st; }
+        bool         isConnected() { return st == WL_CONNECTED; }
+        wl_status_t  begin(const char *s, const char *p = NULL, int32_t ch = 0, const uint8_t *b = NULL, bool conn = true) { return st; }
+        uint8_t      waitForConnectResult(unsigned long t = 60000) { return st; }
+        bool         disconnect(bool off = false, bool eraseap = false) { return true; }
+        bool         config(IPAddress a, IPAddress b, IPAddress c, IPAddress d = IPAddress()) { return true; }
+        bool         setHostname(const char *h) { hostname = h; return true; }
+        const char   *getHostname() { return hostname.c_str(); }
+        IPAddress    localIP() { return ip; }
+        String       macAddress() { return String("24:0A:C4:00:00:01"); }
+        String       BSSIDstr() { return String("24:0A:C4:00:00:02"); }
+        int32_t      channel() { return 6; }
+        bool         softAP(const char *s, const char *p = NULL, int ch = 1, int hidden = 0, int max = 4) { return true; }
+        bool         softAPConfig(IPAddress a, IPAddress b, IPAddress c) { return true; }
+        bool         softAPdisconnect(bool off = false) { return true; }
+        bool         softAPsetHostname(const char *h) { return true; }
+        const char   *softAPgetHostname() { return hostname.c_str(); }
+        IPAddress    softAPIP() { return apIP; }
+
+        int16_t scanNetworks(bool async = false)
+        {
+            _scanned = true;
+            if(async) {
+                for(auto& cb : _cbs) if(cb) cb(ARDUINO_EVENT_WIFI_SCAN_DONE, arduino_event_info_t());
+                return WIFI_SCAN_RUNNING;
+            }
+            return nets.size();
+        }
+        int16_t          scanComplete() { return _scanned ? (int16_t)nets.size() : WIFI_SCAN_FAILED; }
+        void             scanDelete() { _scanned = false; }
+        String           SSID() { return String(ssid.c_str()); }
+        // Out of range: empty/0, as the core does
+        String           SSID(uint8_t i) { return i < nets.size() ? String(nets[i].ssid.c_str()) : String(); }
+        int32_t          RSSI() { return -50; }
+        int32_t          RSSI(uint8_t i) { return i < nets.size() ? nets[i].rssi : 0; }
+        wifi_auth_mode_t encryptionType(uint8_t i) { return i < nets.size() ? nets[i].enc : WIFI_AUTH_OPEN; }
+        uint8_t          *BSSID(uint8_t i) { return i < nets.size() ? nets[i].bssid : NULL; }
+        int32_t          channel(uint8_t i) { return i < nets.size() ? nets[i].channel : 0; }
+
+        wifi_event_id_t onEvent(WiFiEventFuncCb cb) { _cbs.push_back(cb); return _cbs.size(); }
+        void            removeEvent(wifi_event_id_t id) { if(id && id <= _cbs.size()) _cbs[id - 1] = NULL; }
+
+    private:
+        wifi_mode_t                  _mode = WIFI_OFF;
+        bool                         _scanned = false;
+        std::vector<WiFiEventFuncCb> _cbs;
+};
+
+extern WiFiClass WiFi;
+
+#endif
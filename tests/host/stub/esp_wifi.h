@@ -0,0 +1,39 @@
+/*
+ * Host stub for <esp_wifi.h>
+ */
+
+#ifndef _HOST_ESP_WIFI_H
+#define _HOST_ESP_WIFI_H
+
+#include <stdint.h>
+#include <string.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+
+typedef enum { WIFI_IF_STA = 0, WIFI_IF_AP } wifi_interface_t;
+
+typedef struct {
+    uint8_t  ssid[32];
+    uint8_t  password[64];
+    uint8_t  ssid_len;
+    uint8_t  channel;
+    int      authmode;
+    uint8_t  ssid_hidden;
+    uint8_t  max_connection;
+} wifi_ap_config_t;
+
+typedef struct {
+    uint8_t  ssid[32];
+    uint8_t  password[64];
+} wifi_sta_config_t;
+
+typedef union {
+    wifi_ap_config_t  ap;
+    wifi_sta_config_t sta;
+} wifi_config_t;
+
+static inline esp_err_t esp_wifi_get_config(wifi_interface_t i, wifi_config_t *c) { memset(c, 0, sizeof(*c)); return ESP_OK; }
+static inline esp_err_t esp_wifi_set_country_code(const char *cc, bool ieee) { return ESP_OK; }
+
+#endif
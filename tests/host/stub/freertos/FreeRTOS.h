@@ -0,0 +1,111 @@
+/*
+ * Host stub for the FreeRTOS queue and task API (which Arduino.h
+ * pulls in on the ESP32), on pthreads. Queues copy items, block
+ * with portMAX_DELAY and fail when full/empty otherwise. Deleted
+ * queues are not freed: a task may still return from xQueueSend()
+ * while the receiver deletes the queue, which is fine on FreeRTOS.
+ */
+
+#ifndef _HOST_FREERTOS_H
+#define _HOST_FREERTOS_H
+
+#include <pthread.h>
+#include <string.h>
+#include <stdint.h>
+#include <deque>
+#include <string>
+
+typedef int      BaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t UBaseType_t;
+
+#define pdTRUE          1
+#define pdFALSE         0
+#define pdPASS          pdTRUE
+#define portMAX_DELAY   ((TickType_t)0xffffffff)
+
+struct hostQueue {
+    pthread_mutex_t         mtx = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t          cnd = PTHREAD_COND_INITIALIZER;
+    std::deque<std::string> items;
+    UBaseType_t             len, size;
+};
+typedef hostQueue *QueueHandle_t;
+typedef pthread_t *TaskHandle_t;
+
+static inline QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t size)
+{
+    QueueHandle_t q = new hostQueue;
+    q->len = len;
+    q->size = size;
+    return q;
+}
+
+static inline void vQueueDelete(QueueHandle_t q) { }
+
+static inline BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks)
+{
+    pthread_mutex_lock(&q->mtx);
+    while(q->items.size() >= q->len) {
+        if(ticks != portMAX_DELAY) {
+            pthread_mutex_unlock(&q->mtx);
+            return pdFALSE;
+        }
+        pthread_cond_wait(&q->cnd, &q->mtx);
+    }
+    q->items.push_back(std::string((const char *)item, q->size));
+    pthread_cond_broadcast(&q->cnd);
+    pthread_mutex_unlock(&q->mtx);
+    return pdTRUE;
+}
+
+static inline BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks)
+{
+    pthread_mutex_lock(&q->mtx);
+    while(q->items.empty()) {
+        if(ticks != portMAX_DELAY) {
+            pthread_mutex_unlock(&q->mtx);
+            return pdFALSE;
+        }
+        pthread_cond_wait(&q->cnd, &q->mtx);
+    }
+    memcpy(item, q->items.front().data(), q->size);
+    q->items.pop_front();
+    pthread_cond_broadcast(&q->cnd);
+    pthread_mutex_unlock(&q->mtx);
+    return pdTRUE;
+}
+
+struct hostTask {
+    void (*func)(void *);
+    void *parm;
+};
+
+static void *hostTaskRun(void *p)
+{
+    hostTask t = *(hostTask *)p;
+    delete (hostTask *)p;
+    t.func(t.parm);
+    return NULL;
+}
+
+static inline BaseType_t xTaskCreate(void (*func)(void *), const char *name, uint32_t stack,
+                                     void *parm, UBaseType_t prio, TaskHandle_t *handle)
+{
+    static pthread_t th;
+    pthread_attr_t attr;
+    hostTask *t = new hostTask { func, parm };
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if(pthread_create(&th, &attr, hostTaskRun, t)) {
+        delete t;
+        return pdFALSE;
+    }
+    if(handle) *handle = &th;
+    return pdPASS;
+}
+
+// Only vTaskDelete(NULL) as the task's last statement
+static inline void vTaskDelete(TaskHandle_t task) { }
+
+#endif
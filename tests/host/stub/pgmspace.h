@@ -0,0 +1,14 @@
+/*
+ * Host stub for <pgmspace.h>: flash is plain memory on the host.
+ */
+
+#ifndef _HOST_PGMSPACE_H
+#define _HOST_PGMSPACE_H
+
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(x)          (x)
+#define memcpy_P         memcpy
+
+#endif
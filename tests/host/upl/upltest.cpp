@@ -0,0 +1,286 @@
+/*
+ * Host test: buffered upload writer (fc_uplbuf.h, FC_UPLBUF)
+ *
+ * Replays a multipart/form-data upload the way the ESP32 WebServer
+ * hands it to handleUploading() (UPLOAD_FILE_START, WRITE in chunks
+ * of HTTP_UPLOAD_BUFLEN, END) through the writer, with the calls
+ * and checks of openUploadFile(), writeACFile() and closeACFile().
+ * Each resulting file must match its part byte for byte, including
+ * the pre-allocated and then truncated sound-pack. Also: a slow
+ * card, smaller and no buffers (malloc failing), a failing card.
+ * Writer task and filler run as threads; built with ThreadSanitizer.
+ *
+ * upltest [body boundary] replays a recorded request body instead
+ * (eg saved from the browser's developer tools).
+ */
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include <FS.h>
+#include <freertos/FreeRTOS.h>
+
+static int mallocFails = 0;     // fail this many malloc()s
+static void *testMalloc(size_t n)
+{
+    if(mallocFails > 0) {
+        mallocFails--;
+        return NULL;
+    }
+    return malloc(n);
+}
+#define malloc(n) testMalloc(n)
+
+#include "fc_uplbuf.h"
+
+#undef malloc
+
+#define HTTP_UPLOAD_BUFLEN 1436
+
+static int fails = 0;
+
+static void check(bool ok, const char *what)
+{
+    printf("%s: %s\n", ok ? "ok  " : "FAIL", what);
+    if(!ok) fails++;
+}
+
+struct Part {
+    std::string filename;
+    std::string data;
+};
+
+struct Result {
+    std::string filename;
+    File        *file;
+    bool        prealloc;
+    bool        err;
+    uint32_t    bufSize;
+};
+
+// Pseudo-random data, with CR LF "--" sequences as in real files
+static std::string mkData(size_t len, uint32_t seed)
+{
+    std::string d(len, 0);
+    for(size_t i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        d[i] = (char)(seed >> 16);
+        if(!(i % 997) && i + 4 < len) {
+            d.replace(i, 4, "\r\n--");
+            i += 3;
+        }
+    }
+    return d;
+}
+
+static std::string mkBody(const std::vector<Part>& parts, const std::string& boundary)
+{
+    std::string b;
+    for(auto& p : parts) {
+        b += "--" + boundary + "\r\n";
+        b += "Content-Disposition: form-data; name=\"upload\"; filename=\"" + p.filename + "\"\r\n";
+        b += "Content-Type: application/octet-stream\r\n\r\n";
+        b += p.data + "\r\n";
+    }
+    b += "--" + boundary + "--\r\n";
+    return b;
+}
+
+// Per upload, as in the test's File and fc_wifi/fc_settings
+static struct {
+    File        *file;
+    bool        haveFile;
+    bool        err;
+    std::string name;
+} ul;
+static std::vector<Result> results;
+static unsigned cardDelayUs = 0;
+static size_t   cardLimit = (size_t)-1;
+
+// handleUploading() -> openUploadFile()/writeACFile()/closeACFile()
+static void uploadStart(const std::string& fn, size_t sizeHint)
+{
+    bool prealloc = (results.empty() && fn.size() > 4 &&
+                     !fn.compare(fn.size() - 4, 4, ".bin") && sizeHint);
+
+    ul.file = new File;
+    ul.file->delayUs = cardDelayUs;
+    ul.file->limit = cardLimit;
+    ul.name = fn;
+    ul.err = false;
+    if(prealloc) {
+        // SD.preallocate(): file of sizeHint bytes, opened "r+"
+        ul.file->data.assign(sizeHint, (char)0xee);
+    }
+    uplwBegin(*ul.file, prealloc ? ul.name.c_str() : NULL);
+    ul.haveFile = true;
+    results.push_back({ fn, ul.file, prealloc, false, uplwBufSize });
+}
+
+static bool closeFile()
+{
+    bool ret = uplwEnd();
+    ul.file->close();
+    if(uplwTruncName) {
+        ul.file->truncate(uplwTotal);
+        uplwTruncName = NULL;
+    }
+    uplwFile = NULL;
+    ul.haveFile = false;
+    return ret;
+}
+
+static void uploadWrite(uint8_t *buf, size_t len)
+{
+    if(ul.haveFile) {
+        if(uplwWrite(buf, len) != len) {
+            closeFile();
+            ul.err = true;
+        }
+    }
+}
+
+static void uploadEnd()
+{
+    if(ul.haveFile && !closeFile()) {
+        ul.err = true;
+    }
+    results.back().err = ul.err;
+}
+
+// WebServer::_parseForm(): parts with a filename become uploads,
+// data is passed on in chunks of HTTP_UPLOAD_BUFLEN
+static bool replay(const std::string& body, const std::string& boundary)
+{
+    std::string delim = "--" + boundary;
+    size_t pos = body.find(delim);
+    uint8_t buf[HTTP_UPLOAD_BUFLEN];
+
+    if(pos == std::string::npos) return false;
+
+    for(;;) {
+        pos += delim.size();
+        if(!body.compare(pos, 2, "--")) return true;
+        size_t hend = body.find("\r\n\r\n", pos);
+        if(hend == std::string::npos) return false;
+        std::string hdr = body.substr(pos, hend - pos);
+        size_t dstart = hend + 4;
+        size_t dend = body.find("\r\n" + delim, dstart);
+        if(dend == std::string::npos) return false;
+        size_t fpos = hdr.find("filename=\"");
+        if(fpos != std::string::npos) {
+            fpos += 10;
+            uploadStart(hdr.substr(fpos, hdr.find('"', fpos) - fpos), body.size());
+            for(size_t i = dstart; i < dend; i += HTTP_UPLOAD_BUFLEN) {
+                size_t n = dend - i < HTTP_UPLOAD_BUFLEN ? dend - i : HTTP_UPLOAD_BUFLEN;
+                memcpy(buf, body.data() + i, n);
+                uploadWrite(buf, n);
+            }
+            uploadEnd();
+        }
+        pos = dend + 2;
+    }
+}
+
+static void reset()
+{
+    for(auto& r : results) delete r.file;
+    results.clear();
+    cardDelayUs = 0;
+    cardLimit = (size_t)-1;
+    mallocFails = 0;
+}
+
+static bool sameFiles(const std::vector<Part>& parts)
+{
+    if(results.size() != parts.size()) return false;
+    for(size_t i = 0; i < parts.size(); i++) {
+        if(results[i].err || results[i].file->data != parts[i].data) {
+            printf("      %s: %zu bytes, expected %zu%s\n", parts[i].filename.c_str(),
+                results[i].file->data.size(), parts[i].data.size(), results[i].err ? ", error" : "");
+            return false;
+        }
+    }
+    return true;
+}
+
+// All writes but the last are whole buffers
+static bool wholeBuffers()
+{
+    for(auto& r : results) {
+        size_t n = r.file->data.size();
+        int expect = r.bufSize ? (n + r.bufSize - 1) / r.bufSize : (n + HTTP_UPLOAD_BUFLEN - 1) / HTTP_UPLOAD_BUFLEN;
+        if(r.file->writes != expect) {
+            printf("      %s: %d writes, expected %d\n", r.filename.c_str(), r.file->writes, expect);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const std::string boundary = "----WebKitFormBoundaryq3Zp8GbU1xKv7RfT";
+
+    if(argc == 3) {
+        FILE *f = fopen(argv[1], "rb");
+        std::string body;
+        char buf[4096];
+        size_t n;
+        if(!f) {
+            perror(argv[1]);
+            return 1;
+        }
+        while((n = fread(buf, 1, sizeof(buf), f)) > 0) body.append(buf, n);
+        fclose(f);
+        check(replay(body, argv[2]), "recorded body parsed");
+        for(auto& r : results) {
+            printf("      %s: %zu bytes%s\n", r.filename.c_str(), r.file->data.size(), r.err ? ", error" : "");
+        }
+        return fails ? 1 : 0;
+    }
+
+    // Sound-pack first (pre-allocated to Content-Length, then
+    // truncated), then mp3s: empty, whole upload chunks, whole
+    // buffers, short
+    std::vector<Part> parts = {
+        { "fcsound.bin", mkData(150001, 1) },
+        { "key1.mp3",    mkData(0, 2) },
+        { "key2.mp3",    mkData(3 * HTTP_UPLOAD_BUFLEN, 3) },
+        { "key3.mp3",    mkData(2 * UPLW_BUFSIZE, 4) },
+        { "user1.mp3",   mkData(1000, 5) }
+    };
+    std::string body = mkBody(parts, boundary);
+
+    check(replay(body, boundary) && sameFiles(parts), "upload: files match byte for byte");
+    check(results[0].prealloc, "upload: sound-pack pre-allocated and truncated");
+    check(results[0].bufSize == UPLW_BUFSIZE, "upload: 2 full-size buffers");
+    check(wholeBuffers(), "upload: whole buffers written, but for the last");
+
+    reset();
+    cardDelayUs = 500;
+    check(replay(body, boundary) && sameFiles(parts), "slow card: files match");
+    check(wholeBuffers(), "slow card: whole buffers written, but for the last");
+
+    reset();
+    mallocFails = 1;
+    check(replay(body, boundary) && sameFiles(parts), "first malloc fails: files match");
+    check(results[0].bufSize == UPLW_BUFSIZE / 2, "first malloc fails: half-size buffers");
+    check(wholeBuffers(), "first malloc fails: whole buffers written, but for the last");
+
+    reset();
+    mallocFails = 1000;
+    check(replay(body, boundary) && sameFiles(parts), "no buffers: files match (unbuffered)");
+    check(results[0].bufSize == 0 && wholeBuffers(), "no buffers: one write per upload chunk");
+
+    reset();
+    cardLimit = 40000;
+    cardDelayUs = 100;
+    replay(body, boundary);
+    check(results.size() == parts.size() && results[0].err, "card fails: sound-pack upload fails");
+    check(!results[4].err && results[4].file->data == parts[4].data, "card fails: next upload unaffected");
+
+    reset();
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,270 @@
+/*
+ * Host test: WiFiManager page output (wm_page.cpp)
+ *
+ * Builds the same pages through WMPage with and without WM_STREAM
+ * (one binary each) and writes each response, as the client sees
+ * it after dechunking, to stdout. The Makefile compares the outputs
+ * byte for byte, so the streamed pages must equal the buffered ones
+ * (status, headers incl. cache-control, body).
+ *
+ * Pages are random sequences of the appends the page builders use
+ * (char *, String, F(), char, NULL, empty), with pieces from one
+ * byte up to several times the chunk size; then the portal's own
+ * pages (root, WiFi with and without scan list, both settings
+ * pages, update), rendered by WiFiManager.cpp's handlers with a
+ * set of parameters like the firmware's (stubbed WiFi, fixed scan
+ * result).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "wm_page.h"
+#include "WiFiManager.h"
+
+WiFiClass     WiFi;
+UpdateClass   Update;
+MDNSResponder MDNS;
+
+#define PAGES 300
+
+static uint32_t rnds;
+
+static uint32_t rnd(uint32_t n)
+{
+    rnds ^= rnds << 13;
+    rnds ^= rnds >> 17;
+    rnds ^= rnds << 5;
+    return rnds % n;
+}
+
+static char text[8192];
+
+static void fail(int page, const char *what)
+{
+    fprintf(stderr, "page %d: %s\n", page, what);
+    exit(1);
+}
+
+// What WiFiManager::HTTPSend(WMPage&) does
+static void pageSend(WebServer& server, WMPage& page, bool sendCC)
+{
+#ifdef WM_STREAM
+    page.end();
+#else
+    if(sendCC) {
+        server.sendHeader("Cache-Control", "no-store, must-revalidate, no-cache");
+        server.sendHeader("Pragma", "no-cache");
+        server.sendHeader("Expires", "0");
+    }
+    server.send(200, HTTP_HEAD_CT, page);
+#endif
+}
+
+// Split the raw response into headers and body; drop the headers
+// that differ by design (length vs. chunked)
+static std::string client(int pn, const std::string& raw)
+{
+    size_t p = raw.find("\r\n\r\n");
+    std::string head, body, res;
+    bool chunked;
+    long clen = -1;
+
+    if(p == std::string::npos) fail(pn, "no end of headers");
+    head = raw.substr(0, p + 2);
+    body = raw.substr(p + 4);
+    chunked = head.find("Transfer-Encoding: chunked\r\n") != std::string::npos;
+
+    for(size_t i = 0, e; (e = head.find("\r\n", i)) != std::string::npos; i = e + 2) {
+        std::string l = head.substr(i, e - i);
+        if(!l.compare(0, 16, "Content-Length: ")) {
+            clen = atol(l.c_str() + 16);
+            continue;
+        }
+        if(l == "Transfer-Encoding: chunked" || l == "Accept-Ranges: none")
+            continue;
+        res += l + "\n";
+    }
+    res += "\n";
+
+    if(chunked) {
+        std::string dec;
+        size_t i = 0;
+        for(;;) {
+            size_t e = body.find("\r\n", i);
+            if(e == std::string::npos) fail(pn, "bad chunk header");
+            unsigned long n = strtoul(body.substr(i, e - i).c_str(), NULL, 16);
+            i = e + 2;
+            if(i + n + 2 > body.size() || body.compare(i + n, 2, "\r\n"))
+                fail(pn, "bad chunk");
+            if(!n) break;
+            dec += body.substr(i, n);
+            i += n + 2;
+        }
+        if(i + 2 != body.size()) fail(pn, "data after last chunk");
+        body = dec;
+    } else if(clen != (long)body.size()) {
+        fail(pn, "content length mismatch");
+    }
+
+    return res + body;
+}
+
+// Portal set up like the firmware's (fc_wifi.cpp)
+
+static const int8_t menu[] = {
+    WM_MENU_WIFI, WM_MENU_PARAM, WM_MENU_PARAM2, WM_MENU_SEP_F,
+    WM_MENU_UPDATE, WM_MENU_SEP, WM_MENU_CUSTOM, WM_MENU_END
+};
+
+static const char head[] = "<link rel='icon' href='data:,'><style>.tpm{cursor:pointer}</style>";
+static const char custMenu[] = "<div style='font-size:0.75em'>V1.0 (TEST)<br>Powered by <a href='https://out-a-ti.me'>A10001986</a></div>";
+
+static unsigned int genLen;
+static const char genHTML[] = "<div class='cmp0'><label for='sel'>Mode</label><select class='sel0' name='sel' id='sel'>"
+                              "<option value='0'>Off</option><option value='1' selected>On</option></select></div>";
+
+static const char *genSelect(const char *dest, int op)
+{
+    if(op == WM_CP_DESTROY) {
+        if(dest) free((void *)dest);
+        return NULL;
+    }
+    if(op == WM_CP_LEN) {
+        genLen = sizeof(genHTML);
+        return (const char *)&genLen;
+    }
+    return strdup(genHTML);
+}
+
+static const char menuExtra[] = "<hr><form action='/x' method='get'><button>App &amp; more</button></form>";
+static void menuOut(WMPage& page, unsigned int extra) { page += menuExtra; }
+static int menuOutLen() { return sizeof(menuExtra); }
+
+static WiFiManagerParameter p_host("hostname", "Hostname<br><span>Max 31 chars</span>", "flux", 31, "pattern='[A-Za-z0-9\\-]+' placeholder='Example: flux'", WFM_LABEL_BEFORE|WFM_SECTS_HEAD);
+static WiFiManagerParameter p_sect("WiFi connection: Other settings", WFM_SECTS|WFM_HL);
+static WiFiManagerParameter p_ret("wifiret", "Connection attempts (1-10)", "3", 2, "type='number' min='1' max='10'");
+static WiFiManagerParameter p_hint("<div style='font-size:80%'>Enter *77ok to re-enable WiFi</div>", WFM_FOOT);
+
+static WiFiManagerParameter s_gen(genSelect, WFM_SECTS_HEAD);
+static WiFiManagerParameter s_chk1("oSeq", "Movie sequence for 7 lights", "1", "title='When checked, ...' class='mt5'", WFM_LABEL_AFTER|WFM_IS_CHKBOX);
+static WiFiManagerParameter s_chk2("sTTBL", "Skip \"box light\" animation", "0", "", WFM_LABEL_AFTER|WFM_IS_CHKBOX);
+static WiFiManagerParameter s_num("ssDel", "Screen saver timer (1-999[minutes]; 0=off)", "0", 3, "type='number' min='0' max='999'");
+static WiFiManagerParameter s_sect("Wireless communication (BTTF-Network)", WFM_SECTS|WFM_HL);
+static WiFiManagerParameter s_ip("tcdIP", "Hostname or IP address of TCD", "<tc&d>'\"", 31, "placeholder='Example: timecircuits'", WFM_NO_BR);
+static WiFiManagerParameter s_last("dDIR", "Disable supplied IR control", "0", "", WFM_LABEL_AFTER|WFM_IS_CHKBOX|WFM_FOOT);
+
+static WiFiManagerParameter m_use("uMQTT", "Home Assistant support (MQTT)", "1", "class='mt5 mb10'", WFM_LABEL_AFTER|WFM_IS_CHKBOX|WFM_SECTS_HEAD);
+static WiFiManagerParameter m_srv("ha_server", "Broker IP[:port] or domain[:port]", "192.168.1.5:1883", 79, "placeholder='Example: 192.168.1.5'");
+static WiFiManagerParameter m_usr("ha_usr", "User[:Password]", "ronald:my&Secret", 63, "", WFM_LABEL_BEFORE|WFM_FOOT);
+
+static void portalPages(int pn)
+{
+    static const char *reqs[][2] = {
+        { "/", "" }, { "/wifi", "" }, { "/wifi", "showall=" }, { "/param", "" },
+        { "/param2", "" }, { "/update", "" }, { "/wifi", "" }
+    };
+    WiFiManager wm;
+    WiFiManagerParameter *wp[] = { &p_host, &p_sect, &p_ret, &p_hint };
+    WiFiManagerParameter *sp[] = { &s_gen, &s_chk1, &s_chk2, &s_num, &s_sect, &s_ip, &s_last };
+    WiFiManagerParameter *mp[] = { &m_use, &m_srv, &m_usr };
+
+    WiFi.nets = {
+        { "Home <5G>",      -48, WIFI_AUTH_WPA2_PSK, { 1, 2, 3, 4, 5, 6 }, 36 },
+        { "TCD-AP",         -60, WIFI_AUTH_WPA2_PSK, { 1, 2, 3, 4, 5, 7 }, 6 },
+        { "cafe & \"bar\"", -75, WIFI_AUTH_OPEN,     { 1, 2, 3, 4, 5, 8 }, 1 },
+        { "Home <5G>",      -82, WIFI_AUTH_WPA2_PSK, { 1, 2, 3, 4, 5, 9 }, 40 },
+        { "",               -90, WIFI_AUTH_WPA_PSK,  { 1, 2, 3, 4, 5, 10 }, 11 }
+    };
+    WiFi.ip = IPAddress(192, 168, 1, 23);
+    WiFi.st = WL_CONNECTED;
+    WiFi.mode(WIFI_STA);
+
+    wm.setHostname("flux");
+    wm.setTitle("Flux Capacitor");
+    wm.setCustomHeadElement(head);
+    wm.setCustomMenuHTML(custMenu);
+    wm.setMenuOutCallback(menuOut);
+    wm.setMenuOutLenCallback(menuOutLen);
+    wm.showUploadContainer(true, "FCA", "V1.0", false);
+    wm.setMenu(menu, sizeof(menu), false);
+    wm.allocParms(WM_PARM_WIFI, sizeof(wp) / sizeof(wp[0]));
+    for(auto p : wp) wm.addParameter(WM_PARM_WIFI, p);
+    wm.allocParms(WM_PARM_SETTINGS, sizeof(sp) / sizeof(sp[0]));
+    for(auto p : sp) wm.addParameter(WM_PARM_SETTINGS, p);
+    wm.allocParms(WM_PARM_SETTINGS2, sizeof(mp) / sizeof(mp[0]));
+    for(auto p : mp) wm.addParameter(WM_PARM_SETTINGS2, p);
+
+    wm.startWebPortal();
+
+    for(unsigned i = 0; i < sizeof(reqs) / sizeof(reqs[0]); i++, pn++) {
+        // Last one: WiFi page in client car mode
+        if(i == sizeof(reqs) / sizeof(reqs[0]) - 1) wm.setCCarMode(true);
+        wm.server->request(reqs[i][0], reqs[i][1]);
+        if(wm.server->sends != 1) fail(pn, "send() not called exactly once");
+        printf("== %s?%s\n%s\n", reqs[i][0], reqs[i][1], client(pn, wm.server->out).c_str());
+    }
+}
+
+int main()
+{
+    for(unsigned i = 0; i < sizeof(text) - 1; i++) {
+        text[i] = " <>='/abcdefghijklmnopqrstuvwxyz0123456789\n"[i % 43];
+    }
+
+    rnds = 0x2545f491;
+
+    for(int pn = 0; pn < PAGES; pn++) {
+        WebServer server;
+        bool sendCC = rnd(2);
+        int ops = pn < 2 ? pn : rnd(200);
+        unsigned int total = 0;
+
+        {
+            WMPage page(&server, sendCC);
+
+            page.reserve(rnd(4096));
+
+            for(int i = 0; i < ops; i++) {
+                unsigned int len = rnd(8) ? rnd(100) : rnd(sizeof(text));
+                char *s = text + rnd(sizeof(text) - len);
+                char *z = s + len, save = *z;
+                *z = 0;
+                switch(rnd(5)) {
+                case 0:
+                    page += (const char *)s;
+                    break;
+                case 1:
+                    page += String(s);
+                    break;
+                case 2:
+                    page += F(s);
+                    break;
+                case 3:
+                    page += *s ? *s : 'x';
+                    len = 1;
+                    break;
+                case 4:
+                    page += (const char *)(rnd(2) ? NULL : "");
+                    len = 0;
+                    break;
+                }
+                *z = save;
+                total += len;
+            }
+
+            if(page.length() != total) fail(pn, "length mismatch");
+
+            pageSend(server, page, sendCC);
+        }
+
+        if(server.sends != 1) fail(pn, "send() not called exactly once");
+
+        printf("== page %d\n%s\n", pn, client(pn, server.out).c_str());
+    }
+
+    portalPages(PAGES);
+
+    return 0;
+}